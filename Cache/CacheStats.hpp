@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+
+namespace AlgoStruct
+{
+// Counters of cache lookups and evictions
+struct CacheStats
+{
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+
+    double hit_ratio() const noexcept
+    {
+        const size_t lookups = hits + misses;
+        return lookups ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0;
+    }
+
+    CacheStats& operator+= (const CacheStats& other) noexcept
+    {
+        hits += other.hits;
+        misses += other.misses;
+        evictions += other.evictions;
+        return *this;
+    }
+};
+
+} // namespace AlgoStruct
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "CacheStats.hpp"
+#include "DoublyLinkedList.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace AlgoStruct
+{
+// Bounded cache evicting the least frequently used entry, O(1) for all operations.
+//
+// Entries with the same use count are kept in a bucket, buckets are ordered by count:
+//
+//   m_buckets:  [freq 1] <-> [freq 3] <-> [freq 4]
+//                  |            |            |
+//                entries      entries      entries     (most recent first)
+//
+// A hit moves the entry to the bucket with count + 1, creating it next to the current one
+// if needed. The victim is the least recent entry of the first bucket, so ties between
+// equally used entries are resolved by recency. Not thread-safe, see ShardedCache.
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class LfuCache
+{
+    struct Bucket;
+    using BucketList = DoublyLinkedList<Bucket>;
+
+    struct Entry
+    {
+        Entry(const Key& k, Value v, typename BucketList::iterator b): key(k), value(std::move(v)), bucket(b) {}
+
+        Key key;
+        Value value;
+        typename BucketList::iterator bucket;
+    };
+
+    using EntryList = DoublyLinkedList<Entry>;
+
+    struct Bucket
+    {
+        explicit Bucket(size_t f): frequency(f) {}
+
+        size_t frequency;
+        EntryList entries;
+    };
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using hasher = Hash;
+
+    explicit LfuCache(size_t capacity);
+
+    // Pointer to cached value or nullptr. Increments use count of the entry.
+    // The pointer is valid until the next modification of the cache
+    Value* get(const Key& key);
+
+    // Inserts or updates value, evicting the least frequently used entry if the cache is full.
+    // Update counts as a use
+    void put(const Key& key, Value value);
+
+    // Lookup without updating use count and counters
+    bool contains(const Key& key) const { return m_index.count(key) != 0; }
+
+    // Use count of cached key, 0 if absent
+    size_t frequency(const Key& key) const;
+
+    bool erase(const Key& key);
+    void clear();
+
+    size_t size() const noexcept { return m_index.size(); }
+    size_t capacity() const noexcept { return m_capacity; }
+
+    const CacheStats& stats() const noexcept { return m_stats; }
+    void reset_stats() noexcept { m_stats = {}; }
+
+private:
+    // Moves entry to the bucket of the next frequency
+    void touch(typename EntryList::iterator entry);
+    // Removes entry and its bucket if it becomes empty
+    void remove(typename EntryList::iterator entry);
+
+private:
+    size_t m_capacity;
+    BucketList m_buckets;
+    std::unordered_map<Key, typename EntryList::iterator, Hash> m_index;
+    CacheStats m_stats;
+};
+
+template<typename Key, typename Value, typename Hash>
+LfuCache<Key, Value, Hash>::LfuCache(size_t capacity)
+    : m_capacity(capacity)
+{
+    if (capacity == 0) throw std::invalid_argument("LfuCache capacity must be positive");
+
+    m_index.reserve(capacity);
+}
+
+template<typename Key, typename Value, typename Hash>
+Value* LfuCache<Key, Value, Hash>::get(const Key& key)
+{
+    const auto found = m_index.find(key);
+    if (found == m_index.end())
+    {
+        ++m_stats.misses;
+        return nullptr;
+    }
+
+    ++m_stats.hits;
+    touch(found->second);
+    return &found->second->value;
+}
+
+template<typename Key, typename Value, typename Hash>
+void LfuCache<Key, Value, Hash>::put(const Key& key, Value value)
+{
+    if (const auto found = m_index.find(key); found != m_index.end())
+    {
+        found->second->value = std::move(value);
+        touch(found->second);
+        return;
+    }
+
+    if (m_index.size() < m_capacity)
+    {
+        if (m_buckets.empty() || m_buckets.front().frequency != 1)
+        {
+            m_buckets.emplace_front(1);
+        }
+
+        auto bucket = m_buckets.begin();
+        bucket->entries.emplace_front(key, std::move(value), bucket);
+        m_index.emplace(key, bucket->entries.begin());
+        return;
+    }
+
+    // Evicted node is reused for the new entry
+    const auto victimBucket = m_buckets.begin();
+    auto victim = std::prev(victimBucket->entries.end());
+    auto node = m_index.extract(victim->key);
+    ++m_stats.evictions;
+
+    victim->key = key;
+    victim->value = std::move(value);
+
+    if (victimBucket->frequency != 1)
+    {
+        m_buckets.emplace_front(1);
+    }
+
+    auto bucket = m_buckets.begin();
+    bucket->entries.splice(bucket->entries.begin(), victimBucket->entries, victim);
+    victim->bucket = bucket;
+
+    if (victimBucket->entries.empty())
+    {
+        m_buckets.erase(victimBucket);
+    }
+
+    node.key() = key;
+    m_index.insert(std::move(node));
+}
+
+template<typename Key, typename Value, typename Hash>
+size_t LfuCache<Key, Value, Hash>::frequency(const Key& key) const
+{
+    const auto found = m_index.find(key);
+    return found == m_index.end() ? 0 : found->second->bucket->frequency;
+}
+
+template<typename Key, typename Value, typename Hash>
+bool LfuCache<Key, Value, Hash>::erase(const Key& key)
+{
+    const auto found = m_index.find(key);
+    if (found == m_index.end()) return false;
+
+    remove(found->second);
+    m_index.erase(found);
+    return true;
+}
+
+template<typename Key, typename Value, typename Hash>
+void LfuCache<Key, Value, Hash>::clear()
+{
+    m_index.clear();
+    m_buckets.clear();
+}
+
+template<typename Key, typename Value, typename Hash>
+void LfuCache<Key, Value, Hash>::touch(typename EntryList::iterator entry)
+{
+    const auto bucket = entry->bucket;
+    auto next = std::next(bucket);
+
+    if (next == m_buckets.end() || next->frequency != bucket->frequency + 1)
+    {
+        next = m_buckets.emplace(next, bucket->frequency + 1);
+    }
+
+    // Node is relinked, iterator in m_index stays valid
+    next->entries.splice(next->entries.begin(), bucket->entries, entry);
+    entry->bucket = next;
+
+    if (bucket->entries.empty())
+    {
+        m_buckets.erase(bucket);
+    }
+}
+
+template<typename Key, typename Value, typename Hash>
+void LfuCache<Key, Value, Hash>::remove(typename EntryList::iterator entry)
+{
+    const auto bucket = entry->bucket;
+    bucket->entries.erase(entry);
+
+    if (bucket->entries.empty())
+    {
+        m_buckets.erase(bucket);
+    }
+}
+
+} // namespace AlgoStruct
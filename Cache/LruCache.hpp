@@ -0,0 +1,143 @@
+#pragma once
+
+#include "CacheStats.hpp"
+#include "DoublyLinkedList.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace AlgoStruct
+{
+// Bounded cache evicting the least recently used entry.
+//
+//   m_index: key -> node of m_items
+//
+//   m_items:  [most recent] <-> ... <-> [least recent]
+//                  ^                          |
+//             get()/put() move               evicted when
+//             the entry here                 capacity is reached
+//
+// All operations are O(1): a hit relinks the node to the front, an eviction reuses the
+// node of the evicted entry for the new one. Not thread-safe, see ShardedCache.
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache
+{
+    struct Entry
+    {
+        Entry(const Key& k, Value v): key(k), value(std::move(v)) {}
+
+        Key key;
+        Value value;
+    };
+
+    using List = DoublyLinkedList<Entry>;
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using hasher = Hash;
+
+    explicit LruCache(size_t capacity);
+
+    // Pointer to cached value or nullptr. Marks the entry as recently used.
+    // The pointer is valid until the next modification of the cache
+    Value* get(const Key& key);
+
+    // Inserts or updates value, evicting the least recently used entry if the cache is full
+    void put(const Key& key, Value value);
+
+    // Lookup without updating recency and counters
+    bool contains(const Key& key) const { return m_index.count(key) != 0; }
+
+    bool erase(const Key& key);
+    void clear();
+
+    size_t size() const noexcept { return m_items.size(); }
+    size_t capacity() const noexcept { return m_capacity; }
+
+    const CacheStats& stats() const noexcept { return m_stats; }
+    void reset_stats() noexcept { m_stats = {}; }
+
+private:
+    size_t m_capacity;
+    List m_items;
+    std::unordered_map<Key, typename List::iterator, Hash> m_index;
+    CacheStats m_stats;
+};
+
+template<typename Key, typename Value, typename Hash>
+LruCache<Key, Value, Hash>::LruCache(size_t capacity)
+    : m_capacity(capacity)
+{
+    if (capacity == 0) throw std::invalid_argument("LruCache capacity must be positive");
+
+    m_index.reserve(capacity);
+}
+
+template<typename Key, typename Value, typename Hash>
+Value* LruCache<Key, Value, Hash>::get(const Key& key)
+{
+    const auto found = m_index.find(key);
+    if (found == m_index.end())
+    {
+        ++m_stats.misses;
+        return nullptr;
+    }
+
+    ++m_stats.hits;
+    m_items.splice(m_items.begin(), m_items, found->second);
+    return &found->second->value;
+}
+
+template<typename Key, typename Value, typename Hash>
+void LruCache<Key, Value, Hash>::put(const Key& key, Value value)
+{
+    if (const auto found = m_index.find(key); found != m_index.end())
+    {
+        found->second->value = std::move(value);
+        m_items.splice(m_items.begin(), m_items, found->second);
+        return;
+    }
+
+    if (m_items.size() < m_capacity)
+    {
+        m_items.emplace_front(key, std::move(value));
+        m_index.emplace(key, m_items.begin());
+        return;
+    }
+
+    // Evicted node is reused for the new entry
+    auto victim = std::prev(m_items.end());
+    auto node = m_index.extract(victim->key);
+    ++m_stats.evictions;
+
+    victim->key = key;
+    victim->value = std::move(value);
+    m_items.splice(m_items.begin(), m_items, victim);
+
+    node.key() = key;
+    m_index.insert(std::move(node));
+}
+
+template<typename Key, typename Value, typename Hash>
+bool LruCache<Key, Value, Hash>::erase(const Key& key)
+{
+    const auto found = m_index.find(key);
+    if (found == m_index.end()) return false;
+
+    m_items.erase(found->second);
+    m_index.erase(found);
+    return true;
+}
+
+template<typename Key, typename Value, typename Hash>
+void LruCache<Key, Value, Hash>::clear()
+{
+    m_index.clear();
+    m_items.clear();
+}
+
+} // namespace AlgoStruct
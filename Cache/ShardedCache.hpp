@@ -0,0 +1,145 @@
+#pragma once
+
+#include "CacheStats.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace AlgoStruct
+{
+// Thread-safe cache split into independent shards, each guarded by its own mutex:
+//
+//   key -> hash -> shard i -> [mutex | LruCache / LfuCache]
+//
+// Threads accessing different shards do not contend. Capacity is split evenly between
+// shards, so eviction order is exact only within a shard.
+template<typename Cache>
+class ShardedCache
+{
+public:
+    using key_type = typename Cache::key_type;
+    using mapped_type = typename Cache::mapped_type;
+    using hasher = typename Cache::hasher;
+
+    explicit ShardedCache(size_t capacity, size_t shardCount = std::thread::hardware_concurrency());
+
+    // Copy of cached value
+    std::optional<mapped_type> get(const key_type& key);
+    void put(const key_type& key, mapped_type value);
+    bool erase(const key_type& key);
+    void clear();
+
+    size_t size() const;
+    size_t shard_count() const noexcept { return m_shards.size(); }
+
+    // Sum of counters of all shards
+    CacheStats stats() const;
+
+private:
+    // Shards on separate cache lines to avoid false sharing of mutexes
+    struct alignas(64) Shard
+    {
+        explicit Shard(size_t capacity): cache(capacity) {}
+
+        mutable std::mutex mutex;
+        Cache cache;
+    };
+
+    Shard& shard_for(const key_type& key) const
+    {
+        // Fibonacci hashing: high bits of the product, which unordered_map inside the shard
+        // does not use for bucket selection
+        const auto mixed = static_cast<uint64_t>(hasher{}(key)) * 0x9E3779B97F4A7C15ull;
+        return *m_shards[(mixed >> 32) % m_shards.size()];
+    }
+
+private:
+    std::vector<std::unique_ptr<Shard>> m_shards;
+};
+
+template<typename Cache>
+ShardedCache<Cache>::ShardedCache(size_t capacity, size_t shardCount)
+{
+    shardCount = std::max<size_t>(shardCount, 1);
+    if (capacity < shardCount) throw std::invalid_argument("ShardedCache capacity is less than shard count");
+
+    m_shards.reserve(shardCount);
+    for (size_t i = 0; i < shardCount; ++i)
+    {
+        m_shards.push_back(std::make_unique<Shard>(capacity / shardCount + (i < capacity % shardCount ? 1 : 0)));
+    }
+}
+
+template<typename Cache>
+auto ShardedCache<Cache>::get(const key_type& key) -> std::optional<mapped_type>
+{
+    auto& shard = shard_for(key);
+    std::lock_guard lock(shard.mutex);
+
+    if (const mapped_type* value = shard.cache.get(key))
+    {
+        return *value;
+    }
+    return std::nullopt;
+}
+
+template<typename Cache>
+void ShardedCache<Cache>::put(const key_type& key, mapped_type value)
+{
+    auto& shard = shard_for(key);
+    std::lock_guard lock(shard.mutex);
+
+    shard.cache.put(key, std::move(value));
+}
+
+template<typename Cache>
+bool ShardedCache<Cache>::erase(const key_type& key)
+{
+    auto& shard = shard_for(key);
+    std::lock_guard lock(shard.mutex);
+
+    return shard.cache.erase(key);
+}
+
+template<typename Cache>
+void ShardedCache<Cache>::clear()
+{
+    for (auto& shard : m_shards)
+    {
+        std::lock_guard lock(shard->mutex);
+        shard->cache.clear();
+    }
+}
+
+template<typename Cache>
+size_t ShardedCache<Cache>::size() const
+{
+    size_t result = 0;
+    for (const auto& shard : m_shards)
+    {
+        std::lock_guard lock(shard->mutex);
+        result += shard->cache.size();
+    }
+    return result;
+}
+
+template<typename Cache>
+CacheStats ShardedCache<Cache>::stats() const
+{
+    CacheStats result;
+    for (const auto& shard : m_shards)
+    {
+        std::lock_guard lock(shard->mutex);
+        result += shard->cache.stats();
+    }
+    return result;
+}
+
+} // namespace AlgoStruct
@@ -0,0 +1,122 @@
+#include "LfuCache.hpp"
+#include "LruCache.hpp"
+#include "ShardedCache.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace AlgoStruct;
+
+namespace
+{
+    constexpr size_t KeyCount = 1'000'000;
+    constexpr size_t TraceLength = 1 << 20;
+
+    // Key trace with Zipfian popularity: P(rank k) ~ 1 / k^s, keys are shuffled ranks
+    std::vector<uint64_t> make_zipf_trace(size_t keyCount, size_t length, double s)
+    {
+        std::vector<double> cdf(keyCount);
+        double sum = 0.0;
+        for (size_t k = 0; k < keyCount; ++k)
+        {
+            sum += 1.0 / std::pow(static_cast<double>(k + 1), s);
+            cdf[k] = sum;
+        }
+
+        std::vector<uint64_t> keys(keyCount);
+        std::mt19937_64 gen(42);
+        for (size_t k = 0; k < keyCount; ++k)
+        {
+            keys[k] = gen();
+        }
+
+        std::uniform_real_distribution<double> dist(0.0, sum);
+        std::vector<uint64_t> trace(length);
+        for (auto& key : trace)
+        {
+            const auto rank = std::lower_bound(cdf.begin(), cdf.end(), dist(gen)) - cdf.begin();
+            key = keys[static_cast<size_t>(rank)];
+        }
+
+        return trace;
+    }
+
+    const std::vector<uint64_t>& zipf_trace()
+    {
+        static const auto trace = make_zipf_trace(KeyCount, TraceLength, 0.99);
+        return trace;
+    }
+}
+
+// Read-through replay: a miss loads the value into the cache. Arg is capacity
+template<typename Cache>
+static void BM_ZipfReplay(benchmark::State& state)
+{
+    const auto& trace = zipf_trace();
+    Cache cache(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        for (const auto key : trace)
+        {
+            if (auto* value = cache.get(key))
+            {
+                benchmark::DoNotOptimize(*value);
+            }
+            else
+            {
+                cache.put(key, key);
+            }
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * trace.size());
+    state.counters["hit_ratio"] = cache.stats().hit_ratio();
+}
+BENCHMARK_TEMPLATE(BM_ZipfReplay, LruCache<uint64_t, uint64_t>)->Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 17)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ZipfReplay, LfuCache<uint64_t, uint64_t>)->Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 17)->Unit(benchmark::kMillisecond);
+
+// Threads replay parts of the trace against the shared cache
+template<typename Cache>
+static void BM_ShardedZipfReplay(benchmark::State& state)
+{
+    const auto& trace = zipf_trace();
+    static ShardedCache<Cache>* cache = nullptr;
+    if (state.thread_index() == 0)
+    {
+        cache = new ShardedCache<Cache>(1 << 14, 16);
+    }
+
+    const size_t chunk = trace.size() / static_cast<size_t>(state.threads());
+    const size_t first = chunk * static_cast<size_t>(state.thread_index());
+
+    for (auto _ : state)
+    {
+        for (size_t i = first; i < first + chunk; ++i)
+        {
+            if (const auto value = cache->get(trace[i]))
+            {
+                benchmark::DoNotOptimize(*value);
+            }
+            else
+            {
+                cache->put(trace[i], trace[i]);
+            }
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * chunk);
+    if (state.thread_index() == 0)
+    {
+        state.counters["hit_ratio"] = cache->stats().hit_ratio();
+        delete cache;
+        cache = nullptr;
+    }
+}
+BENCHMARK_TEMPLATE(BM_ShardedZipfReplay, LruCache<uint64_t, uint64_t>)->ThreadRange(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ShardedZipfReplay, LfuCache<uint64_t, uint64_t>)->ThreadRange(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
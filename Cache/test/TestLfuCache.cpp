@@ -0,0 +1,117 @@
+#include "LfuCache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+TEST(TestLfuCache, ShouldGetPutValues)
+{
+    LfuCache<int, std::string> sut(2);
+    ASSERT_EQ(nullptr, sut.get(1));
+
+    sut.put(1, "one");
+    sut.put(2, "two");
+
+    ASSERT_EQ("one", *sut.get(1));
+    ASSERT_EQ("two", *sut.get(2));
+    ASSERT_EQ(2, sut.size());
+
+    ASSERT_THROW((LfuCache<int, int>(0)), std::invalid_argument);
+}
+
+TEST(TestLfuCache, ShouldEvictLeastFrequentlyUsed)
+{
+    LfuCache<int, int> sut(3);
+    sut.put(1, 10);
+    sut.put(2, 20);
+    sut.put(3, 30);
+
+    sut.get(1);
+    sut.get(1);
+    sut.get(3);
+    ASSERT_EQ(3, sut.frequency(1));
+    ASSERT_EQ(1, sut.frequency(2));
+    ASSERT_EQ(2, sut.frequency(3));
+
+    sut.put(4, 40);
+    ASSERT_FALSE(sut.contains(2));
+    ASSERT_EQ(0, sut.frequency(2));
+
+    // New entry has the lowest count and becomes the next victim
+    sut.put(5, 50);
+    ASSERT_FALSE(sut.contains(4));
+    ASSERT_TRUE(sut.contains(1));
+    ASSERT_TRUE(sut.contains(3));
+    ASSERT_EQ(2, sut.stats().evictions);
+}
+
+TEST(TestLfuCache, ShouldReuseEvictedEntry)
+{
+    LfuCache<int, std::string> sut(2);
+    sut.put(1, "one");
+    sut.put(2, "two");
+    sut.get(2);
+    const std::string* evicted = sut.get(1);
+
+    // Victim with count 2 is relinked to the bucket of count 1 with the new key
+    sut.get(2);
+    sut.put(3, "three");
+    ASSERT_FALSE(sut.contains(1));
+    ASSERT_EQ(evicted, sut.get(3));
+    ASSERT_EQ("three", *evicted);
+    ASSERT_EQ(2, sut.frequency(3));
+    ASSERT_EQ(3, sut.frequency(2));
+
+    // Same node again: 3 is evicted with count 2, then 4 from the bucket of count 1
+    sut.put(4, "four");
+    ASSERT_EQ("four", *evicted);
+    sut.put(5, "five");
+    ASSERT_EQ("five", *evicted);
+    ASSERT_FALSE(sut.contains(4));
+    ASSERT_EQ(1, sut.frequency(5));
+    ASSERT_EQ(3, sut.frequency(2));
+    ASSERT_EQ(3, sut.stats().evictions);
+}
+
+TEST(TestLfuCache, ShouldBreakTiesByRecency)
+{
+    LfuCache<int, int> sut(3);
+    sut.put(1, 1);
+    sut.put(2, 2);
+    sut.put(3, 3);
+
+    sut.get(2);
+    sut.get(1);
+    sut.get(3);
+
+    // All have count 2: the least recently used one (2) is evicted
+    sut.put(4, 4);
+    ASSERT_FALSE(sut.contains(2));
+    ASSERT_EQ(3, sut.size());
+}
+
+TEST(TestLfuCache, ShouldEraseAndClear)
+{
+    LfuCache<std::string, int> sut(2);
+    sut.put("a", 1);
+    sut.put("b", 2);
+    sut.get("a");
+
+    ASSERT_TRUE(sut.erase("a"));
+    ASSERT_FALSE(sut.erase("a"));
+    ASSERT_EQ(1, sut.size());
+
+    // Update counts as use
+    sut.put("b", 3);
+    ASSERT_EQ(2, sut.frequency("b"));
+    ASSERT_EQ(3, *sut.get("b"));
+
+    sut.clear();
+    ASSERT_EQ(0, sut.size());
+    ASSERT_FALSE(sut.contains("b"));
+    sut.put("c", 4);
+    ASSERT_EQ(1, sut.frequency("c"));
+}
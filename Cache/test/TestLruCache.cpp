@@ -0,0 +1,93 @@
+#include "LruCache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+TEST(TestLruCache, ShouldGetPutValues)
+{
+    LruCache<int, std::string> sut(2);
+    ASSERT_EQ(nullptr, sut.get(1));
+
+    sut.put(1, "one");
+    sut.put(2, "two");
+
+    ASSERT_EQ(2, sut.size());
+    ASSERT_EQ(2, sut.capacity());
+    ASSERT_EQ("one", *sut.get(1));
+    ASSERT_EQ("two", *sut.get(2));
+
+    sut.put(1, "uno");
+    ASSERT_EQ("uno", *sut.get(1));
+    ASSERT_EQ(2, sut.size());
+
+    ASSERT_THROW((LruCache<int, int>(0)), std::invalid_argument);
+}
+
+TEST(TestLruCache, ShouldEvictLeastRecentlyUsed)
+{
+    LruCache<int, int> sut(3);
+    sut.put(1, 10);
+    sut.put(2, 20);
+    sut.put(3, 30);
+
+    // 1 becomes the most recent, 2 is the victim
+    sut.get(1);
+    sut.put(4, 40);
+
+    ASSERT_FALSE(sut.contains(2));
+    ASSERT_TRUE(sut.contains(1));
+    ASSERT_TRUE(sut.contains(3));
+    ASSERT_TRUE(sut.contains(4));
+
+    // Update also counts as use: 3 is the victim now
+    sut.put(1, 11);
+    sut.put(5, 50);
+    ASSERT_FALSE(sut.contains(3));
+    ASSERT_EQ(11, *sut.get(1));
+    ASSERT_EQ(3, sut.size());
+}
+
+TEST(TestLruCache, ShouldCountHitsMissesAndEvictions)
+{
+    LruCache<int, int> sut(2);
+    sut.put(1, 1);
+    sut.put(2, 2);
+    sut.get(1);
+    sut.get(3);
+    sut.put(3, 3);
+    sut.put(4, 4);
+
+    const auto& stats = sut.stats();
+    ASSERT_EQ(1, stats.hits);
+    ASSERT_EQ(1, stats.misses);
+    ASSERT_EQ(2, stats.evictions);
+    ASSERT_DOUBLE_EQ(0.5, stats.hit_ratio());
+
+    sut.reset_stats();
+    ASSERT_EQ(0, sut.stats().evictions);
+}
+
+TEST(TestLruCache, ShouldEraseAndClear)
+{
+    LruCache<std::string, std::unique_ptr<int>> sut(2);
+    sut.put("a", std::make_unique<int>(1));
+    sut.put("b", std::make_unique<int>(2));
+
+    ASSERT_TRUE(sut.erase("a"));
+    ASSERT_FALSE(sut.erase("a"));
+    ASSERT_EQ(1, sut.size());
+
+    sut.put("c", std::make_unique<int>(3));
+    sut.put("d", std::make_unique<int>(4));
+    ASSERT_FALSE(sut.contains("b"));
+    ASSERT_EQ(4, **sut.get("d"));
+
+    sut.clear();
+    ASSERT_EQ(0, sut.size());
+    ASSERT_EQ(nullptr, sut.get("c"));
+}
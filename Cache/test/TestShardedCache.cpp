@@ -0,0 +1,70 @@
+#include "LfuCache.hpp"
+#include "LruCache.hpp"
+#include "ShardedCache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+TEST(TestShardedCache, ShouldSplitCapacityBetweenShards)
+{
+    ShardedCache<LruCache<int, std::string>> sut(10, 4);
+    ASSERT_EQ(4, sut.shard_count());
+
+    for (int i = 0; i < 100; ++i)
+    {
+        sut.put(i, std::to_string(i));
+    }
+
+    ASSERT_EQ(10, sut.size());
+    ASSERT_EQ(90, sut.stats().evictions);
+    ASSERT_EQ("99", sut.get(99));
+    ASSERT_FALSE(sut.get(0).has_value());
+
+    ASSERT_TRUE(sut.erase(99));
+    ASSERT_EQ(9, sut.size());
+    sut.clear();
+    ASSERT_EQ(0, sut.size());
+
+    ASSERT_THROW((ShardedCache<LruCache<int, int>>(2, 4)), std::invalid_argument);
+}
+
+TEST(TestShardedCache, ShouldServeConcurrentThreads)
+{
+    constexpr int threadCount = 4;
+    constexpr int keyCount = 1000;
+    ShardedCache<LfuCache<int, int>> sut(keyCount, 8);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&sut]
+        {
+            for (int i = 0; i < keyCount; ++i)
+            {
+                if (const auto value = sut.get(i))
+                {
+                    ASSERT_EQ(i * 2, *value);
+                }
+                else
+                {
+                    sut.put(i, i * 2);
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto stats = sut.stats();
+    ASSERT_EQ(static_cast<size_t>(threadCount * keyCount), stats.hits + stats.misses);
+    ASSERT_LE(sut.size(), static_cast<size_t>(keyCount));
+}
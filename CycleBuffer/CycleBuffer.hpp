@@ -30,7 +30,7 @@ public:
         Iterator(const Iterator& other) = default;
         Iterator& operator= (const Iterator& other) = default;
         ~Iterator() = default;
-        T& operator* () { return *m_elemPtr; }
+        T& operator* () const { return *m_elemPtr; }
 
         Iterator& operator++ ()     // prefix increment: ++it;
         {
@@ -46,7 +46,7 @@ public:
         }
 
         // Operations needed for InputIterator
-        T* operator-> () { return m_elemPtr; }
+        T* operator-> () const { return m_elemPtr; }
         friend bool operator== (const Iterator& lhs, const Iterator& rhs) 
         { 
             return lhs.m_container == rhs.m_container && lhs.m_elemPtr == rhs.m_elemPtr; 
@@ -0,0 +1,530 @@
+#pragma once
+
+#include "EpochReclamation.hpp"
+#include "SkipList.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <utility>
+
+namespace AlgoStruct
+{
+// Lock-free ordered map on a skip list (Herlihy, Lev, Luchangco, Shavit).
+//
+//   level 1: head ----------> [3] ------------------> [7] ---> nullptr
+//   level 0: head --> [1] --> [3] --> [5]x --> [6] --> [7] ---> nullptr
+//                                      ^
+//                                      '-- links marked: erased, not unlinked yet
+//
+// A node is in the map if it is linked on level 0 and its level 0 link is not marked. insert()
+// links a node bottom-up with CAS, level 0 CAS is the linearization point. erase() marks links
+// of the node top-down (low bit of the pointer), marking level 0 link erases it. Marked nodes
+// are unlinked by any thread which passes them during search. Upper levels are only a hint for
+// search, so the order of concurrent linking and unlinking on them does not matter.
+//
+// Erased nodes are unlinked from all levels and retired to EpochDomain, which frees them once
+// no pinned thread can reach them. Operations pin the calling thread themselves, but returned
+// iterators and references stay valid only while the thread holds a guard taken before:
+//
+//   const auto guard = list.pin();
+//   const auto it = list.find(key);     // valid until the guard is destroyed
+//
+// Values are immutable after insertion. Iteration is weakly consistent: it sees elements
+// present for the whole iteration and may or may not see concurrently inserted or erased ones.
+template<typename Key, typename Value, typename Compare = std::less<Key>>
+class ConcurrentSkipList
+{
+public:
+    static constexpr size_t MaxLevel = 32;
+
+private:
+    using Link = std::atomic<uintptr_t>;
+
+    struct Node
+    {
+        template<typename... Args>
+        explicit Node(size_t lvl, Args&&... args)
+            : value(std::forward<Args>(args)...)
+            , level(static_cast<uint8_t>(lvl))
+        {}
+
+        const std::pair<const Key, Value> value;
+        uint8_t level;
+        // Linked and Erased flags: the thread which sets the last of them retires the node
+        std::atomic<uint8_t> state{0};
+    };
+
+    static constexpr uint8_t Linked = 1;
+    static constexpr uint8_t Erased = 2;
+
+    static constexpr size_t NodeAlignment = std::max(alignof(Node), alignof(Link));
+    static constexpr size_t TowerOffset = (sizeof(Node) + alignof(Link) - 1) / alignof(Link) * alignof(Link);
+
+    static Link* links(Node* node) noexcept
+    {
+        return std::launder(reinterpret_cast<Link*>(reinterpret_cast<unsigned char*>(node) + TowerOffset));
+    }
+
+    static Node* node_of(uintptr_t link) noexcept { return reinterpret_cast<Node*>(link & ~uintptr_t(1)); }
+    static bool is_marked(uintptr_t link) noexcept { return link & 1; }
+    static uintptr_t make_link(Node* node, bool marked = false) noexcept { return reinterpret_cast<uintptr_t>(node) | uintptr_t(marked); }
+
+    // Next node on level 0, which is not erased
+    static Node* next_present(Node* node) noexcept
+    {
+        while (node && is_marked(links(node)[0].load(std::memory_order_acquire)))
+        {
+            node = node_of(links(node)[0].load(std::memory_order_acquire));
+        }
+        return node;
+    }
+
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const Key, Value>;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        explicit Iterator(Node* node): m_node(node) {}
+
+        reference operator* () const { return m_node->value; }
+        pointer operator-> () const { return &m_node->value; }
+
+        Iterator& operator++ ()
+        {
+            m_node = next_present(node_of(links(m_node)[0].load(std::memory_order_acquire)));
+            return *this;
+        }
+        Iterator operator++ (int)
+        {
+            Iterator ret = *this;
+            ++(*this);
+            return ret;
+        }
+
+        friend bool operator== (const Iterator& lhs, const Iterator& rhs) { return lhs.m_node == rhs.m_node; }
+        friend bool operator!= (const Iterator& lhs, const Iterator& rhs) { return lhs.m_node != rhs.m_node; }
+
+    private:
+        Node* m_node = nullptr;
+    };
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+    using key_compare = Compare;
+    using size_type = size_t;
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+
+    ConcurrentSkipList() = default;
+    explicit ConcurrentSkipList(const Compare& compare): m_compare(compare) {}
+    ~ConcurrentSkipList();
+
+    ConcurrentSkipList(const ConcurrentSkipList&) = delete;
+    ConcurrentSkipList& operator= (const ConcurrentSkipList&) = delete;
+
+    // Keeps erased nodes of all lists from being freed while alive, see above
+    [[nodiscard]] EpochDomain::Guard pin() const { return EpochDomain::global().pin(); }
+
+    // Inserts value if its key is not present. Returns element with the key and insertion flag
+    std::pair<iterator, bool> insert(const value_type& value) { return try_emplace(value.first, value.second); }
+    std::pair<iterator, bool> insert(value_type&& value) { return try_emplace(value.first, std::move(value.second)); }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+
+    // Returns number of erased elements (0 or 1)
+    size_t erase(const Key& key);
+
+    iterator find(const Key& key) const;
+    bool contains(const Key& key) const { return find(key) != end(); }
+    iterator lower_bound(const Key& key) const;
+
+    iterator begin() const;
+    iterator end() const noexcept { return iterator(); }
+
+    // Snapshot, may be outdated immediately in concurrent use
+    size_t size() const noexcept { return m_size.load(std::memory_order_relaxed); }
+    bool empty() const noexcept { return size() == 0; }
+
+private:
+    template<typename... Args>
+    static Node* create_node(size_t level, Args&&... args);
+    static void destroy_node(Node* node) noexcept;
+
+    // Fills links preceding key and nodes following them on each used level, unlinks erased
+    // nodes on the way. Returns true if the key is present
+    bool find_window(const Key& key, Link* preds[], Node* succs[]);
+    Node* lower_bound_node(const Key& key) const;
+
+    // Links inserted node on the levels above 0, stops if it is erased concurrently
+    void link_upper_levels(Node* node, Link* preds[], Node* succs[]);
+    // Sets flag on node, unlinks and retires it if the other flag is set already
+    void release(Node* node, uint8_t flag);
+    // Unlinks erased node from all levels, nodes with equal keys may precede it
+    void unlink(Node* node);
+
+    void raise_level(size_t level) noexcept;
+
+private:
+    Link m_head[MaxLevel] = {};
+    std::atomic<size_t> m_level{1};         // Grows only, levels above are empty
+    std::atomic<size_t> m_size{0};
+    [[no_unique_address]] Compare m_compare;
+};
+
+template<typename Key, typename Value, typename Compare>
+ConcurrentSkipList<Key, Value, Compare>::~ConcurrentSkipList()
+{
+    // No concurrent access during destruction. Erased nodes are unlinked and belong to the
+    // epoch domain
+    Node* node = node_of(m_head[0].load(std::memory_order_acquire));
+    while (node)
+    {
+        Node* next = node_of(links(node)[0].load(std::memory_order_relaxed));
+        destroy_node(node);
+        node = next;
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename... Args>
+auto ConcurrentSkipList<Key, Value, Compare>::try_emplace(const Key& key, Args&&... args) -> std::pair<iterator, bool>
+{
+    const auto guard = pin();
+    const size_t level = detail::random_skip_list_level<MaxLevel>();
+    raise_level(level);
+
+    Link* preds[MaxLevel];
+    Node* succs[MaxLevel];
+    Node* node = nullptr;
+
+    while (true)
+    {
+        if (find_window(key, preds, succs))
+        {
+            if (node) destroy_node(node);
+            return {iterator(succs[0]), false};
+        }
+
+        if (!node)
+        {
+            node = create_node(level, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+
+        Link* next = links(node);
+        for (size_t i = 0; i < level; ++i)
+        {
+            next[i].store(make_link(succs[i]), std::memory_order_relaxed);
+        }
+
+        uintptr_t expected = make_link(succs[0]);
+        if (preds[0]->compare_exchange_strong(expected, make_link(node), std::memory_order_release, std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+
+    m_size.fetch_add(1, std::memory_order_relaxed);
+
+    // Node is in the map now, upper levels only speed up search
+    link_upper_levels(node, preds, succs);
+    release(node, Linked);
+
+    return {iterator(node), true};
+}
+
+template<typename Key, typename Value, typename Compare>
+void ConcurrentSkipList<Key, Value, Compare>::link_upper_levels(Node* node, Link* preds[], Node* succs[])
+{
+    Link* next = links(node);
+    for (size_t i = 1; i < node->level; ++i)
+    {
+        while (true)
+        {
+            uintptr_t link = next[i].load(std::memory_order_acquire);
+            if (is_marked(link))
+            {
+                // Erased concurrently: stop linking
+                return;
+            }
+
+            if (node_of(link) != succs[i] &&
+                !next[i].compare_exchange_strong(link, make_link(succs[i]), std::memory_order_release, std::memory_order_relaxed))
+            {
+                continue;
+            }
+
+            uintptr_t expected = make_link(succs[i]);
+            if (preds[i]->compare_exchange_strong(expected, make_link(node), std::memory_order_release, std::memory_order_relaxed))
+            {
+                break;
+            }
+
+            // Window changed: search again, the node is gone if it is not found on level 0
+            find_window(node->value.first, preds, succs);
+            if (succs[0] != node)
+            {
+                return;
+            }
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+size_t ConcurrentSkipList<Key, Value, Compare>::erase(const Key& key)
+{
+    const auto guard = pin();
+    Link* preds[MaxLevel];
+    Node* succs[MaxLevel];
+    if (!find_window(key, preds, succs))
+    {
+        return 0;
+    }
+
+    Node* victim = succs[0];
+    Link* next = links(victim);
+
+    for (size_t i = victim->level; i-- > 1; )
+    {
+        uintptr_t link = next[i].load(std::memory_order_acquire);
+        while (!is_marked(link) &&
+               !next[i].compare_exchange_weak(link, link | 1, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+        }
+    }
+
+    // Only one thread marks level 0 link and owns the node
+    uintptr_t link = next[0].load(std::memory_order_acquire);
+    while (true)
+    {
+        if (is_marked(link))
+        {
+            return 0;
+        }
+
+        if (next[0].compare_exchange_weak(link, link | 1, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            break;
+        }
+    }
+
+    m_size.fetch_sub(1, std::memory_order_relaxed);
+
+    // Inserting thread may still link upper levels, then it retires the node
+    release(victim, Erased);
+    return 1;
+}
+
+template<typename Key, typename Value, typename Compare>
+void ConcurrentSkipList<Key, Value, Compare>::release(Node* node, uint8_t flag)
+{
+    if (node->state.fetch_or(flag, std::memory_order_acq_rel) != (Linked | Erased) - flag)
+    {
+        return;
+    }
+
+    // All levels are marked and no more links to the node appear
+    unlink(node);
+    EpochDomain::global().retire(node, [](void* ptr) { destroy_node(static_cast<Node*>(ptr)); });
+}
+
+template<typename Key, typename Value, typename Compare>
+void ConcurrentSkipList<Key, Value, Compare>::unlink(Node* node)
+{
+    const Key& key = node->value.first;
+
+    bool restart = true;
+    while (restart)
+    {
+        restart = false;
+
+        // Nodes with keys less than key precede the node on every level, equal ones may follow it
+        Link* start = m_head;
+        for (size_t level = node->level; level-- > 0 && !restart; )
+        {
+            Link* pred = start;
+            Node* curr = node_of(pred[level].load(std::memory_order_acquire));
+            while (curr)
+            {
+                const uintptr_t succ = links(curr)[level].load(std::memory_order_acquire);
+                if (is_marked(succ))
+                {
+                    uintptr_t expected = make_link(curr);
+                    if (!pred[level].compare_exchange_strong(expected, make_link(node_of(succ)), std::memory_order_acq_rel, std::memory_order_acquire))
+                    {
+                        restart = true;
+                        break;
+                    }
+                    curr = node_of(succ);
+                    continue;
+                }
+
+                if (m_compare(key, curr->value.first))
+                {
+                    break;
+                }
+
+                pred = links(curr);
+                if (m_compare(curr->value.first, key))
+                {
+                    start = pred;
+                }
+                curr = node_of(succ);
+            }
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+auto ConcurrentSkipList<Key, Value, Compare>::find(const Key& key) const -> iterator
+{
+    const auto guard = pin();
+    Node* node = lower_bound_node(key);
+    return (node && !m_compare(key, node->value.first)) ? iterator(node) : end();
+}
+
+template<typename Key, typename Value, typename Compare>
+auto ConcurrentSkipList<Key, Value, Compare>::lower_bound(const Key& key) const -> iterator
+{
+    const auto guard = pin();
+    return iterator(lower_bound_node(key));
+}
+
+template<typename Key, typename Value, typename Compare>
+auto ConcurrentSkipList<Key, Value, Compare>::begin() const -> iterator
+{
+    const auto guard = pin();
+    return iterator(next_present(node_of(m_head[0].load(std::memory_order_acquire))));
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename... Args>
+auto ConcurrentSkipList<Key, Value, Compare>::create_node(size_t level, Args&&... args) -> Node*
+{
+    void* memory = ::operator new(TowerOffset + level * sizeof(Link), std::align_val_t{NodeAlignment});
+
+    Node* node = nullptr;
+    try
+    {
+        node = new (memory) Node(level, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        ::operator delete(memory, std::align_val_t{NodeAlignment});
+        throw;
+    }
+
+    auto* tower = reinterpret_cast<Link*>(reinterpret_cast<unsigned char*>(node) + TowerOffset);
+    for (size_t i = 0; i < level; ++i)
+    {
+        new (&tower[i]) Link(0);
+    }
+    return node;
+}
+
+template<typename Key, typename Value, typename Compare>
+void ConcurrentSkipList<Key, Value, Compare>::destroy_node(Node* node) noexcept
+{
+    // Links are trivially destructible
+    node->~Node();
+    ::operator delete(node, std::align_val_t{NodeAlignment});
+}
+
+template<typename Key, typename Value, typename Compare>
+bool ConcurrentSkipList<Key, Value, Compare>::find_window(const Key& key, Link* preds[], Node* succs[])
+{
+    const size_t topLevel = m_level.load(std::memory_order_acquire);
+
+    bool restart = true;
+    while (restart)
+    {
+        restart = false;
+        Link* pred = m_head;
+        for (size_t level = topLevel; level-- > 0 && !restart; )
+        {
+            Node* curr = node_of(pred[level].load(std::memory_order_acquire));
+            while (curr)
+            {
+                uintptr_t succ = links(curr)[level].load(std::memory_order_acquire);
+                if (is_marked(succ))
+                {
+                    // Unlink erased node, start over if the predecessor has changed or is erased too
+                    uintptr_t expected = make_link(curr);
+                    if (!pred[level].compare_exchange_strong(expected, make_link(node_of(succ)), std::memory_order_acq_rel, std::memory_order_acquire))
+                    {
+                        restart = true;
+                        break;
+                    }
+                    curr = node_of(succ);
+                    continue;
+                }
+
+                if (!m_compare(curr->value.first, key))
+                {
+                    break;
+                }
+
+                pred = links(curr);
+                curr = node_of(succ);
+            }
+
+            preds[level] = &pred[level];
+            succs[level] = curr;
+        }
+    }
+
+    return succs[0] && !m_compare(key, succs[0]->value.first);
+}
+
+template<typename Key, typename Value, typename Compare>
+auto ConcurrentSkipList<Key, Value, Compare>::lower_bound_node(const Key& key) const -> Node*
+{
+    // Read-only search: erased nodes are skipped, not unlinked
+    const Link* pred = m_head;
+    Node* curr = nullptr;
+    for (size_t level = m_level.load(std::memory_order_acquire); level-- > 0; )
+    {
+        curr = node_of(pred[level].load(std::memory_order_acquire));
+        while (curr)
+        {
+            const uintptr_t succ = links(curr)[level].load(std::memory_order_acquire);
+            if (is_marked(succ))
+            {
+                curr = node_of(succ);
+                continue;
+            }
+
+            if (!m_compare(curr->value.first, key))
+            {
+                break;
+            }
+
+            pred = links(curr);
+            curr = node_of(succ);
+        }
+    }
+    return curr;
+}
+
+template<typename Key, typename Value, typename Compare>
+void ConcurrentSkipList<Key, Value, Compare>::raise_level(size_t level) noexcept
+{
+    size_t current = m_level.load(std::memory_order_relaxed);
+    while (current < level && !m_level.compare_exchange_weak(current, level, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+}
+
+} // namespace AlgoStruct
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <stdexcept>
+#include <utility>
 
 namespace AlgoStruct
 {
@@ -11,14 +13,19 @@ template <typename T>
 class DoublyLinkedList
 {
 private:
-    struct ListNode
+    // Links only: the dummy node is embedded into the list and has no value
+    struct NodeBase
     {
-        ListNode(T v = T{}, ListNode* n = nullptr, ListNode* p = nullptr)
-            : val(std::move(v)), next(n), prev(p) {}
+        NodeBase* next = nullptr;
+        NodeBase* prev = nullptr;
+    };
+
+    struct ListNode: NodeBase
+    {
+        template <typename... Args>
+        explicit ListNode(Args&&... args): val(std::forward<Args>(args)...) {}
 
         T val;
-        ListNode* next = nullptr;
-        ListNode* prev = nullptr;
     };
 
     struct Iterator
@@ -31,12 +38,12 @@ private:
         using difference_type = std::ptrdiff_t;
 
         Iterator() = default;
-        explicit Iterator(ListNode* node): m_node(node) {}
+        explicit Iterator(NodeBase* node): m_node(node) {}
         Iterator(const Iterator&) = default;
         Iterator& operator= (const Iterator&) = default;
 
-        reference operator* () const { return m_node->val; }
-        pointer operator-> () const { return m_node->val; }
+        reference operator* () const { return static_cast<ListNode*>(m_node)->val; }
+        pointer operator-> () const { return &static_cast<ListNode*>(m_node)->val; }
 
         Iterator& operator++ ()
         {
@@ -67,30 +74,37 @@ private:
 
     private:
         friend DoublyLinkedList<T>;
-        ListNode* m_node = nullptr;
+        NodeBase* m_node = nullptr;
     };
 
 public:
     using iterator = Iterator;
     using reverse_terator = std::reverse_iterator<iterator>;
+    using reverse_iterator = reverse_terator;
 
-    DoublyLinkedList(): m_beforeHead(new ListNode()) {}
+    // Construction and move never allocate
+    DoublyLinkedList() noexcept { reset(); }
     explicit DoublyLinkedList(std::initializer_list<T> init);
     ~DoublyLinkedList();
 
+    DoublyLinkedList(const DoublyLinkedList& other);
+    DoublyLinkedList& operator= (const DoublyLinkedList& other);
+    DoublyLinkedList(DoublyLinkedList&& other) noexcept;
+    DoublyLinkedList& operator= (DoublyLinkedList&& other) noexcept;
+
     // Element access
     T& front() const;
     T& back() const;
 
     // Iterators
-    iterator begin() const noexcept { return empty() ? end() : iterator(m_beforeHead->next); }
-    iterator end() const noexcept { return iterator(m_beforeHead); }
+    iterator begin() const noexcept { return iterator(m_beforeHead.next); }
+    iterator end() const noexcept { return iterator(before_head()); }
     reverse_terator rbegin() const noexcept { return reverse_terator(end()); }
     reverse_terator rend() const noexcept { return reverse_terator(begin()); }
 
     // Capacity
-    size_t size() const { return m_size; }
-    bool empty() const { return m_size == 0; }
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
 
     // Modifiers
     void clear();
@@ -98,20 +112,57 @@ public:
     void erase(iterator pos);                       // Removes the element at pos
 
     void push_back(const T& val) { insert(end(), val); }
-    void pop_back() { erase(iterator(m_beforeHead->prev)); }
+    void pop_back() { erase(iterator(m_beforeHead.prev)); }
     void push_front(const T& val) { insert(begin(), val); }
     void pop_front() { erase(begin()); }
 
+    // Constructs an element in place from args before pos
+    template <typename... Args>
+    iterator emplace(iterator pos, Args&&... args);
+    template <typename... Args>
+    T& emplace_back(Args&&... args) { return *emplace(end(), std::forward<Args>(args)...); }
+    template <typename... Args>
+    T& emplace_front(Args&&... args) { return *emplace(begin(), std::forward<Args>(args)...); }
+
     void swap(DoublyLinkedList& other) noexcept;
     void reverse();
-    // merge()
+
+    // Moves elements of other before pos by relinking nodes, nothing is allocated or copied.
+    // Whole list and single element: O(1), range of another list: O(range) to update sizes
+    void splice(iterator pos, DoublyLinkedList& other);
+    void splice(iterator pos, DoublyLinkedList& other, iterator it);
+    void splice(iterator pos, DoublyLinkedList& other, iterator first, iterator last);
+
+    // Merges sorted other into this sorted list, other becomes empty.
+    // Stable: equal elements of this list go first
+    void merge(DoublyLinkedList& other) { merge(other, std::less<T>{}); }
+    template <typename Compare>
+    void merge(DoublyLinkedList& other, Compare comp);
+
+    // Removes elements satisfying pred, returns number of removed elements
+    template <typename Predicate>
+    size_t remove_if(Predicate pred);
+
+    // Removes all but the first element of every group of consecutive equal elements
+    size_t unique() { return unique(std::equal_to<T>{}); }
+    template <typename BinaryPredicate>
+    size_t unique(BinaryPredicate pred);
     // sort()
 
 private:
+    // Moves nodes [first, last) before pos
+    static void transfer(NodeBase* pos, NodeBase* first, NodeBase* last) noexcept;
+
+    NodeBase* before_head() const noexcept { return const_cast<NodeBase*>(&m_beforeHead); }
+    // Makes the dummy node point to itself: empty list
+    void reset() noexcept { m_beforeHead.next = m_beforeHead.prev = &m_beforeHead; }
+    // Takes nodes of other, which becomes empty. This list must be empty
+    void steal(DoublyLinkedList& other) noexcept;
+
     /* 
-    Managing dummy node, making list cycled underhood:
-       m_beforeHead->next - head
-       m_beforeHead->prev - tail
+    Managing dummy node embedded into the list, making list cycled underhood:
+       m_beforeHead.next - head
+       m_beforeHead.prev - tail
     
                     [head]               [tail]
                        v                   v
@@ -119,7 +170,7 @@ private:
            ^________________________________^
 
     */
-    ListNode* m_beforeHead = nullptr;
+    NodeBase m_beforeHead;
     size_t m_size = 0;
 };
 
@@ -137,90 +188,113 @@ template <typename T>
 DoublyLinkedList<T>::~DoublyLinkedList()
 {
     clear();
-    delete(m_beforeHead);
+}
+
+template <typename T>
+DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList& other)
+    : DoublyLinkedList()
+{
+    for (const auto& elem : other)
+    {
+        push_back(elem);
+    }
+}
+
+template <typename T>
+DoublyLinkedList<T>& DoublyLinkedList<T>::operator= (const DoublyLinkedList& other)
+{
+    if (this != &other)
+    {
+        DoublyLinkedList tmp(other);
+        swap(tmp);
+    }
+
+    return *this;
+}
+
+template <typename T>
+DoublyLinkedList<T>::DoublyLinkedList(DoublyLinkedList&& other) noexcept
+    : DoublyLinkedList()
+{
+    steal(other);
+}
+
+template <typename T>
+DoublyLinkedList<T>& DoublyLinkedList<T>::operator= (DoublyLinkedList&& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        steal(other);
+    }
+
+    return *this;
+}
+
+template <typename T>
+void DoublyLinkedList<T>::steal(DoublyLinkedList& other) noexcept
+{
+    if (other.empty()) return;
+
+    // Boundary nodes of other are relinked to this dummy node
+    m_beforeHead = other.m_beforeHead;
+    m_beforeHead.next->prev = &m_beforeHead;
+    m_beforeHead.prev->next = &m_beforeHead;
+    m_size = other.m_size;
+
+    other.reset();
+    other.m_size = 0;
 }
 
 template <typename T>
 T& DoublyLinkedList<T>::front() const
 {
-    if (!m_beforeHead->next) throw std::invalid_argument("front() on empty DoublyLinkedList");
+    if (empty()) throw std::invalid_argument("front() on empty DoublyLinkedList");
 
-    return m_beforeHead->next->val;
+    return static_cast<ListNode*>(m_beforeHead.next)->val;
 }
 
 template <typename T>
 T& DoublyLinkedList<T>::back() const
 {
-    if (!m_beforeHead->prev) throw std::invalid_argument("back() on empty DoublyLinkedList");
+    if (empty()) throw std::invalid_argument("back() on empty DoublyLinkedList");
 
-    return m_beforeHead->prev->val;
+    return static_cast<ListNode*>(m_beforeHead.prev)->val;
 }
 
 template <typename T>
 void DoublyLinkedList<T>::clear()
 {
-    ListNode* nodeToDelete = nullptr;
-    ListNode* currNode = m_beforeHead->next;
+    NodeBase* currNode = m_beforeHead.next;
 
-    while (currNode && currNode != m_beforeHead)
+    while (currNode != &m_beforeHead)
     {
-        nodeToDelete = currNode;
+        NodeBase* nodeToDelete = currNode;
         currNode = currNode->next;
-        delete(nodeToDelete);
+        delete(static_cast<ListNode*>(nodeToDelete));
     }
 
-    m_beforeHead->next = nullptr;
-    m_beforeHead->prev = nullptr;
+    reset();
     m_size = 0;
 }
 
 template <typename T>
 auto DoublyLinkedList<T>::insert(iterator pos, const T& value) -> iterator
 {
-    auto newNode = new ListNode(value);
-
-    if (pos == end())
-    {
-        // Insertion to the tail
-        if (m_beforeHead->prev)
-        {
-            m_beforeHead->prev->next = newNode;
-            newNode->prev = m_beforeHead->prev;
-        }
-        else
-        {
-           m_beforeHead->next = newNode;
-           newNode->prev = m_beforeHead;
-        }
+    return emplace(pos, value);
+}
 
-        // Add [end marker]: cycle list for iterators equality checks
-        newNode->next = m_beforeHead;
-        m_beforeHead->prev = newNode;
-    }
-    else if (pos == begin())
-    {
-        // Insertion before head
-        newNode->next = m_beforeHead->next;
-        newNode->prev = m_beforeHead;
+template <typename T>
+template <typename... Args>
+auto DoublyLinkedList<T>::emplace(iterator pos, Args&&... args) -> iterator
+{
+    // Dummy node makes insertion to the head, tail and middle the same
+    auto newNode = new ListNode(std::forward<Args>(args)...);
 
-        if (m_beforeHead->next)
-        {
-            m_beforeHead->next->prev = newNode;
-        }
-        else
-        {
-            m_beforeHead->prev = newNode;
-        }
-        m_beforeHead->next = newNode;
-    }
-    else
-    {
-        // Insertion between other elements
-        newNode->prev = pos.m_node->prev;
-        newNode->next = pos.m_node;
-        pos.m_node->prev->next = newNode;
-        pos.m_node->prev = newNode;
-    }
+    newNode->prev = pos.m_node->prev;
+    newNode->next = pos.m_node;
+    pos.m_node->prev->next = newNode;
+    pos.m_node->prev = newNode;
 
     ++m_size;
     return iterator(newNode);
@@ -230,38 +304,23 @@ template <typename T>
 void DoublyLinkedList<T>::erase(iterator pos)
 {
     if (empty()) throw std::invalid_argument("erase() on empty DoublyLinkedList");
-    
-    ListNode* nodeToDelete = nullptr;
-    if (pos == this->begin())
-    {
-        nodeToDelete = m_beforeHead->next;
-        m_beforeHead->next = m_beforeHead->next->next;
-        m_beforeHead->next->prev = m_beforeHead;
-    }
-    else if (pos == iterator(m_beforeHead->prev))
-    {
-        nodeToDelete = m_beforeHead->prev;
-        m_beforeHead->prev = m_beforeHead->prev->prev;
-        m_beforeHead->prev->next = m_beforeHead;
-    }
-    else
-    {
-        nodeToDelete = pos.m_node;
-        pos.m_node->prev->next = pos.m_node->next;
-        pos.m_node->next->prev = pos.m_node->prev;
-    }
+    if (pos == end()) throw std::invalid_argument("erase() of end iterator");
+
+    NodeBase* nodeToDelete = pos.m_node;
+    nodeToDelete->prev->next = nodeToDelete->next;
+    nodeToDelete->next->prev = nodeToDelete->prev;
 
-    delete(nodeToDelete);
+    delete(static_cast<ListNode*>(nodeToDelete));
     --m_size;
 }
 
 template <typename T>
 void DoublyLinkedList<T>::reverse()
 {
-    ListNode* currNode = m_beforeHead->next;
-    ListNode* tmp = nullptr;
+    NodeBase* currNode = m_beforeHead.next;
+    NodeBase* tmp = nullptr;
 
-    while (currNode && currNode != m_beforeHead)
+    while (currNode != &m_beforeHead)
     {
         tmp = currNode->next;
         currNode->next = currNode->prev;
@@ -269,16 +328,155 @@ void DoublyLinkedList<T>::reverse()
         currNode = tmp;
     }
 
-    tmp = m_beforeHead->next;
-    m_beforeHead->next = m_beforeHead->prev;
-    m_beforeHead->prev = tmp;
+    tmp = m_beforeHead.next;
+    m_beforeHead.next = m_beforeHead.prev;
+    m_beforeHead.prev = tmp;
 }
 
 template <typename T>
 void DoublyLinkedList<T>::swap(DoublyLinkedList<T>& other) noexcept
 {
-    std::swap(m_beforeHead, other.m_beforeHead);
-    std::swap(m_size, other.m_size);
+    DoublyLinkedList tmp(std::move(other));
+    other.steal(*this);
+    steal(tmp);
+}
+
+template <typename T>
+void DoublyLinkedList<T>::transfer(NodeBase* pos, NodeBase* first, NodeBase* last) noexcept
+{
+    if (first == last || pos == last) return;
+
+    NodeBase* rangeTail = last->prev;
+
+    // Unlink [first, last)
+    first->prev->next = last;
+    last->prev = first->prev;
+
+    // Link before pos
+    first->prev = pos->prev;
+    rangeTail->next = pos;
+    pos->prev->next = first;
+    pos->prev = rangeTail;
+}
+
+template <typename T>
+void DoublyLinkedList<T>::splice(iterator pos, DoublyLinkedList<T>& other)
+{
+    if (&other == this || other.empty()) return;
+
+    transfer(pos.m_node, other.m_beforeHead.next, other.before_head());
+    m_size += other.m_size;
+    other.m_size = 0;
+}
+
+template <typename T>
+void DoublyLinkedList<T>::splice(iterator pos, DoublyLinkedList<T>& other, iterator it)
+{
+    if (pos == it || pos.m_node == it.m_node->next) return;
+
+    transfer(pos.m_node, it.m_node, it.m_node->next);
+    ++m_size;
+    --other.m_size;
+}
+
+template <typename T>
+void DoublyLinkedList<T>::splice(iterator pos, DoublyLinkedList<T>& other, iterator first, iterator last)
+{
+    if (first == last) return;
+
+    if (&other != this)
+    {
+        const auto count = static_cast<size_t>(std::distance(first, last));
+        m_size += count;
+        other.m_size -= count;
+    }
+
+    transfer(pos.m_node, first.m_node, last.m_node);
+}
+
+template <typename T>
+template <typename Compare>
+void DoublyLinkedList<T>::merge(DoublyLinkedList<T>& other, Compare comp)
+{
+    if (&other == this) return;
+
+    NodeBase* node = m_beforeHead.next;
+    NodeBase* otherNode = other.m_beforeHead.next;
+
+    while (node != &m_beforeHead && otherNode != &other.m_beforeHead)
+    {
+        if (comp(static_cast<ListNode*>(otherNode)->val, static_cast<ListNode*>(node)->val))
+        {
+            NodeBase* next = otherNode->next;
+            transfer(node, otherNode, next);
+            otherNode = next;
+        }
+        else
+        {
+            node = node->next;
+        }
+    }
+
+    transfer(&m_beforeHead, otherNode, &other.m_beforeHead);
+    m_size += other.m_size;
+    other.m_size = 0;
+}
+
+template <typename T>
+template <typename Predicate>
+size_t DoublyLinkedList<T>::remove_if(Predicate pred)
+{
+    size_t removed = 0;
+
+    for (NodeBase* node = m_beforeHead.next; node != &m_beforeHead; )
+    {
+        NodeBase* next = node->next;
+
+        if (pred(static_cast<ListNode*>(node)->val))
+        {
+            node->prev->next = next;
+            next->prev = node->prev;
+            delete(static_cast<ListNode*>(node));
+            ++removed;
+        }
+
+        node = next;
+    }
+
+    m_size -= removed;
+    return removed;
+}
+
+template <typename T>
+template <typename BinaryPredicate>
+size_t DoublyLinkedList<T>::unique(BinaryPredicate pred)
+{
+    if (empty()) return 0;
+
+    size_t removed = 0;
+    NodeBase* prev = m_beforeHead.next;
+
+    for (NodeBase* node = prev->next; node != &m_beforeHead; )
+    {
+        NodeBase* next = node->next;
+
+        if (pred(static_cast<ListNode*>(prev)->val, static_cast<ListNode*>(node)->val))
+        {
+            prev->next = next;
+            next->prev = prev;
+            delete(static_cast<ListNode*>(node));
+            ++removed;
+        }
+        else
+        {
+            prev = node;
+        }
+
+        node = next;
+    }
+
+    m_size -= removed;
+    return removed;
 }
 
 // External operations
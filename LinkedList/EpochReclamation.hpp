@@ -0,0 +1,267 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace AlgoStruct
+{
+// Epoch based reclamation: safe memory reclamation for lock-free containers, where a traversal
+// holds too many nodes at once to publish each of them in a hazard pointer (skip lists).
+//
+// A thread pins the global epoch for the time it works with shared nodes. Removed nodes are
+// retired with the epoch of removal. The epoch advances only when every pinned thread has
+// seen the current one, so two advances after a node was retired no thread pinned before its
+// removal is still pinned, and the node can be freed.
+//
+//   epoch:     e              e + 1              e + 2
+//   thread A:  [pinned, reads node] ... unpin
+//   thread B:     unlinks node, retires in e              frees node
+//
+// A thread pinned for long delays reclamation of all nodes, it never makes memory unsafe.
+class EpochDomain
+{
+public:
+    // Keeps calling thread pinned while alive, guards of one thread may nest
+    class Guard
+    {
+    public:
+        explicit Guard(EpochDomain& domain): m_domain(domain) { m_domain.enter(); }
+        ~Guard() { m_domain.leave(); }
+
+        Guard(const Guard&) = delete;
+        Guard& operator= (const Guard&) = delete;
+
+    private:
+        EpochDomain& m_domain;
+    };
+
+    // The only domain, shared by all containers
+    static EpochDomain& global()
+    {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator= (const EpochDomain&) = delete;
+    ~EpochDomain();
+
+    [[nodiscard]] Guard pin() { return Guard(*this); }
+
+    // Frees ptr with deleter once no thread pinned before the call is pinned anymore
+    void retire(void* ptr, void (*deleter)(void*));
+
+    // Frees retired nodes of calling thread, which no pinned thread can reach
+    void reclaim();
+
+private:
+    // Pinned epoch * 2 + 1, 0 if the thread is not pinned
+    struct Record
+    {
+        std::atomic<size_t> epoch{0};
+        std::atomic<bool> active{false};
+        Record* next = nullptr;
+    };
+
+    struct Retired
+    {
+        void* ptr;
+        void (*deleter)(void*);
+        size_t epoch;
+    };
+
+    // Record and retired nodes of a thread
+    struct ThreadState
+    {
+        explicit ThreadState(EpochDomain& domain);
+        ~ThreadState();
+
+        EpochDomain& domain;
+        Record* record;
+        size_t pins = 0;
+        size_t collectAt = 0;
+        std::vector<Retired> retired;
+    };
+
+    // Retired nodes of a thread between scans
+    static constexpr size_t CollectBatch = 64;
+
+    EpochDomain() = default;
+
+    static ThreadState& local()
+    {
+        thread_local ThreadState state(global());
+        return state;
+    }
+
+    void enter();
+    void leave() noexcept;
+
+    Record* acquire_record();
+    // Returns the global epoch after an attempt to advance it
+    size_t try_advance() noexcept;
+    void collect(std::vector<Retired>& retired, size_t epoch);
+
+private:
+    std::atomic<size_t> m_epoch{0};
+    std::atomic<Record*> m_records{nullptr};
+
+    // Retired nodes left by finished threads
+    std::mutex m_orphansMutex;
+    std::vector<Retired> m_orphans;
+};
+
+inline EpochDomain::ThreadState::ThreadState(EpochDomain& d)
+    : domain(d)
+    , record(d.acquire_record())
+{}
+
+inline EpochDomain::ThreadState::~ThreadState()
+{
+    record->epoch.store(0, std::memory_order_release);
+
+    domain.collect(retired, domain.try_advance());
+    if (!retired.empty())
+    {
+        std::lock_guard lock(domain.m_orphansMutex);
+        domain.m_orphans.insert(domain.m_orphans.end(), retired.begin(), retired.end());
+    }
+
+    record->active.store(false, std::memory_order_release);
+}
+
+inline EpochDomain::~EpochDomain()
+{
+    // All threads are finished: nothing is pinned anymore
+    for (const auto& node : m_orphans)
+    {
+        node.deleter(node.ptr);
+    }
+
+    Record* record = m_records.load(std::memory_order_acquire);
+    while (record)
+    {
+        Record* next = record->next;
+        delete record;
+        record = next;
+    }
+}
+
+inline void EpochDomain::enter()
+{
+    auto& state = local();
+    if (state.pins++ == 0)
+    {
+        // Pinned epoch may be behind the global one: it only holds reclamation back longer.
+        // Exchange continues the release sequence of the last unpin, so a thread which reads
+        // the new epoch sees all accesses made while pinned before
+        state.record->epoch.exchange(m_epoch.load(std::memory_order_relaxed) * 2 + 1, std::memory_order_seq_cst);
+    }
+}
+
+inline void EpochDomain::leave() noexcept
+{
+    auto& state = local();
+    if (--state.pins == 0)
+    {
+        state.record->epoch.store(0, std::memory_order_release);
+    }
+}
+
+inline void EpochDomain::retire(void* ptr, void (*deleter)(void*))
+{
+    auto& state = local();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    state.retired.push_back({ptr, deleter, m_epoch.load(std::memory_order_relaxed)});
+
+    // Nodes still reachable stay for the next batch, the scan cost is amortized over it
+    if (state.retired.size() >= state.collectAt)
+    {
+        collect(state.retired, try_advance());
+        state.collectAt = state.retired.size() + CollectBatch;
+    }
+}
+
+inline void EpochDomain::reclaim()
+{
+    // Nodes retired in the current epoch are freed after two advances
+    try_advance();
+    auto& state = local();
+    collect(state.retired, try_advance());
+    state.collectAt = state.retired.size() + CollectBatch;
+}
+
+inline auto EpochDomain::acquire_record() -> Record*
+{
+    // Reuse a record of a finished thread
+    for (Record* record = m_records.load(std::memory_order_acquire); record; record = record->next)
+    {
+        bool expected = false;
+        if (!record->active.load(std::memory_order_relaxed) &&
+            record->active.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        {
+            return record;
+        }
+    }
+
+    auto* record = new Record;
+    record->active.store(true, std::memory_order_relaxed);
+
+    record->next = m_records.load(std::memory_order_relaxed);
+    while (!m_records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+
+    return record;
+}
+
+inline size_t EpochDomain::try_advance() noexcept
+{
+    size_t epoch = m_epoch.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    for (Record* record = m_records.load(std::memory_order_acquire); record; record = record->next)
+    {
+        const size_t pinned = record->epoch.load(std::memory_order_acquire);
+        if (pinned != 0 && pinned / 2 != epoch)
+        {
+            return epoch;
+        }
+    }
+
+    // Fails if another thread has advanced the epoch: the new one is returned
+    if (m_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_release, std::memory_order_relaxed))
+    {
+        return epoch + 1;
+    }
+    return epoch;
+}
+
+inline void EpochDomain::collect(std::vector<Retired>& retired, size_t epoch)
+{
+    {
+        std::unique_lock lock(m_orphansMutex, std::try_to_lock);
+        if (lock && !m_orphans.empty())
+        {
+            retired.insert(retired.end(), m_orphans.begin(), m_orphans.end());
+            m_orphans.clear();
+        }
+    }
+
+    // Nodes retired in the last two epochs may be still reachable
+    const auto reachableEnd = std::partition(retired.begin(), retired.end(), [epoch](const Retired& node)
+    {
+        return node.epoch + 2 > epoch;
+    });
+
+    for (auto it = reachableEnd; it != retired.end(); ++it)
+    {
+        it->deleter(it->ptr);
+    }
+    retired.erase(reachableEnd, retired.end());
+}
+
+} // namespace AlgoStruct
@@ -1,8 +1,16 @@
 #pragma once
 
+#include "NodePool.hpp"
+
+#include <algorithm>
 #include <iterator>
 #include <cstddef>
+#include <functional>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <initializer_list>
 
@@ -13,7 +21,10 @@ namespace AlgoStruct
     {
         struct Node
         {
-            Node(T v, Node* n = nullptr): value(v), next(n) {}
+            // Value is constructed in place from args
+            template <typename... Args>
+            explicit Node(Node* n, Args&&... args): value(std::forward<Args>(args)...), next(n) {}
+
             T value;
             Node* next = nullptr;
         };
@@ -30,6 +41,7 @@ namespace AlgoStruct
 
             Iterator() = default;
             explicit Iterator(Node* node): m_node(node) {}
+            Iterator(const Iterator& other) = default;
 
             Iterator& operator= (const Iterator& rhs)
             {
@@ -38,7 +50,7 @@ namespace AlgoStruct
             }
 
             reference operator* () const { return m_node->value; }
-            pointer operator-> () const { return m_node->value; }
+            pointer operator-> () const { return &m_node->value; }
 
             Iterator& operator++ ()
             {
@@ -87,6 +99,11 @@ namespace AlgoStruct
         ForwardList(std::initializer_list<T> il);
         ~ForwardList();
 
+        ForwardList(const ForwardList& other);
+        ForwardList& operator= (const ForwardList& other);
+        ForwardList(ForwardList&& other) noexcept;
+        ForwardList& operator= (ForwardList&& other) noexcept;
+
         // Iterators getters
         Iterator begin() const noexcept;
         Iterator end() const noexcept;
@@ -96,8 +113,16 @@ namespace AlgoStruct
         size_t size() const noexcept;
 
         // Inserts an element to the list
-        void push_front(const T& value);
-        void push_back(const T& value);
+        void push_front(const T& value) { emplace_front(value); }
+        void push_front(T&& value) { emplace_front(std::move(value)); }
+        void push_back(const T& value) { emplace_back(value); }
+        void push_back(T&& value) { emplace_back(std::move(value)); }
+
+        // Constructs an element in place from args
+        template <typename... Args>
+        T& emplace_front(Args&&... args);
+        template <typename... Args>
+        T& emplace_back(Args&&... args);
 
         // Removes a head element from the list
         void pop_front();
@@ -111,7 +136,13 @@ namespace AlgoStruct
         const T& back() const;
 
         // Inserts elements after an desired place
-        void insert_after(Iterator& it, const T& value);
+        void insert_after(Iterator& it, const T& value) { emplace_after(it, value); }
+        void insert_after(Iterator& it, T&& value) { emplace_after(it, std::move(value)); }
+
+        // Constructs an element in place after it, returns iterator to the new element
+        // or end() if it is end()
+        template <typename... Args>
+        Iterator emplace_after(Iterator& it, Args&&... args);
 
         // Removes an element after desired element
         Iterator erase_after(Iterator& it);
@@ -122,18 +153,64 @@ namespace AlgoStruct
         // Clears the contents of the list
         void clear();
 
-        // Merge sort of list elements
+        void swap(ForwardList& other) noexcept;
+
+        // Stable merge sort of list elements: comp(a, b) returns true if a goes before b
         void sort();
+        template <typename Compare>
+        void sort(Compare comp);
+
+        // Sorts contiguous runs of the list on several threads, then merges them
+        template <typename Compare = std::less<T>>
+        void parallel_sort(size_t thread_count = std::thread::hardware_concurrency(), Compare comp = Compare{});
+
+        // Moves all elements of other after pos (pos == end() appends them to the back).
+        // Nodes are relinked in O(1). This list pool adopts other's block arenas: the smaller set
+        // of arenas is merged into the larger one, O(log n) amortized per arena
+        void splice_after(Iterator pos, ForwardList& other);
+
+        // Moves elements (first, last) of other after pos. Nodes are relinked, iterators to them stay
+        // valid. Linear in the range length, which is walked to find its last node and size,
+        // plus the number of block arenas other holds, which this list pool keeps alive
+        void splice_after(Iterator pos, ForwardList& other, Iterator first, Iterator last);
+
+        // Merges sorted other into this sorted list, other becomes empty. Stable: equal elements
+        // of this list go first
+        void merge(ForwardList& other);
+        template <typename Compare>
+        void merge(ForwardList& other, Compare comp);
+
+        // Removes elements satisfying pred, returns number of removed elements
+        template <typename Predicate>
+        size_t remove_if(Predicate pred);
+
+        // Removes all but the first element of every group of consecutive equal elements,
+        // returns number of removed elements
+        size_t unique();
+        template <typename BinaryPredicate>
+        size_t unique(BinaryPredicate pred);
 
     private:
-        Node* split(Node* head);
-        std::pair<Node*, Node*> merge(Node* left_head, Node* right_head);
-        std::pair<Node*, Node*> merge_sort(Node* head);
+        template <typename Compare>
+        static Node* merge(Node* left_head, Node* right_head, Compare& comp);
+        template <typename Compare>
+        static Node* merge_sort(Node* head, Compare& comp);
+
+        // Restores m_tail after nodes relinking
+        void update_tail() noexcept;
+
+        // Links node after prev, or to the front if prev is null
+        void link_after(Node* prev, Node* node) noexcept;
+
+        // Takes nodes of other, which becomes empty. Pool must adopt other's pool already
+        void adopt_nodes(ForwardList& other) noexcept;
 
     private:
         Node* m_head = nullptr;
         Node* m_tail = nullptr;
         size_t m_size = 0;
+        // Nodes are carved from the pool blocks and recycled through its free-list
+        NodePool<Node> m_pool;
     };
 
     template <typename T>
@@ -151,6 +228,41 @@ namespace AlgoStruct
         clear();
     }
 
+    template <typename T>
+    ForwardList<T>::ForwardList(const ForwardList& other)
+    {
+        for (const auto& elem : other)
+        {
+            push_back(elem);
+        }
+    }
+
+    template <typename T>
+    ForwardList<T>& ForwardList<T>::operator= (const ForwardList& other)
+    {
+        if (this != &other)
+        {
+            ForwardList tmp(other);
+            swap(tmp);
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    ForwardList<T>::ForwardList(ForwardList&& other) noexcept
+    {
+        swap(other);
+    }
+
+    template <typename T>
+    ForwardList<T>& ForwardList<T>::operator= (ForwardList&& other) noexcept
+    {
+        ForwardList tmp(std::move(other));
+        swap(tmp);
+        return *this;
+    }
+
     template <typename T>
     auto ForwardList<T>::begin() const noexcept -> Iterator
     {
@@ -160,7 +272,7 @@ namespace AlgoStruct
     template <typename T>
     auto ForwardList<T>::end() const noexcept -> Iterator
     {
-        return Iterator(m_tail->next);
+        return Iterator(nullptr);
     }
 
     template <typename T>
@@ -176,9 +288,10 @@ namespace AlgoStruct
     }
 
     template <typename T>
-    void ForwardList<T>::push_front(const T& value)
+    template <typename... Args>
+    T& ForwardList<T>::emplace_front(Args&&... args)
     {
-        Node* new_node = new Node{value, nullptr};
+        Node* new_node = m_pool.create(nullptr, std::forward<Args>(args)...);
 
         if (!m_head)
         {
@@ -192,12 +305,14 @@ namespace AlgoStruct
         }
 
         ++m_size;
+        return new_node->value;
     }
 
     template <typename T>
-    void ForwardList<T>::push_back(const T& value)
+    template <typename... Args>
+    T& ForwardList<T>::emplace_back(Args&&... args)
     {
-        Node* new_node = new Node{value, nullptr};
+        Node* new_node = m_pool.create(nullptr, std::forward<Args>(args)...);
 
         if (!m_tail)
         {
@@ -211,6 +326,7 @@ namespace AlgoStruct
         }
         
         ++m_size;
+        return new_node->value;
     }
 
     template <typename T>
@@ -224,25 +340,27 @@ namespace AlgoStruct
         Node* to_delete = m_head;
         m_head = m_head->next;
 
-        delete(to_delete);
+        m_pool.destroy(to_delete);
 
         if (!m_head)
         {
             m_tail = nullptr;
+            m_pool.trim();
         }
 
         --m_size;
     }
 
     template <typename T>
-    void ForwardList<T>::insert_after(Iterator& it, const T& value)
+    template <typename... Args>
+    auto ForwardList<T>::emplace_after(Iterator& it, Args&&... args) -> Iterator
     {
         if (!it)
         {
-            return;
+            return end();
         }
 
-        Node *new_node = new Node{value, it.m_node->next};
+        Node *new_node = m_pool.create(it.m_node->next, std::forward<Args>(args)...);
         it.m_node->next = new_node;
 
         if (it == Iterator(m_tail))
@@ -251,6 +369,7 @@ namespace AlgoStruct
         }
 
         ++m_size;
+        return Iterator(new_node);
     }
 
     template <typename T>
@@ -263,7 +382,7 @@ namespace AlgoStruct
 
         Node* to_delete = it.m_node->next;
         it.m_node->next = it.m_node->next->next;
-        delete(to_delete);
+        m_pool.destroy(to_delete);
 
         if (to_delete == m_tail)
         {
@@ -296,20 +415,35 @@ namespace AlgoStruct
     template <typename T>
     void ForwardList<T>::clear()
     {
-        Node* curr_node = m_head;
-
-        while (curr_node)
+        if constexpr (!std::is_trivially_destructible_v<T>)
         {
-            Node* to_delete = curr_node;
-            curr_node = curr_node->next;
-            delete(to_delete);
+            Node* curr_node = m_head;
+
+            while (curr_node)
+            {
+                Node* to_destroy = curr_node;
+                curr_node = curr_node->next;
+                to_destroy->~Node();
+            }
         }
 
+        // Memory of all nodes is freed at once, by blocks
+        m_pool.release();
+
         m_head = nullptr;
         m_tail = nullptr;
         m_size = 0;
     }
 
+    template <typename T>
+    void ForwardList<T>::swap(ForwardList& other) noexcept
+    {
+        std::swap(m_head, other.m_head);
+        std::swap(m_tail, other.m_tail);
+        std::swap(m_size, other.m_size);
+        m_pool.swap(other.m_pool);
+    }
+
     template <typename T>
     T& ForwardList<T>::front()
     {
@@ -345,111 +479,417 @@ namespace AlgoStruct
     }
 
     template <typename T>
-    auto ForwardList<T>::split(Node* head) -> Node*
+    template <typename Compare>
+    auto ForwardList<T>::merge(Node* left_head, Node* right_head, Compare& comp) -> Node*
     {
-        Node* slow = head;
-        Node* fast = head;
-        Node* mid = slow;
+        Node* new_head = nullptr;
+        Node** new_tail = &new_head;
 
-        while (fast && fast->next)
+        // Left element wins ties, so merge is stable
+        while (left_head && right_head)
         {
-            mid = slow;
-            slow = slow->next;
-            fast = fast->next->next;
+            if (comp(right_head->value, left_head->value))
+            {
+                *new_tail = right_head;
+                right_head = right_head->next;
+            }
+            else
+            {
+                *new_tail = left_head;
+                left_head = left_head->next;
+            }
+
+            new_tail = &(*new_tail)->next;
         }
 
-        return mid;
+        *new_tail = left_head ? left_head : right_head;
+
+        return new_head;
     }
 
     template <typename T>
-    auto ForwardList<T>::merge(Node* left_head, Node* right_head) -> std::pair<Node*, Node*>
+    template <typename Compare>
+    auto ForwardList<T>::merge_sort(Node* head, Compare& comp) -> Node*
     {
-        Node* new_head = nullptr;
-        Node* new_tail = nullptr;
+        // Bottom-up merge sort without recursion and list splitting.
+        // runs[i] is empty or holds a sorted run of 2^i nodes; each node taken from the list
+        // is carried through the runs like an increment of a binary counter:
+        //
+        //   list: 3 -> 2 -> 1 -> 5 -> 4
+        //
+        //   take 3:  runs = [3]
+        //   take 2:  runs = [ - , 2 3]
+        //   take 1:  runs = [1, 2 3]
+        //   take 5:  runs = [ - ,  - , 1 2 3 5]
+        //   take 4:  runs = [4,  - , 1 2 3 5]
+        //
+        //   merge runs: 1 -> 2 -> 3 -> 4 -> 5
+        //
+        // Runs with higher index hold earlier nodes, so they are the left side of every merge.
+
+        constexpr size_t max_runs = 64;
+        Node* runs[max_runs] = {};
+        size_t run_count = 0;
+
+        while (head)
+        {
+            Node* carry = head;
+            head = head->next;
+            carry->next = nullptr;
+
+            size_t i = 0;
+            for (; i < run_count && runs[i]; ++i)
+            {
+                carry = merge(runs[i], carry, comp);
+                runs[i] = nullptr;
+            }
+
+            runs[i] = carry;
+            if (i == run_count)
+            {
+                ++run_count;
+            }
+        }
 
-        const auto append_node = [&new_head, &new_tail](Node* node)
+        Node* result = nullptr;
+        for (size_t i = 0; i < run_count; ++i)
         {
-            if (!new_head)
+            if (runs[i])
             {
-                new_head = node;
-                new_tail = new_head;
+                result = merge(runs[i], result, comp);
             }
-            else
+        }
+
+        return result;
+    }
+
+    template <typename T>
+    void ForwardList<T>::update_tail() noexcept
+    {
+        m_tail = m_head;
+
+        while (m_tail && m_tail->next)
+        {
+            m_tail = m_tail->next;
+        }
+    }
+
+    template <typename T>
+    void ForwardList<T>::sort()
+    {
+        sort(std::less<T>{});
+    }
+
+    template <typename T>
+    template <typename Compare>
+    void ForwardList<T>::sort(Compare comp)
+    {
+        m_head = merge_sort(m_head, comp);
+        update_tail();
+    }
+
+    template <typename T>
+    template <typename Compare>
+    void ForwardList<T>::parallel_sort(size_t thread_count, Compare comp)
+    {
+        // Minimal run length worth a separate thread
+        constexpr size_t min_run_size = 4096;
+
+        thread_count = std::clamp<size_t>(thread_count, 1, std::max<size_t>(m_size / min_run_size, 1));
+        if (thread_count == 1)
+        {
+            sort(comp);
+            return;
+        }
+
+        // Cut the list into contiguous runs of equal length
+        std::vector<Node*> runs;
+        runs.reserve(thread_count);
+
+        const size_t run_size = (m_size + thread_count - 1) / thread_count;
+        Node* node = m_head;
+        while (node)
+        {
+            runs.push_back(node);
+
+            for (size_t i = 1; i < run_size && node->next; ++i)
             {
-                new_tail->next = node;
-                new_tail = new_tail->next;
+                node = node->next;
             }
-        };
 
-        while (left_head && right_head)
+            Node* next = node->next;
+            node->next = nullptr;
+            node = next;
+        }
+
+        // Every thread owns a copy of the comparator
+        const auto for_each_run = [&runs](size_t step, auto func)
         {
-            if (left_head->value <= right_head->value)
+            std::vector<std::thread> workers;
+            for (size_t i = step; i < runs.size(); i += step)
             {
-                append_node(left_head);
-                left_head = left_head->next;
+                workers.emplace_back(func, i);
             }
-            else
+
+            // The calling thread processes the first run
+            func(0);
+
+            for (auto& worker : workers)
             {
-                append_node(right_head);
-                right_head = right_head->next;
+                worker.join();
             }
+        };
+
+        for_each_run(1, [&runs, comp](size_t i) mutable
+        {
+            runs[i] = merge_sort(runs[i], comp);
+        });
+
+        // Merge neighbour runs pairwise: 0 + 1, 2 + 3, ... until a single run remains
+        for (size_t width = 1; width < runs.size(); width *= 2)
+        {
+            for_each_run(2 * width, [&runs, width, comp](size_t i) mutable
+            {
+                if (i + width < runs.size())
+                {
+                    runs[i] = merge(runs[i], runs[i + width], comp);
+                }
+            });
         }
 
-        while (left_head)
+        m_head = runs.front();
+        update_tail();
+    }
+
+    template <typename T>
+    void ForwardList<T>::link_after(Node* prev, Node* node) noexcept
+    {
+        if (!prev)
+        {
+            node->next = m_head;
+            m_head = node;
+        }
+        else
         {
-            append_node(left_head);
-            left_head = left_head->next;
+            node->next = prev->next;
+            prev->next = node;
         }
 
-        while (right_head)
+        if (!m_tail || prev == m_tail)
         {
-            append_node(right_head);
-            right_head = right_head->next;
+            m_tail = node;
         }
 
-        return {new_head, new_tail};
+        ++m_size;
     }
 
     template <typename T>
-    auto ForwardList<T>::merge_sort(Node* head) -> std::pair<Node*, Node*>
+    void ForwardList<T>::adopt_nodes(ForwardList& other) noexcept
     {
-        // 3 -> 2 -> 1 -> 5 -> 4 ->
-        //          split
-        // 3 -> 2 ->        1 -> 5 -> 4 ->
-        //   split              split
-        // 3 ->     2 ->    1 ->   5 -> 4 ->
-        //     merge                split
-        // 2 -> 3 ->        1 ->    5 ->   4 -> 
-        //                             merge
-        // 2 -> 3 ->        1 ->    4 -> 5 ->
-        //                     merge
-        // 2 -> 3 ->        1 -> 4 -> 5 ->
-        //           merge 
-        // 1 -> 2 -> 3 -> 4 -> 5 ->
+        m_size += other.m_size;
 
-        if (!head || !head->next)
+        other.m_head = nullptr;
+        other.m_tail = nullptr;
+        other.m_size = 0;
+    }
+
+    template <typename T>
+    void ForwardList<T>::splice_after(Iterator pos, ForwardList& other)
+    {
+        if (&other == this || other.empty())
         {
-            return {head, head};
+            return;
         }
 
-        Node* mid = split(head);
-        Node* left_head = head;
-        Node* right_head = mid->next;
-        mid->next = nullptr;
+        m_pool.adopt(other.m_pool);
+        Node* prev = pos ? pos.m_node : m_tail;
 
-        const auto left_sorted = merge_sort(left_head);
-        const auto right_sorted = merge_sort(right_head);
+        if (!prev)
+        {
+            m_head = other.m_head;
+            m_tail = other.m_tail;
+        }
+        else
+        {
+            other.m_tail->next = prev->next;
+            prev->next = other.m_head;
+
+            if (prev == m_tail)
+            {
+                m_tail = other.m_tail;
+            }
+        }
 
-        return merge(left_sorted.first, right_sorted.first);
+        adopt_nodes(other);
     }
 
     template <typename T>
-    void ForwardList<T>::sort()
+    void ForwardList<T>::splice_after(Iterator pos, ForwardList& other, Iterator first, Iterator last)
+    {
+        if (!first || first.m_node->next == last.m_node)
+        {
+            return;
+        }
+
+        Node* prev = pos ? pos.m_node : m_tail;
+
+        Node* range_head = first.m_node->next;
+        Node* range_tail = range_head;
+        size_t count = 1;
+        while (range_tail->next != last.m_node)
+        {
+            range_tail = range_tail->next;
+            ++count;
+        }
+
+        if (&other != this)
+        {
+            m_pool.share(other.m_pool);
+            other.m_size -= count;
+            m_size += count;
+        }
+        // Relinking inside the list: pos must not be in (first, last)
+        else if (prev == first.m_node || prev == range_tail)
+        {
+            return;
+        }
+
+        first.m_node->next = last.m_node;
+        if (range_tail == other.m_tail)
+        {
+            other.m_tail = first.m_node;
+        }
+
+        if (!prev)
+        {
+            range_tail->next = nullptr;
+            m_head = range_head;
+            m_tail = range_tail;
+            return;
+        }
+
+        range_tail->next = prev->next;
+        prev->next = range_head;
+        if (prev == m_tail)
+        {
+            m_tail = range_tail;
+        }
+    }
+
+    template <typename T>
+    void ForwardList<T>::merge(ForwardList& other)
+    {
+        merge(other, std::less<T>{});
+    }
+
+    template <typename T>
+    template <typename Compare>
+    void ForwardList<T>::merge(ForwardList& other, Compare comp)
     {
-        const auto head_tail = merge_sort(m_head);
+        if (&other == this || other.empty())
+        {
+            return;
+        }
+
+        if (empty())
+        {
+            splice_after(end(), other);
+            return;
+        }
+
+        // Equal last elements: the one of other goes last
+        Node* new_tail = comp(other.m_tail->value, m_tail->value) ? m_tail : other.m_tail;
+        m_pool.adopt(other.m_pool);
+
+        m_head = merge(m_head, other.m_head, comp);
+        m_tail = new_tail;
+
+        adopt_nodes(other);
+    }
+
+    template <typename T>
+    template <typename Predicate>
+    size_t ForwardList<T>::remove_if(Predicate pred)
+    {
+        size_t removed = 0;
+        Node* prev = nullptr;
+        Node* node = m_head;
+
+        while (node)
+        {
+            Node* next = node->next;
+
+            if (pred(node->value))
+            {
+                if (prev)
+                {
+                    prev->next = next;
+                }
+                else
+                {
+                    m_head = next;
+                }
+
+                m_pool.destroy(node);
+                ++removed;
+            }
+            else
+            {
+                prev = node;
+            }
+
+            node = next;
+        }
+
+        m_tail = prev;
+        m_size -= removed;
+        if (!m_head)
+        {
+            m_pool.trim();
+        }
+        return removed;
+    }
+
+    template <typename T>
+    size_t ForwardList<T>::unique()
+    {
+        return unique(std::equal_to<T>{});
+    }
+
+    template <typename T>
+    template <typename BinaryPredicate>
+    size_t ForwardList<T>::unique(BinaryPredicate pred)
+    {
+        if (!m_head)
+        {
+            return 0;
+        }
+
+        size_t removed = 0;
+        Node* prev = m_head;
+        Node* node = m_head->next;
+
+        while (node)
+        {
+            Node* next = node->next;
+
+            if (pred(prev->value, node->value))
+            {
+                prev->next = next;
+                m_pool.destroy(node);
+                ++removed;
+            }
+            else
+            {
+                prev = node;
+            }
+
+            node = next;
+        }
 
-        m_head = head_tail.first;
-        m_tail = head_tail.second;
+        m_tail = prev;
+        m_size -= removed;
+        return removed;
     }
 
 } // namespace AlgoStruct
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace AlgoStruct
+{
+// Hazard pointers: safe memory reclamation for lock-free containers.
+//
+// Before dereferencing a shared node a thread publishes its address in one of own hazard
+// slots. Removed nodes are retired instead of deleted: a retired node is deleted only when
+// no thread has it published. So a node can not be freed (and its address reused) while
+// someone still works with it, which also rules out ABA on CAS of node pointers.
+//
+//   records -> [thread A: slot0 slot1] -> [thread B: slot0 slot1] -> nullptr
+//
+// Each thread owns a record while it is alive, records are reused by new threads and freed
+// with the domain. Retired nodes are kept per thread and scanned in batches. Nodes retired
+// by a finished thread and still protected are handed over to the next scan.
+class HazardPointerDomain
+{
+public:
+    static constexpr size_t SlotsPerThread = 2;
+
+    // The only domain, shared by all containers
+    static HazardPointerDomain& global()
+    {
+        static HazardPointerDomain domain;
+        return domain;
+    }
+
+    HazardPointerDomain(const HazardPointerDomain&) = delete;
+    HazardPointerDomain& operator= (const HazardPointerDomain&) = delete;
+    ~HazardPointerDomain();
+
+    // Loads pointer from src and publishes it in the slot of calling thread.
+    // The pointed object is not deleted until the slot is cleared or reused
+    template<typename T>
+    T* protect(size_t slot, const std::atomic<T*>& src);
+    void clear(size_t slot) noexcept;
+
+    // Deletes ptr once it is not protected by any thread
+    template<typename T>
+    void retire(T* ptr);
+
+    // Deletes all retired nodes of calling thread, which are not protected
+    void reclaim();
+
+private:
+    struct Record
+    {
+        std::atomic<const void*> hazards[SlotsPerThread] = {};
+        std::atomic<bool> active{false};
+        Record* next = nullptr;
+    };
+
+    struct Retired
+    {
+        void* ptr;
+        void (*deleter)(void*);
+    };
+
+    // Record and retired nodes of a thread
+    struct ThreadState
+    {
+        explicit ThreadState(HazardPointerDomain& domain);
+        ~ThreadState();
+
+        HazardPointerDomain& domain;
+        Record* record;
+        std::vector<Retired> retired;
+    };
+
+    HazardPointerDomain() = default;
+
+    static ThreadState& local()
+    {
+        thread_local ThreadState state(global());
+        return state;
+    }
+
+    Record* acquire_record();
+    void scan(std::vector<Retired>& retired);
+
+private:
+    std::atomic<Record*> m_records{nullptr};
+    std::atomic<size_t> m_recordCount{0};
+
+    // Protected nodes left by finished threads
+    std::mutex m_orphansMutex;
+    std::vector<Retired> m_orphans;
+};
+
+inline HazardPointerDomain::ThreadState::ThreadState(HazardPointerDomain& d)
+    : domain(d)
+    , record(d.acquire_record())
+{}
+
+inline HazardPointerDomain::ThreadState::~ThreadState()
+{
+    for (auto& hazard : record->hazards)
+    {
+        hazard.store(nullptr, std::memory_order_release);
+    }
+
+    domain.scan(retired);
+    if (!retired.empty())
+    {
+        std::lock_guard lock(domain.m_orphansMutex);
+        domain.m_orphans.insert(domain.m_orphans.end(), retired.begin(), retired.end());
+    }
+
+    record->active.store(false, std::memory_order_release);
+}
+
+inline HazardPointerDomain::~HazardPointerDomain()
+{
+    // All threads are finished: nothing is protected anymore
+    for (const auto& node : m_orphans)
+    {
+        node.deleter(node.ptr);
+    }
+
+    Record* record = m_records.load(std::memory_order_acquire);
+    while (record)
+    {
+        Record* next = record->next;
+        delete record;
+        record = next;
+    }
+}
+
+template<typename T>
+T* HazardPointerDomain::protect(size_t slot, const std::atomic<T*>& src)
+{
+    auto& hazard = local().record->hazards[slot];
+
+    // Published pointer is valid only if src still holds it after publication
+    T* ptr = src.load(std::memory_order_relaxed);
+    while (true)
+    {
+        hazard.store(ptr, std::memory_order_seq_cst);
+
+        T* current = src.load(std::memory_order_seq_cst);
+        if (current == ptr) return ptr;
+        ptr = current;
+    }
+}
+
+inline void HazardPointerDomain::clear(size_t slot) noexcept
+{
+    local().record->hazards[slot].store(nullptr, std::memory_order_release);
+}
+
+template<typename T>
+void HazardPointerDomain::retire(T* ptr)
+{
+    auto& state = local();
+    state.retired.push_back({ptr, [](void* p) { delete static_cast<T*>(p); }});
+
+    // Batch size proportional to the number of hazards keeps amortized scan cost O(1)
+    const size_t threshold = std::max<size_t>(64, 2 * SlotsPerThread * m_recordCount.load(std::memory_order_relaxed));
+    if (state.retired.size() >= threshold)
+    {
+        scan(state.retired);
+    }
+}
+
+inline void HazardPointerDomain::reclaim()
+{
+    scan(local().retired);
+}
+
+inline auto HazardPointerDomain::acquire_record() -> Record*
+{
+    // Reuse a record of a finished thread
+    for (Record* record = m_records.load(std::memory_order_acquire); record; record = record->next)
+    {
+        bool expected = false;
+        if (!record->active.load(std::memory_order_relaxed) &&
+            record->active.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        {
+            return record;
+        }
+    }
+
+    auto* record = new Record;
+    record->active.store(true, std::memory_order_relaxed);
+    m_recordCount.fetch_add(1, std::memory_order_relaxed);
+
+    record->next = m_records.load(std::memory_order_relaxed);
+    while (!m_records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+
+    return record;
+}
+
+inline void HazardPointerDomain::scan(std::vector<Retired>& retired)
+{
+    {
+        std::unique_lock lock(m_orphansMutex, std::try_to_lock);
+        if (lock && !m_orphans.empty())
+        {
+            retired.insert(retired.end(), m_orphans.begin(), m_orphans.end());
+            m_orphans.clear();
+        }
+    }
+
+    std::vector<const void*> hazards;
+    for (Record* record = m_records.load(std::memory_order_acquire); record; record = record->next)
+    {
+        for (const auto& hazard : record->hazards)
+        {
+            if (const void* ptr = hazard.load(std::memory_order_seq_cst))
+            {
+                hazards.push_back(ptr);
+            }
+        }
+    }
+    std::sort(hazards.begin(), hazards.end());
+
+    // Protected nodes stay retired
+    const auto protectedEnd = std::partition(retired.begin(), retired.end(), [&hazards](const Retired& node)
+    {
+        return std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(node.ptr));
+    });
+
+    for (auto it = protectedEnd; it != retired.end(); ++it)
+    {
+        it->deleter(it->ptr);
+    }
+    retired.erase(protectedEnd, retired.end());
+}
+
+} // namespace AlgoStruct
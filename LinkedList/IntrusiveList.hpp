@@ -0,0 +1,486 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace AlgoStruct
+{
+// Intrusive lists: links live inside user objects, lists never allocate or copy values.
+//
+//   struct Order: IntrusiveListHook<LruTag>, IntrusiveListHook<BucketTag> {};
+//
+//   struct Task
+//   {
+//       IntrusiveForwardListHook<> pending;
+//   };
+//
+//   IntrusiveList<Order, BaseHook<LruTag>> lru;
+//   IntrusiveList<Order, BaseHook<BucketTag>> bucket;
+//   IntrusiveForwardList<Task, ALGO_STRUCT_MEMBER_HOOK(Task, pending)> queue;
+//
+// An object may be linked into one list per hook at a time, the list does not own it:
+// the object must outlive its membership. Copying an object does not copy its links.
+
+struct DefaultHookTag {};
+
+// Hook is a base class of the value type, Tag distinguishes several base hooks
+template<typename Tag = DefaultHookTag>
+struct BaseHook {};
+
+// Hook is a data member of the value type: MemberHook<&Value::hook, offsetof(Value, hook)>.
+// The value type must be standard-layout for the offset to be defined, use base hooks otherwise
+template<auto Member, std::size_t Offset>
+struct MemberHook {};
+
+#define ALGO_STRUCT_MEMBER_HOOK(Type, member) ::AlgoStruct::MemberHook<&Type::member, offsetof(Type, member)>
+
+namespace detail
+{
+    struct ForwardHookNode
+    {
+        ForwardHookNode* next = nullptr;
+    };
+
+    struct HookNode
+    {
+        HookNode* next = nullptr;
+        HookNode* prev = nullptr;
+    };
+
+    // Link fields are never copied: a copy of a linked object is not linked
+    template<typename Node>
+    struct HookBase: Node
+    {
+        HookBase() = default;
+        HookBase(const HookBase&) noexcept {}
+        HookBase& operator= (const HookBase&) noexcept { return *this; }
+
+        bool is_linked() const noexcept { return this->next != nullptr; }
+    };
+
+    // Conversions between value and its hook
+    template<typename T, template<typename> class Hook, typename Policy>
+    struct HookAccess;
+
+    template<typename T, template<typename> class Hook, typename Tag>
+    struct HookAccess<T, Hook, BaseHook<Tag>>
+    {
+        using hook_type = Hook<Tag>;
+
+        static hook_type* to_hook(T* value) noexcept { return static_cast<hook_type*>(value); }
+        static T* to_value(hook_type* hook) noexcept { return static_cast<T*>(hook); }
+    };
+
+    template<typename T, template<typename> class Hook, typename H, H T::*Member, std::size_t Offset>
+    struct HookAccess<T, Hook, MemberHook<Member, Offset>>
+    {
+        static_assert(std::is_standard_layout_v<T>, "MemberHook requires a standard-layout value type");
+
+        using hook_type = H;
+
+        static hook_type* to_hook(T* value) noexcept
+        {
+            hook_type* hook = &(value->*Member);
+            assert(reinterpret_cast<unsigned char*>(hook) - reinterpret_cast<unsigned char*>(value) == Offset);
+            return hook;
+        }
+
+        // Subtracts offset of the member from hook address
+        static T* to_value(hook_type* hook) noexcept
+        {
+            return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(hook) - Offset);
+        }
+    };
+
+    template<typename T, typename Node, typename Access>
+    class HookIterator
+    {
+    public:
+        using iterator_category = std::conditional_t<std::is_same_v<Node, HookNode>,
+                                                     std::bidirectional_iterator_tag,
+                                                     std::forward_iterator_tag>;
+        using value_type = T;
+        using pointer = T*;
+        using reference = T&;
+        using difference_type = std::ptrdiff_t;
+
+        HookIterator() = default;
+        explicit HookIterator(Node* node): m_node(node) {}
+
+        reference operator* () const { return *Access::to_value(static_cast<typename Access::hook_type*>(m_node)); }
+        pointer operator-> () const { return Access::to_value(static_cast<typename Access::hook_type*>(m_node)); }
+
+        HookIterator& operator++ ()
+        {
+            m_node = m_node->next;
+            return *this;
+        }
+        HookIterator operator++ (int)
+        {
+            HookIterator ret = *this;
+            ++(*this);
+            return ret;
+        }
+
+        HookIterator& operator-- () requires std::is_same_v<Node, HookNode>
+        {
+            m_node = m_node->prev;
+            return *this;
+        }
+        HookIterator operator-- (int) requires std::is_same_v<Node, HookNode>
+        {
+            HookIterator ret = *this;
+            --(*this);
+            return ret;
+        }
+
+        friend bool operator== (const HookIterator& lhs, const HookIterator& rhs) { return lhs.m_node == rhs.m_node; }
+        friend bool operator!= (const HookIterator& lhs, const HookIterator& rhs) { return !(lhs == rhs); }
+
+        Node* node() const noexcept { return m_node; }
+
+    private:
+        Node* m_node = nullptr;
+    };
+} // namespace detail
+
+// Hook of singly linked intrusive list
+template<typename Tag = DefaultHookTag>
+struct IntrusiveForwardListHook: detail::HookBase<detail::ForwardHookNode> {};
+
+// Hook of doubly linked intrusive list
+template<typename Tag = DefaultHookTag>
+struct IntrusiveListHook: detail::HookBase<detail::HookNode> {};
+
+// Singly linked intrusive list. The last node points to the root, so before_begin() == end()
+// and a hook is linked iff its next pointer is set:
+//
+//   root -> obj1 -> obj2 -> obj3
+//    ^________________________|
+template<typename T, typename HookPolicy = BaseHook<>>
+class IntrusiveForwardList
+{
+    using Node = detail::ForwardHookNode;
+    using Access = detail::HookAccess<T, IntrusiveForwardListHook, HookPolicy>;
+
+public:
+    using value_type = T;
+    using iterator = detail::HookIterator<T, Node, Access>;
+
+    IntrusiveForwardList() noexcept { m_root.next = &m_root; }
+    ~IntrusiveForwardList() { clear(); }
+
+    IntrusiveForwardList(const IntrusiveForwardList&) = delete;
+    IntrusiveForwardList& operator= (const IntrusiveForwardList&) = delete;
+
+    // Element access
+    T& front() const;
+    T& back() const;
+
+    // Iterators
+    iterator before_begin() const noexcept { return iterator(root()); }
+    iterator begin() const noexcept { return iterator(m_root.next); }
+    iterator end() const noexcept { return iterator(root()); }
+
+    // Capacity
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+
+    // Modifiers. Values must not be linked by the same hook
+    void push_front(T& value) { insert_after(before_begin(), value); }
+    void push_back(T& value) { insert_after(iterator(m_tail), value); }
+    void pop_front();
+
+    // Links value after pos, returns iterator to it
+    iterator insert_after(iterator pos, T& value);
+    // Unlinks element after pos, returns iterator to the element following it
+    iterator erase_after(iterator pos);
+
+    // Unlinks all elements: O(n)
+    void clear() noexcept;
+
+private:
+    Node* root() const noexcept { return const_cast<Node*>(&m_root); }
+    static Node* to_node(T& value) noexcept { return Access::to_hook(&value); }
+
+private:
+    Node m_root;
+    Node* m_tail = &m_root;
+    size_t m_size = 0;
+};
+
+template<typename T, typename HookPolicy>
+T& IntrusiveForwardList<T, HookPolicy>::front() const
+{
+    if (empty()) throw std::invalid_argument("front() on empty IntrusiveForwardList");
+
+    return *begin();
+}
+
+template<typename T, typename HookPolicy>
+T& IntrusiveForwardList<T, HookPolicy>::back() const
+{
+    if (empty()) throw std::invalid_argument("back() on empty IntrusiveForwardList");
+
+    return *iterator(m_tail);
+}
+
+template<typename T, typename HookPolicy>
+void IntrusiveForwardList<T, HookPolicy>::pop_front()
+{
+    if (empty()) throw std::invalid_argument("pop_front() on empty IntrusiveForwardList");
+
+    erase_after(before_begin());
+}
+
+template<typename T, typename HookPolicy>
+auto IntrusiveForwardList<T, HookPolicy>::insert_after(iterator pos, T& value) -> iterator
+{
+    Node* node = to_node(value);
+    if (node->next) throw std::logic_error("value is already linked");
+
+    Node* prev = pos.node();
+    node->next = prev->next;
+    prev->next = node;
+
+    if (prev == m_tail)
+    {
+        m_tail = node;
+    }
+
+    ++m_size;
+    return iterator(node);
+}
+
+template<typename T, typename HookPolicy>
+auto IntrusiveForwardList<T, HookPolicy>::erase_after(iterator pos) -> iterator
+{
+    Node* prev = pos.node();
+    Node* node = prev->next;
+    if (node == &m_root) return end();
+
+    prev->next = node->next;
+    node->next = nullptr;
+
+    if (node == m_tail)
+    {
+        m_tail = prev;
+    }
+
+    --m_size;
+    return iterator(prev->next);
+}
+
+template<typename T, typename HookPolicy>
+void IntrusiveForwardList<T, HookPolicy>::clear() noexcept
+{
+    Node* node = m_root.next;
+    while (node != &m_root)
+    {
+        Node* next = node->next;
+        node->next = nullptr;
+        node = next;
+    }
+
+    m_root.next = &m_root;
+    m_tail = &m_root;
+    m_size = 0;
+}
+
+// Doubly linked intrusive list with O(1) unlink of an element by reference.
+// Same cycled layout with dummy node as DoublyLinkedList:
+//
+//   root <-> obj1 <-> obj2 <-> obj3
+//    ^__________________________^
+template<typename T, typename HookPolicy = BaseHook<>>
+class IntrusiveList
+{
+    using Node = detail::HookNode;
+    using Access = detail::HookAccess<T, IntrusiveListHook, HookPolicy>;
+
+public:
+    using value_type = T;
+    using iterator = detail::HookIterator<T, Node, Access>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    IntrusiveList() noexcept { m_root.next = m_root.prev = &m_root; }
+    ~IntrusiveList() { clear(); }
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator= (const IntrusiveList&) = delete;
+    IntrusiveList(IntrusiveList&& other) noexcept: IntrusiveList() { swap(other); }
+    IntrusiveList& operator= (IntrusiveList&& other) noexcept
+    {
+        clear();
+        swap(other);
+        return *this;
+    }
+
+    // Element access
+    T& front() const;
+    T& back() const;
+
+    // Iterators
+    iterator begin() const noexcept { return iterator(m_root.next); }
+    iterator end() const noexcept { return iterator(root()); }
+    reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+    // Iterator to a value linked into this list
+    static iterator iterator_to(T& value) noexcept { return iterator(to_node(value)); }
+
+    // Capacity
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+
+    // Modifiers. Values must not be linked by the same hook
+    iterator insert(iterator pos, T& value);    // Links value before pos
+    iterator erase(iterator pos);               // Unlinks the element at pos, returns the next one
+    void erase(T& value) { erase(iterator_to(value)); }
+
+    void push_back(T& value) { insert(end(), value); }
+    void push_front(T& value) { insert(begin(), value); }
+    void pop_back();
+    void pop_front();
+
+    // Relinks value before pos: O(1), e.g. moving a recently used element to the front
+    void move_to(iterator pos, T& value) noexcept;
+
+    // Unlinks all elements: O(n)
+    void clear() noexcept;
+    void swap(IntrusiveList& other) noexcept;
+
+private:
+    Node* root() const noexcept { return const_cast<Node*>(&m_root); }
+    static Node* to_node(T& value) noexcept { return Access::to_hook(&value); }
+
+    static void link_before(Node* pos, Node* node) noexcept
+    {
+        node->next = pos;
+        node->prev = pos->prev;
+        pos->prev->next = node;
+        pos->prev = node;
+    }
+
+    static void unlink(Node* node) noexcept
+    {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        node->next = node->prev = nullptr;
+    }
+
+private:
+    Node m_root;
+    size_t m_size = 0;
+};
+
+template<typename T, typename HookPolicy>
+T& IntrusiveList<T, HookPolicy>::front() const
+{
+    if (empty()) throw std::invalid_argument("front() on empty IntrusiveList");
+
+    return *begin();
+}
+
+template<typename T, typename HookPolicy>
+T& IntrusiveList<T, HookPolicy>::back() const
+{
+    if (empty()) throw std::invalid_argument("back() on empty IntrusiveList");
+
+    return *iterator(m_root.prev);
+}
+
+template<typename T, typename HookPolicy>
+auto IntrusiveList<T, HookPolicy>::insert(iterator pos, T& value) -> iterator
+{
+    Node* node = to_node(value);
+    if (node->next) throw std::logic_error("value is already linked");
+
+    link_before(pos.node(), node);
+    ++m_size;
+
+    return iterator(node);
+}
+
+template<typename T, typename HookPolicy>
+auto IntrusiveList<T, HookPolicy>::erase(iterator pos) -> iterator
+{
+    Node* node = pos.node();
+    if (node == &m_root) throw std::invalid_argument("erase() of end iterator");
+
+    Node* next = node->next;
+    unlink(node);
+    --m_size;
+
+    return iterator(next);
+}
+
+template<typename T, typename HookPolicy>
+void IntrusiveList<T, HookPolicy>::pop_back()
+{
+    if (empty()) throw std::invalid_argument("pop_back() on empty IntrusiveList");
+
+    erase(iterator(m_root.prev));
+}
+
+template<typename T, typename HookPolicy>
+void IntrusiveList<T, HookPolicy>::pop_front()
+{
+    if (empty()) throw std::invalid_argument("pop_front() on empty IntrusiveList");
+
+    erase(begin());
+}
+
+template<typename T, typename HookPolicy>
+void IntrusiveList<T, HookPolicy>::move_to(iterator pos, T& value) noexcept
+{
+    Node* node = to_node(value);
+    if (node == pos.node()) return;
+
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    link_before(pos.node(), node);
+}
+
+template<typename T, typename HookPolicy>
+void IntrusiveList<T, HookPolicy>::clear() noexcept
+{
+    Node* node = m_root.next;
+    while (node != &m_root)
+    {
+        Node* next = node->next;
+        node->next = node->prev = nullptr;
+        node = next;
+    }
+
+    m_root.next = m_root.prev = &m_root;
+    m_size = 0;
+}
+
+template<typename T, typename HookPolicy>
+void IntrusiveList<T, HookPolicy>::swap(IntrusiveList& other) noexcept
+{
+    std::swap(m_root, other.m_root);
+    std::swap(m_size, other.m_size);
+
+    // Boundary nodes point to the root of the list they were moved to
+    for (IntrusiveList* list : {this, &other})
+    {
+        if (list->m_size == 0)
+        {
+            list->m_root.next = list->m_root.prev = &list->m_root;
+        }
+        else
+        {
+            list->m_root.next->prev = &list->m_root;
+            list->m_root.prev->next = &list->m_root;
+        }
+    }
+}
+
+} // namespace AlgoStruct
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "HazardPointers.hpp"
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+
+namespace AlgoStruct
+{
+// Michael-Scott queue: lock-free FIFO on singly linked nodes with a dummy head node.
+//
+//   m_head                      m_tail
+//     v                           v
+//   [dummy] -> [value] -> ... -> [value] -> nullptr
+//
+// push() links a node after the tail with CAS and then swings m_tail, pop() swings m_head to
+// the next node, which becomes the new dummy after its value is taken. A thread that finds
+// m_tail lagging behind helps to advance it. Removed nodes are retired to hazard pointers
+// domain, which protects from use after free and ABA.
+template<typename T>
+class LockFreeQueue
+{
+    struct Node
+    {
+        T* value_ptr() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+
+        std::atomic<Node*> next{nullptr};
+        // Value is constructed on push and destroyed on pop, dummy node has no value
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+public:
+    LockFreeQueue();
+    ~LockFreeQueue();
+
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator= (const LockFreeQueue&) = delete;
+
+    void push(const T& value) { emplace(value); }
+    void push(T&& value) { emplace(std::move(value)); }
+
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    // Removes front element, empty optional if the queue is empty
+    std::optional<T> pop();
+
+    // Snapshot, may be outdated immediately in concurrent use
+    bool empty() const;
+
+private:
+    std::atomic<Node*> m_head;
+    std::atomic<Node*> m_tail;
+};
+
+template<typename T>
+LockFreeQueue<T>::LockFreeQueue()
+{
+    auto* dummy = new Node;
+    m_head.store(dummy, std::memory_order_relaxed);
+    m_tail.store(dummy, std::memory_order_relaxed);
+}
+
+template<typename T>
+LockFreeQueue<T>::~LockFreeQueue()
+{
+    // No concurrent access during destruction
+    Node* node = m_head.load(std::memory_order_acquire);
+    Node* next = node->next.load(std::memory_order_relaxed);
+    delete node;
+
+    for (node = next; node; node = next)
+    {
+        next = node->next.load(std::memory_order_relaxed);
+        std::destroy_at(node->value_ptr());
+        delete node;
+    }
+}
+
+template<typename T>
+template<typename... Args>
+void LockFreeQueue<T>::emplace(Args&&... args)
+{
+    auto node = std::make_unique<Node>();
+    new (node->storage) T(std::forward<Args>(args)...);
+
+    auto& domain = HazardPointerDomain::global();
+
+    while (true)
+    {
+        Node* tail = domain.protect(0, m_tail);
+        Node* next = tail->next.load(std::memory_order_acquire);
+
+        if (next)
+        {
+            // Tail is lagging: help the other push to finish
+            m_tail.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (tail->next.compare_exchange_weak(next, node.get(), std::memory_order_release, std::memory_order_relaxed))
+        {
+            // May fail if another thread has already advanced the tail
+            m_tail.compare_exchange_strong(tail, node.release(), std::memory_order_release, std::memory_order_relaxed);
+            break;
+        }
+    }
+
+    domain.clear(0);
+}
+
+template<typename T>
+std::optional<T> LockFreeQueue<T>::pop()
+{
+    auto& domain = HazardPointerDomain::global();
+
+    while (true)
+    {
+        Node* head = domain.protect(0, m_head);
+        Node* next = domain.protect(1, head->next);
+
+        if (head != m_head.load(std::memory_order_acquire))
+        {
+            continue;
+        }
+
+        if (!next)
+        {
+            domain.clear(0);
+            domain.clear(1);
+            return std::nullopt;
+        }
+
+        // Keep tail from pointing to a removed node
+        Node* tail = m_tail.load(std::memory_order_acquire);
+        if (head == tail)
+        {
+            m_tail.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (m_head.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            // Next node is the new dummy: nobody else reads its value
+            std::optional<T> value(std::move(*next->value_ptr()));
+            std::destroy_at(next->value_ptr());
+
+            domain.clear(0);
+            domain.clear(1);
+            domain.retire(head);
+            return value;
+        }
+    }
+}
+
+template<typename T>
+bool LockFreeQueue<T>::empty() const
+{
+    auto& domain = HazardPointerDomain::global();
+
+    Node* head = domain.protect(0, m_head);
+    const bool result = head->next.load(std::memory_order_acquire) == nullptr;
+    domain.clear(0);
+
+    return result;
+}
+
+} // namespace AlgoStruct
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "HazardPointers.hpp"
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace AlgoStruct
+{
+// Treiber stack: lock-free LIFO on singly linked nodes (same node model as ForwardList).
+//
+//   m_head -> [value | next] -> [value | next] -> nullptr
+//
+// push() and pop() swing m_head with CAS. Popped nodes are retired to hazard pointers domain,
+// so a node is not freed while another thread reads its next pointer and CAS on m_head
+// can not succeed with a recycled node address (ABA).
+template<typename T>
+class LockFreeStack
+{
+    struct Node
+    {
+        template<typename... Args>
+        explicit Node(Args&&... args): value(std::forward<Args>(args)...) {}
+
+        T value;
+        Node* next = nullptr;
+    };
+
+public:
+    LockFreeStack() = default;
+    ~LockFreeStack();
+
+    LockFreeStack(const LockFreeStack&) = delete;
+    LockFreeStack& operator= (const LockFreeStack&) = delete;
+
+    void push(const T& value) { emplace(value); }
+    void push(T&& value) { emplace(std::move(value)); }
+
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    // Removes top element, empty optional if the stack is empty
+    std::optional<T> pop();
+
+    // Snapshot, may be outdated immediately in concurrent use
+    bool empty() const noexcept { return m_head.load(std::memory_order_acquire) == nullptr; }
+
+private:
+    std::atomic<Node*> m_head{nullptr};
+};
+
+template<typename T>
+LockFreeStack<T>::~LockFreeStack()
+{
+    // No concurrent access during destruction
+    Node* node = m_head.load(std::memory_order_acquire);
+    while (node)
+    {
+        Node* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+template<typename T>
+template<typename... Args>
+void LockFreeStack<T>::emplace(Args&&... args)
+{
+    auto* node = new Node(std::forward<Args>(args)...);
+    node->next = m_head.load(std::memory_order_relaxed);
+
+    while (!m_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+}
+
+template<typename T>
+std::optional<T> LockFreeStack<T>::pop()
+{
+    auto& domain = HazardPointerDomain::global();
+
+    while (true)
+    {
+        Node* head = domain.protect(0, m_head);
+        if (!head)
+        {
+            domain.clear(0);
+            return std::nullopt;
+        }
+
+        // Node is protected, its next pointer is immutable after push
+        if (m_head.compare_exchange_weak(head, head->next, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            domain.clear(0);
+
+            std::optional<T> value(std::move(head->value));
+            domain.retire(head);
+            return value;
+        }
+    }
+}
+
+} // namespace AlgoStruct
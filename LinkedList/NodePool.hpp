@@ -0,0 +1,312 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <unordered_set>
+#include <utility>
+
+namespace AlgoStruct
+{
+// Slab allocator for list nodes.
+//
+// Nodes are carved from blocks of growing size, freed nodes are kept in an intrusive
+// free-list and reused by the next allocation:
+//
+//   blocks ---> [hdr | n n n n n n n n] -> [hdr | n n n n] -> nullptr
+//                          ^     ^
+//   m_freeList ------------'     '-- slot of a destroyed node, stores pointer to next free slot
+//
+// release() frees all blocks at once in O(blocks): the owner must have destroyed the nodes
+// (or they have trivial destructors).
+//
+// Blocks are ref-counted as a whole (arena), so nodes can move between pools without
+// copying: after share(other) this pool keeps the arenas of other alive and may destroy
+// nodes carved by other, their slots are recycled by this pool. adopt(other) does the same
+// for a pool whose nodes all move here and leaves other empty. Arena shared with another
+// pool does not grow, new blocks go to a fresh one. Retained arenas are dropped by trim()
+// once the owner has no nodes left. Not thread-safe, but pools which share arenas may be
+// used from different threads.
+template<typename Node>
+class NodePool
+{
+    union Slot
+    {
+        Slot* next;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    struct BlockHeader
+    {
+        BlockHeader* next = nullptr;
+        size_t capacity = 0;
+    };
+
+    // Blocks of one pool, most recent first
+    struct Arena
+    {
+        Arena() = default;
+        Arena(const Arena&) = delete;
+        Arena& operator= (const Arena&) = delete;
+        ~Arena();
+
+        BlockHeader* blocks = nullptr;
+    };
+
+    static constexpr size_t BlockAlignment = std::max(alignof(Slot), alignof(BlockHeader));
+    // Slots start after the header, aligned for Slot
+    static constexpr size_t SlotsOffset = (sizeof(BlockHeader) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+    static constexpr size_t MinBlockCapacity = 16;
+    static constexpr size_t MaxBlockCapacity = 4096;
+
+public:
+    NodePool() = default;
+    ~NodePool() { release(); }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator= (const NodePool&) = delete;
+    NodePool(NodePool&& other) noexcept { this->swap(other); }
+    NodePool& operator= (NodePool&& other) noexcept
+    {
+        NodePool tmp(std::move(other));
+        this->swap(tmp);
+        return *this;
+    }
+
+    // Allocates memory for a node and constructs it
+    template<typename... Args>
+    Node* create(Args&&... args)
+    {
+        void* slot = allocate();
+        try
+        {
+            return new (slot) Node(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            deallocate(slot);
+            throw;
+        }
+    }
+
+    // Destroys a node and returns its memory to the free-list
+    void destroy(Node* node) noexcept
+    {
+        node->~Node();
+        deallocate(node);
+    }
+
+    void* allocate();
+    void deallocate(void* ptr) noexcept;
+
+    // Frees all blocks which are not shared. Nodes allocated from the pool become invalid
+    void release() noexcept;
+
+    // Keeps the blocks of other alive while this pool lives: nodes of other may be moved
+    // to this pool owner and destroyed by this pool. O(arenas of other)
+    void share(const NodePool& other);
+
+    // Takes the arenas of other, whose nodes all move to this pool owner, and releases other.
+    // Smaller set of arenas is merged into the larger one, so an arena is moved O(log n) times
+    // over all adoptions, n being the number of arenas
+    void adopt(NodePool& other);
+
+    // Drops retained arenas and the free-list when the owner has no nodes left.
+    // Own arena keeps only its most recent block, carving restarts from it
+    void trim() noexcept;
+
+    // Blocks of the arena the pool carves from
+    size_t block_count() const noexcept;
+    void swap(NodePool& other) noexcept;
+
+private:
+    Slot* slots(BlockHeader* block) noexcept
+    {
+        return reinterpret_cast<Slot*>(reinterpret_cast<unsigned char*>(block) + SlotsOffset);
+    }
+
+    static void free_blocks(BlockHeader* blocks) noexcept;
+
+    void allocate_block();
+    void retain(const std::shared_ptr<Arena>& arena);
+
+private:
+    std::shared_ptr<Arena> m_arena;                          // Blocks to carve from
+    std::unordered_set<std::shared_ptr<Arena>> m_retained;   // Other arenas this pool may hold nodes of, keyed by address
+    Slot* m_freeList = nullptr;
+    size_t m_carved = 0;                            // Slots carved from the most recent block
+};
+
+template<typename Node>
+NodePool<Node>::Arena::~Arena()
+{
+    free_blocks(blocks);
+}
+
+template<typename Node>
+void NodePool<Node>::free_blocks(BlockHeader* blocks) noexcept
+{
+    while (blocks)
+    {
+        BlockHeader* next = blocks->next;
+        ::operator delete(blocks, std::align_val_t{BlockAlignment});
+        blocks = next;
+    }
+}
+
+template<typename Node>
+void* NodePool<Node>::allocate()
+{
+    if (m_freeList)
+    {
+        Slot* slot = m_freeList;
+        m_freeList = slot->next;
+        return slot;
+    }
+
+    if (!m_arena || !m_arena->blocks || m_carved == m_arena->blocks->capacity)
+    {
+        allocate_block();
+    }
+
+    return &slots(m_arena->blocks)[m_carved++];
+}
+
+template<typename Node>
+void NodePool<Node>::deallocate(void* ptr) noexcept
+{
+    auto* slot = static_cast<Slot*>(ptr);
+    slot->next = m_freeList;
+    m_freeList = slot;
+}
+
+template<typename Node>
+void NodePool<Node>::release() noexcept
+{
+    m_arena.reset();
+    m_retained.clear();
+    m_freeList = nullptr;
+    m_carved = 0;
+}
+
+template<typename Node>
+void NodePool<Node>::share(const NodePool& other)
+{
+    if (this == &other) return;
+
+    // Nodes of other may come from the arenas it shares too
+    if (other.m_arena)
+    {
+        retain(other.m_arena);
+    }
+    for (const auto& arena : other.m_retained)
+    {
+        retain(arena);
+    }
+}
+
+template<typename Node>
+void NodePool<Node>::adopt(NodePool& other)
+{
+    if (this == &other) return;
+
+    // Nothing of our own to keep: take the pool of other as is
+    if (!m_arena && m_retained.empty())
+    {
+        this->swap(other);
+        return;
+    }
+
+    if (m_retained.size() < other.m_retained.size())
+    {
+        std::swap(m_retained, other.m_retained);
+    }
+    m_retained.insert(other.m_retained.begin(), other.m_retained.end());
+    if (other.m_arena)
+    {
+        m_retained.insert(other.m_arena);
+    }
+    // Set of other may have held our arena
+    m_retained.erase(m_arena);
+
+    // Free slots of other are reused if ours are exhausted, otherwise left until trim()
+    if (!m_freeList)
+    {
+        m_freeList = other.m_freeList;
+    }
+
+    other.release();
+}
+
+template<typename Node>
+void NodePool<Node>::trim() noexcept
+{
+    m_retained.clear();
+    m_freeList = nullptr;
+    m_carved = 0;
+
+    // Arena still holding nodes of other pools is left to them
+    if (m_arena.use_count() > 1)
+    {
+        m_arena.reset();
+    }
+    else if (m_arena && m_arena->blocks)
+    {
+        free_blocks(m_arena->blocks->next);
+        m_arena->blocks->next = nullptr;
+    }
+}
+
+template<typename Node>
+size_t NodePool<Node>::block_count() const noexcept
+{
+    size_t count = 0;
+    for (const BlockHeader* block = m_arena ? m_arena->blocks : nullptr; block; block = block->next)
+    {
+        ++count;
+    }
+    return count;
+}
+
+template<typename Node>
+void NodePool<Node>::swap(NodePool& other) noexcept
+{
+    std::swap(m_arena, other.m_arena);
+    std::swap(m_retained, other.m_retained);
+    std::swap(m_freeList, other.m_freeList);
+    std::swap(m_carved, other.m_carved);
+}
+
+template<typename Node>
+void NodePool<Node>::allocate_block()
+{
+    // Blocks grow geometrically, so small lists stay small and large ones need few blocks
+    const BlockHeader* last = m_arena ? m_arena->blocks : nullptr;
+    const size_t capacity = last ? std::min(last->capacity * 2, MaxBlockCapacity) : MinBlockCapacity;
+
+    // Other pools holding the arena would keep new blocks alive as well
+    if (!m_arena || m_arena.use_count() > 1)
+    {
+        if (m_arena)
+        {
+            m_retained.insert(std::move(m_arena));
+        }
+        m_arena = std::make_shared<Arena>();
+    }
+
+    void* memory = ::operator new(SlotsOffset + capacity * sizeof(Slot), std::align_val_t{BlockAlignment});
+    m_arena->blocks = new (memory) BlockHeader{m_arena->blocks, capacity};
+    m_carved = 0;
+}
+
+template<typename Node>
+void NodePool<Node>::retain(const std::shared_ptr<Arena>& arena)
+{
+    if (arena != m_arena)
+    {
+        m_retained.insert(arena);
+    }
+}
+
+} // namespace AlgoStruct
@@ -0,0 +1,453 @@
+#pragma once
+
+#include "NodePool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace AlgoStruct
+{
+namespace detail
+{
+// xorshift64*: a few cycles per number, state is per thread and seeded by its address
+inline uint64_t skip_list_random() noexcept
+{
+    thread_local uint64_t state = 0x9E3779B97F4A7C15ull ^ reinterpret_cast<uintptr_t>(&state);
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545F4914F6CDD1Dull;
+}
+
+// Geometric level with p = 1/4: each pair of trailing zero bits is one more level
+template<size_t MaxLevel>
+size_t random_skip_list_level() noexcept
+{
+    const size_t level = 1 + static_cast<size_t>(std::countr_zero(skip_list_random())) / 2;
+    return std::min(level, MaxLevel);
+}
+
+} // namespace detail
+
+// Ordered map on a skip list: a sorted singly linked list with express lanes.
+//
+//   level 2: head ----------------------------> [7] ----------------> nullptr
+//   level 1: head ----------> [3] ------------> [7] ------> [12] ---> nullptr
+//   level 0: head --> [1] --> [3] --> [5] ----> [7] -> [9] -> [12] -> nullptr
+//
+// Each node gets a random height (1 with p = 3/4, 2 with p = 3/16, ...), its links are stored
+// right after the node in the same allocation. Search goes right while the next key is less
+// and down otherwise: O(log n) expected. Nodes of height 1 are most of the list and come from
+// NodePool, taller ones from operator new. Keys are unique.
+template<typename Key, typename Value, typename Compare = std::less<Key>>
+class SkipList
+{
+public:
+    static constexpr size_t MaxLevel = 32;
+
+private:
+    struct Node
+    {
+        template<typename... Args>
+        explicit Node(size_t lvl, Args&&... args)
+            : value(std::forward<Args>(args)...)
+            , level(static_cast<uint8_t>(lvl))
+        {}
+
+        std::pair<const Key, Value> value;
+        uint8_t level;
+    };
+
+    static constexpr size_t NodeAlignment = std::max(alignof(Node), alignof(Node*));
+    static constexpr size_t TowerOffset = (sizeof(Node) + alignof(Node*) - 1) / alignof(Node*) * alignof(Node*);
+
+    // Memory of a node with height 1
+    struct alignas(NodeAlignment) ShortNode
+    {
+        unsigned char bytes[TowerOffset + sizeof(Node*)];
+    };
+
+    // Links of a node: next node on each level of its height
+    static Node** links(Node* node) noexcept
+    {
+        return std::launder(reinterpret_cast<Node**>(reinterpret_cast<unsigned char*>(node) + TowerOffset));
+    }
+
+    template<typename V>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::remove_const_t<V>;
+        using pointer = V*;
+        using reference = V&;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        explicit Iterator(Node* node): m_node(node) {}
+
+        // iterator -> const_iterator
+        template<typename U, typename = std::enable_if_t<std::is_const_v<V> && !std::is_same_v<U, V>>>
+        Iterator(const Iterator<U>& other): m_node(other.m_node) {}
+
+        reference operator* () const { return m_node->value; }
+        pointer operator-> () const { return &m_node->value; }
+
+        Iterator& operator++ ()
+        {
+            m_node = links(m_node)[0];
+            return *this;
+        }
+        Iterator operator++ (int)
+        {
+            Iterator ret = *this;
+            ++(*this);
+            return ret;
+        }
+
+        friend bool operator== (const Iterator& lhs, const Iterator& rhs) { return lhs.m_node == rhs.m_node; }
+        friend bool operator!= (const Iterator& lhs, const Iterator& rhs) { return lhs.m_node != rhs.m_node; }
+
+    private:
+        friend class SkipList;
+        template<typename> friend class Iterator;
+
+        Node* m_node = nullptr;
+    };
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+    using key_compare = Compare;
+    using size_type = size_t;
+    using iterator = Iterator<value_type>;
+    using const_iterator = Iterator<const value_type>;
+
+    SkipList() = default;
+    explicit SkipList(const Compare& compare): m_compare(compare) {}
+    SkipList(std::initializer_list<value_type> values, const Compare& compare = Compare());
+    ~SkipList() { clear(); }
+
+    SkipList(const SkipList& other);
+    SkipList& operator= (const SkipList& other);
+    SkipList(SkipList&& other) noexcept { this->swap(other); }
+    SkipList& operator= (SkipList&& other) noexcept;
+
+    // Inserts value if its key is not present. Returns element with the key and insertion flag
+    std::pair<iterator, bool> insert(const value_type& value) { return try_emplace(value.first, value.second); }
+    std::pair<iterator, bool> insert(value_type&& value) { return try_emplace(value.first, std::move(value.second)); }
+
+    // Constructs mapped value from args only if the key is not present
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+
+    // Returns number of erased elements (0 or 1)
+    size_t erase(const Key& key);
+    // Returns iterator following the erased element
+    iterator erase(const_iterator pos);
+
+    iterator find(const Key& key) { return iterator(find_node(key)); }
+    const_iterator find(const Key& key) const { return const_iterator(find_node(key)); }
+    bool contains(const Key& key) const { return find_node(key) != nullptr; }
+
+    // First element with key not less than / greater than the given one
+    iterator lower_bound(const Key& key) { return iterator(lower_bound_node(key)); }
+    const_iterator lower_bound(const Key& key) const { return const_iterator(lower_bound_node(key)); }
+    iterator upper_bound(const Key& key) { return iterator(upper_bound_node(key)); }
+    const_iterator upper_bound(const Key& key) const { return const_iterator(upper_bound_node(key)); }
+
+    iterator begin() noexcept { return iterator(m_head[0]); }
+    iterator end() noexcept { return iterator(); }
+    const_iterator begin() const noexcept { return const_iterator(m_head[0]); }
+    const_iterator end() const noexcept { return const_iterator(); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+    void clear() noexcept;
+    void swap(SkipList& other) noexcept;
+
+private:
+    template<typename... Args>
+    Node* create_node(size_t level, Args&&... args);
+    void destroy_node(Node* node) noexcept;
+
+    // Fills update with the link preceding key on each used level, returns first node not less than key
+    Node* find_predecessors(const Key& key, Node** update[]);
+    Node* lower_bound_node(const Key& key) const;
+    Node* upper_bound_node(const Key& key) const;
+    Node* find_node(const Key& key) const;
+
+    // Appends values of a sorted range at the end in O(1) per element
+    template<typename It>
+    void append_sorted(It first, It last);
+
+private:
+    std::array<Node*, MaxLevel> m_head{};
+    size_t m_level = 1;     // Number of levels in use
+    size_t m_size = 0;
+    NodePool<ShortNode> m_pool;
+    [[no_unique_address]] Compare m_compare;
+};
+
+template<typename Key, typename Value, typename Compare>
+SkipList<Key, Value, Compare>::SkipList(std::initializer_list<value_type> values, const Compare& compare)
+    : m_compare(compare)
+{
+    for (const auto& value : values)
+    {
+        insert(value);
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+SkipList<Key, Value, Compare>::SkipList(const SkipList& other)
+    : m_compare(other.m_compare)
+{
+    try
+    {
+        append_sorted(other.begin(), other.end());
+    }
+    catch (...)
+    {
+        clear();
+        throw;
+    }
+}
+
+template<typename Key, typename Value, typename Compare>
+SkipList<Key, Value, Compare>& SkipList<Key, Value, Compare>::operator= (const SkipList& other)
+{
+    if (this != &other)
+    {
+        SkipList tmp(other);
+        this->swap(tmp);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Compare>
+SkipList<Key, Value, Compare>& SkipList<Key, Value, Compare>::operator= (SkipList&& other) noexcept
+{
+    SkipList tmp(std::move(other));
+    this->swap(tmp);
+    return *this;
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename... Args>
+std::pair<typename SkipList<Key, Value, Compare>::iterator, bool> SkipList<Key, Value, Compare>::try_emplace(const Key& key, Args&&... args)
+{
+    Node** update[MaxLevel];
+    Node* found = find_predecessors(key, update);
+    if (found && !m_compare(key, found->value.first))
+    {
+        return {iterator(found), false};
+    }
+
+    const size_t level = detail::random_skip_list_level<MaxLevel>();
+    Node* node = create_node(level, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+
+    for (size_t i = m_level; i < level; ++i)
+    {
+        update[i] = &m_head[i];
+    }
+    m_level = std::max(m_level, level);
+
+    Node** next = links(node);
+    for (size_t i = 0; i < level; ++i)
+    {
+        next[i] = *update[i];
+        *update[i] = node;
+    }
+
+    ++m_size;
+    return {iterator(node), true};
+}
+
+template<typename Key, typename Value, typename Compare>
+size_t SkipList<Key, Value, Compare>::erase(const Key& key)
+{
+    Node** update[MaxLevel];
+    Node* found = find_predecessors(key, update);
+    if (!found || m_compare(key, found->value.first))
+    {
+        return 0;
+    }
+
+    // On each level of the node the preceding link points to it
+    Node** next = links(found);
+    for (size_t i = 0; i < found->level; ++i)
+    {
+        *update[i] = next[i];
+    }
+
+    while (m_level > 1 && !m_head[m_level - 1])
+    {
+        --m_level;
+    }
+
+    destroy_node(found);
+    --m_size;
+    return 1;
+}
+
+template<typename Key, typename Value, typename Compare>
+typename SkipList<Key, Value, Compare>::iterator SkipList<Key, Value, Compare>::erase(const_iterator pos)
+{
+    iterator next(links(pos.m_node)[0]);
+    erase(pos->first);
+    return next;
+}
+
+template<typename Key, typename Value, typename Compare>
+void SkipList<Key, Value, Compare>::clear() noexcept
+{
+    Node* node = m_head[0];
+    while (node)
+    {
+        Node* next = links(node)[0];
+        destroy_node(node);
+        node = next;
+    }
+
+    m_head.fill(nullptr);
+    m_level = 1;
+    m_size = 0;
+}
+
+template<typename Key, typename Value, typename Compare>
+void SkipList<Key, Value, Compare>::swap(SkipList& other) noexcept
+{
+    std::swap(m_head, other.m_head);
+    std::swap(m_level, other.m_level);
+    std::swap(m_size, other.m_size);
+    m_pool.swap(other.m_pool);
+    std::swap(m_compare, other.m_compare);
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename... Args>
+auto SkipList<Key, Value, Compare>::create_node(size_t level, Args&&... args) -> Node*
+{
+    void* memory = (level == 1) ? m_pool.allocate() : ::operator new(TowerOffset + level * sizeof(Node*), std::align_val_t{NodeAlignment});
+
+    Node* node = nullptr;
+    try
+    {
+        node = new (memory) Node(level, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        if (level == 1) m_pool.deallocate(memory);
+        else ::operator delete(memory, std::align_val_t{NodeAlignment});
+        throw;
+    }
+
+    std::uninitialized_fill_n(reinterpret_cast<Node**>(reinterpret_cast<unsigned char*>(node) + TowerOffset), level, nullptr);
+    return node;
+}
+
+template<typename Key, typename Value, typename Compare>
+void SkipList<Key, Value, Compare>::destroy_node(Node* node) noexcept
+{
+    const size_t level = node->level;
+    node->~Node();
+
+    if (level == 1) m_pool.deallocate(node);
+    else ::operator delete(node, std::align_val_t{NodeAlignment});
+}
+
+template<typename Key, typename Value, typename Compare>
+auto SkipList<Key, Value, Compare>::find_predecessors(const Key& key, Node** update[]) -> Node*
+{
+    // Links of the head or of the last visited node
+    Node** current = m_head.data();
+    for (size_t level = m_level; level-- > 0; )
+    {
+        while (current[level] && m_compare(current[level]->value.first, key))
+        {
+            current = links(current[level]);
+        }
+        update[level] = &current[level];
+    }
+    return current[0];
+}
+
+template<typename Key, typename Value, typename Compare>
+auto SkipList<Key, Value, Compare>::lower_bound_node(const Key& key) const -> Node*
+{
+    Node* const* current = m_head.data();
+    for (size_t level = m_level; level-- > 0; )
+    {
+        while (current[level] && m_compare(current[level]->value.first, key))
+        {
+            current = links(current[level]);
+        }
+    }
+    return current[0];
+}
+
+template<typename Key, typename Value, typename Compare>
+auto SkipList<Key, Value, Compare>::upper_bound_node(const Key& key) const -> Node*
+{
+    Node* const* current = m_head.data();
+    for (size_t level = m_level; level-- > 0; )
+    {
+        while (current[level] && !m_compare(key, current[level]->value.first))
+        {
+            current = links(current[level]);
+        }
+    }
+    return current[0];
+}
+
+template<typename Key, typename Value, typename Compare>
+auto SkipList<Key, Value, Compare>::find_node(const Key& key) const -> Node*
+{
+    Node* node = lower_bound_node(key);
+    return (node && !m_compare(key, node->value.first)) ? node : nullptr;
+}
+
+template<typename Key, typename Value, typename Compare>
+template<typename It>
+void SkipList<Key, Value, Compare>::append_sorted(It first, It last)
+{
+    // Last link on each level
+    Node** tails[MaxLevel];
+    for (size_t i = 0; i < MaxLevel; ++i)
+    {
+        tails[i] = &m_head[i];
+    }
+
+    for (; first != last; ++first)
+    {
+        const size_t level = detail::random_skip_list_level<MaxLevel>();
+        Node* node = create_node(level, *first);
+
+        Node** next = links(node);
+        for (size_t i = 0; i < level; ++i)
+        {
+            *tails[i] = node;
+            tails[i] = &next[i];
+        }
+
+        m_level = std::max(m_level, level);
+        ++m_size;
+    }
+}
+
+} // namespace AlgoStruct
@@ -0,0 +1,594 @@
+#pragma once
+
+#include "NodePool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace AlgoStruct
+{
+    namespace detail
+    {
+        // Elements per node: node (next pointer + counter + elements) spans several cache lines
+        template <typename T>
+        constexpr size_t unrolled_node_capacity()
+        {
+            constexpr size_t cache_line_size = 64;
+            constexpr size_t node_bytes = 4 * cache_line_size;
+            constexpr size_t header_bytes = sizeof(void*) + sizeof(size_t);
+
+            return std::max<size_t>(1, (node_bytes - header_bytes) / sizeof(T));
+        }
+    } // namespace detail
+
+    // Unidirectional list storing up to Capacity elements in each node:
+    //
+    //   head                             tail
+    //    v                                v
+    //   [a b c d - -] -> [e f - - - -] -> [g h i - - -] -> nullptr
+    //
+    // Traversal touches one node per Capacity elements instead of one node per element.
+    // Elements are shifted inside a node on insertion/removal, a full node is split in two.
+    // Note: unlike ForwardList, insertions and removals move elements of the affected node,
+    // so iterators to other elements of that node are invalidated.
+    template <typename T, size_t Capacity = detail::unrolled_node_capacity<T>()>
+    class UnrolledForwardList
+    {
+        static_assert(Capacity > 0, "node must store at least one element");
+
+        struct Node
+        {
+            Node* next = nullptr;
+            size_t count = 0;
+            alignas(T) unsigned char storage[sizeof(T) * Capacity];
+
+            T* values() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+        };
+
+    public:
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = T;
+            using pointer = T*;
+            using reference = T&;
+
+            Iterator() = default;
+            Iterator(Node* node, size_t idx): m_node(node), m_idx(idx) {}
+
+            reference operator* () const { return m_node->values()[m_idx]; }
+            pointer operator-> () const { return &m_node->values()[m_idx]; }
+
+            Iterator& operator++ ()
+            {
+                if (++m_idx == m_node->count)
+                {
+                    m_node = m_node->next;
+                    m_idx = 0;
+                }
+                return *this;
+            }
+
+            Iterator operator++ (int)
+            {
+                Iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            friend bool operator== (const Iterator& lhs, const Iterator& rhs) noexcept
+            {
+                return lhs.m_node == rhs.m_node && lhs.m_idx == rhs.m_idx;
+            }
+
+            friend bool operator!= (const Iterator& lhs, const Iterator& rhs) noexcept
+            {
+                return !(lhs == rhs);
+            }
+
+            operator bool () const
+            {
+                return m_node != nullptr;
+            }
+
+            Iterator& operator+= (difference_type n)
+            {
+                while (n--)
+                {
+                    ++*this;
+                }
+
+                return *this;
+            }
+
+        private:
+            friend UnrolledForwardList;
+            Node* m_node = nullptr;
+            size_t m_idx = 0;
+        };
+
+        using value_type = T;
+        using size_type = size_t;
+        using iterator = Iterator;
+
+        static constexpr size_t node_capacity = Capacity;
+
+        UnrolledForwardList() = default;
+        UnrolledForwardList(std::initializer_list<T> il);
+        ~UnrolledForwardList();
+
+        UnrolledForwardList(const UnrolledForwardList& other);
+        UnrolledForwardList& operator= (const UnrolledForwardList& other);
+        UnrolledForwardList(UnrolledForwardList&& other) noexcept;
+        UnrolledForwardList& operator= (UnrolledForwardList&& other) noexcept;
+
+        // Iterators getters
+        Iterator begin() const noexcept { return Iterator(m_head, 0); }
+        Iterator end() const noexcept { return Iterator(nullptr, 0); }
+
+        // Size checkers
+        bool empty() const noexcept { return m_size == 0; }
+        size_t size() const noexcept { return m_size; }
+
+        // Inserts an element to the list
+        void push_front(const T& value) { push_front_value(value); }
+        void push_front(T&& value) { push_front_value(std::move(value)); }
+        void push_back(const T& value) { push_back_value(value); }
+        void push_back(T&& value) { push_back_value(std::move(value)); }
+
+        // Removes a head element from the list
+        void pop_front();
+
+        // Get access to head element value
+        T& front();
+        const T& front() const;
+
+        // Get access to tail alement value
+        T& back();
+        const T& back() const;
+
+        // Inserts element after an desired place. If the node is split, it is updated to keep
+        // pointing to the same element
+        void insert_after(Iterator& it, const T& value);
+
+        // Removes an element after desired element
+        Iterator erase_after(Iterator& it);
+
+        // Reverses the order of the elements
+        void reverse();
+
+        // Clears the contents of the list
+        void clear();
+
+        // Sorts elements in non-descending order, nodes are packed afterwards
+        void sort();
+
+        void swap(UnrolledForwardList& other) noexcept;
+
+    private:
+        Node* create_node(Node* next);
+        void destroy_node(Node* node) noexcept;
+
+        // Node holding just value, not linked yet: if the value constructor throws, the node
+        // is destroyed and the list stays untouched
+        template <typename U>
+        Node* create_node_with(Node* next, U&& value);
+
+        // Value goes to the head/tail node, or to a new node linked if it's full
+        template <typename U>
+        void push_front_value(U&& value);
+        template <typename U>
+        void push_back_value(U&& value);
+
+        // Inserts value at position idx of the node, which has a free slot
+        template <typename U>
+        void insert_into(Node* node, size_t idx, U&& value);
+        // Removes value at position idx of the node
+        void erase_from(Node* node, size_t idx) noexcept;
+
+    private:
+        Node* m_head = nullptr;
+        Node* m_tail = nullptr;
+        size_t m_size = 0;
+        NodePool<Node> m_pool;
+    };
+
+    template <typename T, size_t Capacity>
+    UnrolledForwardList<T, Capacity>::UnrolledForwardList(std::initializer_list<T> il)
+    {
+        for (const auto& elem : il)
+        {
+            push_back(elem);
+        }
+    }
+
+    template <typename T, size_t Capacity>
+    UnrolledForwardList<T, Capacity>::~UnrolledForwardList()
+    {
+        clear();
+    }
+
+    template <typename T, size_t Capacity>
+    UnrolledForwardList<T, Capacity>::UnrolledForwardList(const UnrolledForwardList& other)
+    {
+        for (const auto& elem : other)
+        {
+            push_back(elem);
+        }
+    }
+
+    template <typename T, size_t Capacity>
+    auto UnrolledForwardList<T, Capacity>::operator= (const UnrolledForwardList& other) -> UnrolledForwardList&
+    {
+        if (this != &other)
+        {
+            UnrolledForwardList tmp(other);
+            swap(tmp);
+        }
+
+        return *this;
+    }
+
+    template <typename T, size_t Capacity>
+    UnrolledForwardList<T, Capacity>::UnrolledForwardList(UnrolledForwardList&& other) noexcept
+    {
+        swap(other);
+    }
+
+    template <typename T, size_t Capacity>
+    auto UnrolledForwardList<T, Capacity>::operator= (UnrolledForwardList&& other) noexcept -> UnrolledForwardList&
+    {
+        UnrolledForwardList tmp(std::move(other));
+        swap(tmp);
+        return *this;
+    }
+
+    template <typename T, size_t Capacity>
+    template <typename U>
+    void UnrolledForwardList<T, Capacity>::push_front_value(U&& value)
+    {
+        if (m_head && m_head->count < Capacity)
+        {
+            insert_into(m_head, 0, std::forward<U>(value));
+            return;
+        }
+
+        m_head = create_node_with(m_head, std::forward<U>(value));
+        ++m_size;
+
+        if (!m_tail)
+        {
+            m_tail = m_head;
+        }
+    }
+
+    template <typename T, size_t Capacity>
+    template <typename U>
+    void UnrolledForwardList<T, Capacity>::push_back_value(U&& value)
+    {
+        if (m_tail && m_tail->count < Capacity)
+        {
+            insert_into(m_tail, m_tail->count, std::forward<U>(value));
+            return;
+        }
+
+        Node* new_node = create_node_with(nullptr, std::forward<U>(value));
+        ++m_size;
+
+        if (m_tail)
+        {
+            m_tail->next = new_node;
+        }
+        else
+        {
+            m_head = new_node;
+        }
+
+        m_tail = new_node;
+    }
+
+    template <typename T, size_t Capacity>
+    void UnrolledForwardList<T, Capacity>::pop_front()
+    {
+        if (!m_head)
+        {
+            return;
+        }
+
+        erase_from(m_head, 0);
+
+        if (m_head->count == 0)
+        {
+            Node* to_delete = m_head;
+            m_head = m_head->next;
+            destroy_node(to_delete);
+
+            if (!m_head)
+            {
+                m_tail = nullptr;
+            }
+        }
+    }
+
+    template <typename T, size_t Capacity>
+    T& UnrolledForwardList<T, Capacity>::front()
+    {
+        if (!m_head)
+        {
+            throw std::runtime_error("front() on empty list");
+        }
+
+        return m_head->values()[0];
+    }
+
+    template <typename T, size_t Capacity>
+    const T& UnrolledForwardList<T, Capacity>::front() const
+    {
+        return const_cast<UnrolledForwardList*>(this)->front();
+    }
+
+    template <typename T, size_t Capacity>
+    T& UnrolledForwardList<T, Capacity>::back()
+    {
+        if (!m_tail)
+        {
+            throw std::runtime_error("back() on empty list");
+        }
+
+        return m_tail->values()[m_tail->count - 1];
+    }
+
+    template <typename T, size_t Capacity>
+    const T& UnrolledForwardList<T, Capacity>::back() const
+    {
+        return const_cast<UnrolledForwardList*>(this)->back();
+    }
+
+    template <typename T, size_t Capacity>
+    void UnrolledForwardList<T, Capacity>::insert_after(Iterator& it, const T& value)
+    {
+        if (!it)
+        {
+            return;
+        }
+
+        Node* node = it.m_node;
+
+        if (node->count == Capacity && it.m_idx + 1 == Capacity)
+        {
+            // Inserting after the last element of a full node: value starts a new node
+            //   [a b c d] -> [a b c d] [x]
+            Node* new_node = create_node_with(node->next, value);
+            node->next = new_node;
+            ++m_size;
+
+            if (node == m_tail)
+            {
+                m_tail = new_node;
+            }
+
+            return;
+        }
+
+        if (node->count == Capacity)
+        {
+            // Split: upper half of the node moves to a new node after it
+            //   [a b c d] -> [a b] [c d]
+            // Here Capacity > 1 (see above), so both halves keep at least one element
+            Node* new_node = create_node(node->next);
+            const size_t keep = Capacity / 2 + Capacity % 2;
+
+            T* src = node->values();
+            std::uninitialized_move(src + keep, src + Capacity, new_node->values());
+            std::destroy(src + keep, src + Capacity);
+            new_node->count = Capacity - keep;
+            node->count = keep;
+            node->next = new_node;
+
+            if (node == m_tail)
+            {
+                m_tail = new_node;
+            }
+
+            if (it.m_idx >= keep)
+            {
+                it.m_node = new_node;
+                it.m_idx -= keep;
+            }
+        }
+
+        insert_into(it.m_node, it.m_idx + 1, value);
+    }
+
+    template <typename T, size_t Capacity>
+    auto UnrolledForwardList<T, Capacity>::erase_after(Iterator& it) -> Iterator
+    {
+        if (!it)
+        {
+            return end();
+        }
+
+        Node* node = it.m_node;
+        size_t idx = it.m_idx + 1;
+
+        if (idx == node->count)
+        {
+            // Erased element is the first one of the next node
+            if (!node->next)
+            {
+                return end();
+            }
+
+            node = node->next;
+            idx = 0;
+        }
+
+        erase_from(node, idx);
+
+        if (node->count == 0)
+        {
+            it.m_node->next = node->next;
+
+            if (node == m_tail)
+            {
+                m_tail = it.m_node;
+            }
+
+            destroy_node(node);
+            return Iterator(it.m_node->next, 0);
+        }
+
+        if (idx == node->count)
+        {
+            return Iterator(node->next, 0);
+        }
+
+        return Iterator(node, idx);
+    }
+
+    template <typename T, size_t Capacity>
+    void UnrolledForwardList<T, Capacity>::reverse()
+    {
+        m_tail = m_head;
+        Node* curr_node = m_head;
+        Node* prev_node = nullptr;
+
+        while (curr_node)
+        {
+            Node* node = curr_node;
+            curr_node = curr_node->next;
+
+            std::reverse(node->values(), node->values() + node->count);
+            node->next = prev_node;
+            prev_node = node;
+        }
+
+        m_head = prev_node;
+    }
+
+    template <typename T, size_t Capacity>
+    void UnrolledForwardList<T, Capacity>::clear()
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (Node* node = m_head; node; node = node->next)
+            {
+                std::destroy(node->values(), node->values() + node->count);
+            }
+        }
+
+        m_pool.release();
+
+        m_head = nullptr;
+        m_tail = nullptr;
+        m_size = 0;
+    }
+
+    template <typename T, size_t Capacity>
+    void UnrolledForwardList<T, Capacity>::sort()
+    {
+        // Elements are sorted in a contiguous buffer and moved back into fully packed nodes
+        std::vector<T> buffer;
+        buffer.reserve(m_size);
+
+        for (Node* node = m_head; node; node = node->next)
+        {
+            std::move(node->values(), node->values() + node->count, std::back_inserter(buffer));
+        }
+
+        std::stable_sort(buffer.begin(), buffer.end());
+
+        clear();
+        for (auto& elem : buffer)
+        {
+            push_back(std::move(elem));
+        }
+    }
+
+    template <typename T, size_t Capacity>
+    void UnrolledForwardList<T, Capacity>::swap(UnrolledForwardList& other) noexcept
+    {
+        std::swap(m_head, other.m_head);
+        std::swap(m_tail, other.m_tail);
+        std::swap(m_size, other.m_size);
+        m_pool.swap(other.m_pool);
+    }
+
+    template <typename T, size_t Capacity>
+    auto UnrolledForwardList<T, Capacity>::create_node(Node* next) -> Node*
+    {
+        Node* node = m_pool.create();
+        node->next = next;
+        return node;
+    }
+
+    template <typename T, size_t Capacity>
+    template <typename U>
+    auto UnrolledForwardList<T, Capacity>::create_node_with(Node* next, U&& value) -> Node*
+    {
+        Node* node = create_node(next);
+        try
+        {
+            new (node->values()) T(std::forward<U>(value));
+        }
+        catch (...)
+        {
+            destroy_node(node);
+            throw;
+        }
+
+        node->count = 1;
+        return node;
+    }
+
+    template <typename T, size_t Capacity>
+    void UnrolledForwardList<T, Capacity>::destroy_node(Node* node) noexcept
+    {
+        // Elements are destroyed already
+        m_pool.destroy(node);
+    }
+
+    template <typename T, size_t Capacity>
+    template <typename U>
+    void UnrolledForwardList<T, Capacity>::insert_into(Node* node, size_t idx, U&& value)
+    {
+        T* values = node->values();
+
+        if (idx == node->count)
+        {
+            new (values + idx) T(std::forward<U>(value));
+        }
+        else
+        {
+            // Shift [idx, count) one slot right: last element is moved to uninitialized slot
+            T tmp(std::forward<U>(value));
+            new (values + node->count) T(std::move(values[node->count - 1]));
+            std::move_backward(values + idx, values + node->count - 1, values + node->count);
+            values[idx] = std::move(tmp);
+        }
+
+        ++node->count;
+        ++m_size;
+    }
+
+    template <typename T, size_t Capacity>
+    void UnrolledForwardList<T, Capacity>::erase_from(Node* node, size_t idx) noexcept
+    {
+        T* values = node->values();
+
+        std::move(values + idx + 1, values + node->count, values + idx);
+        values[node->count - 1].~T();
+
+        --node->count;
+        --m_size;
+    }
+
+} // namespace AlgoStruct
@@ -0,0 +1,121 @@
+#include "ForwardList.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <forward_list>
+#include <random>
+
+using namespace AlgoStruct;
+
+// std::forward_list allocates every node with operator new,
+// as ForwardList did before switching to NodePool
+
+template<typename List>
+static void push_front_n(List& list, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        list.push_front(static_cast<int>(i));
+    }
+}
+
+static void BM_ForwardListPushFrontClear(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    ForwardList<int> list;
+
+    for (auto _ : state)
+    {
+        push_front_n(list, count);
+        list.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ForwardListPushFrontClear)->Range(1 << 8, 1 << 18);
+
+static void BM_StdForwardListPushFrontClear(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    std::forward_list<int> list;
+
+    for (auto _ : state)
+    {
+        push_front_n(list, count);
+        list.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_StdForwardListPushFrontClear)->Range(1 << 8, 1 << 18);
+
+// Order-queue workload: the queue is refilled and drained continuously
+static void BM_ForwardListPushPop(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    ForwardList<int> list;
+
+    for (auto _ : state)
+    {
+        push_front_n(list, count);
+        while (!list.empty())
+        {
+            benchmark::DoNotOptimize(list.front());
+            list.pop_front();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ForwardListPushPop)->Range(1 << 8, 1 << 18);
+
+static void BM_StdForwardListPushPop(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    std::forward_list<int> list;
+
+    for (auto _ : state)
+    {
+        push_front_n(list, count);
+        while (!list.empty())
+        {
+            benchmark::DoNotOptimize(list.front());
+            list.pop_front();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_StdForwardListPushPop)->Range(1 << 8, 1 << 18);
+
+// Sort of a shuffled list: single-threaded bottom-up merge sort and parallel runs sort
+static void fill_random(ForwardList<int>& list, size_t count)
+{
+    std::mt19937 gen(42);
+    for (size_t i = 0; i < count; ++i)
+    {
+        list.push_back(static_cast<int>(gen()));
+    }
+}
+
+static void BM_ForwardListSort(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto threads = static_cast<size_t>(state.range(1));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        ForwardList<int> list;
+        fill_random(list, count);
+        state.ResumeTiming();
+
+        list.parallel_sort(threads);
+        benchmark::DoNotOptimize(list.front());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ForwardListSort)
+    ->ArgsProduct({{1 << 16, 1 << 20}, {1, 2, 4, 8}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,80 @@
+#include "LockFreeQueue.hpp"
+#include "LockFreeStack.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <stack>
+
+using namespace AlgoStruct;
+
+// Mutex-protected containers used as shared free-lists and job queues before
+template<typename T>
+class LockedStack
+{
+public:
+    void push(const T& value)
+    {
+        std::lock_guard lock(m_mutex);
+        m_stack.push(value);
+    }
+
+    std::optional<T> pop()
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_stack.empty()) return std::nullopt;
+
+        std::optional<T> value(std::move(m_stack.top()));
+        m_stack.pop();
+        return value;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::stack<T> m_stack;
+};
+
+template<typename T>
+class LockedQueue
+{
+public:
+    void push(const T& value)
+    {
+        std::lock_guard lock(m_mutex);
+        m_queue.push(value);
+    }
+
+    std::optional<T> pop()
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_queue.empty()) return std::nullopt;
+
+        std::optional<T> value(std::move(m_queue.front()));
+        m_queue.pop();
+        return value;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::queue<T> m_queue;
+};
+
+// Every thread pushes and pops the shared container in turns
+template<typename Container>
+static void BM_PushPop(benchmark::State& state)
+{
+    static Container container;
+
+    for (auto _ : state)
+    {
+        container.push(state.thread_index());
+        benchmark::DoNotOptimize(container.pop());
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK_TEMPLATE(BM_PushPop, LockFreeStack<int>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PushPop, LockedStack<int>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PushPop, LockFreeQueue<int>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PushPop, LockedQueue<int>)->ThreadRange(1, 32)->UseRealTime();
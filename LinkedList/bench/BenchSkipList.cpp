@@ -0,0 +1,228 @@
+#include "ConcurrentSkipList.hpp"
+#include "SkipList.hpp"
+#include "median_handler.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace AlgoStruct;
+
+namespace
+{
+    std::vector<int> random_keys(size_t count, uint32_t seed = 1)
+    {
+        std::mt19937 gen(seed);
+        std::vector<int> keys(count);
+        for (auto& key : keys)
+        {
+            key = static_cast<int>(gen());
+        }
+        return keys;
+    }
+
+    // Map with coarse lock, the usual alternative to a concurrent ordered index
+    class LockedMap
+    {
+    public:
+        bool insert(std::pair<int, int> value)
+        {
+            std::lock_guard lock(m_mutex);
+            return m_map.insert(value).second;
+        }
+
+        bool contains(int key) const
+        {
+            std::lock_guard lock(m_mutex);
+            return m_map.find(key) != m_map.end();
+        }
+
+        size_t erase(int key)
+        {
+            std::lock_guard lock(m_mutex);
+            return m_map.erase(key);
+        }
+
+    private:
+        mutable std::mutex m_mutex;
+        std::map<int, int> m_map;
+    };
+
+    // Same two-sets scheme as MedianHandler on skip lists. Lower half is in descending
+    // order to get its maximum from begin(), index makes equal numbers unique keys
+    class SkipListMedianHandler
+    {
+        using Key = std::pair<int, size_t>;
+        struct Empty {};
+
+    public:
+        void insert(int element, size_t index)
+        {
+            if (lower.empty() || element <= lower.begin()->first.first)
+            {
+                lower.try_emplace({element, index});
+            }
+            else
+            {
+                upper.try_emplace({element, index});
+            }
+        }
+
+        void erase(int element, size_t index)
+        {
+            if (!lower.erase({element, index}))
+            {
+                upper.erase({element, index});
+            }
+        }
+
+        double get_median()
+        {
+            while (lower.size() < upper.size())
+            {
+                lower.try_emplace(upper.begin()->first);
+                upper.erase(upper.begin());
+            }
+
+            while (lower.size() > upper.size() + 1)
+            {
+                upper.try_emplace(lower.begin()->first);
+                lower.erase(lower.begin());
+            }
+
+            if (lower.size() != upper.size())
+            {
+                return lower.begin()->first.first;
+            }
+            return (lower.begin()->first.first + upper.begin()->first.first) / 2.0;
+        }
+
+    private:
+        SkipList<Key, Empty, std::greater<Key>> lower;
+        SkipList<Key, Empty> upper;
+    };
+}
+
+template<typename Map>
+static void BM_Insert(benchmark::State& state)
+{
+    const auto keys = random_keys(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        Map map;
+        for (const int key : keys)
+        {
+            map.insert({key, key});
+        }
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Insert, std::map<int, int>)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+BENCHMARK_TEMPLATE(BM_Insert, SkipList<int, int>)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+BENCHMARK_TEMPLATE(BM_Insert, ConcurrentSkipList<int, int>)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+template<typename Map>
+static void BM_Find(benchmark::State& state)
+{
+    const auto keys = random_keys(static_cast<size_t>(state.range(0)));
+    const auto lookups = random_keys(1 << 16, 2);
+
+    Map map;
+    for (const int key : keys)
+    {
+        map.insert({key, key});
+    }
+
+    for (auto _ : state)
+    {
+        for (const int key : lookups)
+        {
+            benchmark::DoNotOptimize(map.lower_bound(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * lookups.size());
+}
+BENCHMARK_TEMPLATE(BM_Find, std::map<int, int>)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+BENCHMARK_TEMPLATE(BM_Find, SkipList<int, int>)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+BENCHMARK_TEMPLATE(BM_Find, ConcurrentSkipList<int, int>)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+// Threads insert, look up and erase own keys in the shared map of ~64K elements
+template<typename Map>
+static void BM_ConcurrentUpdate(benchmark::State& state)
+{
+    static Map* map = nullptr;
+    if (state.thread_index() == 0)
+    {
+        map = new Map;
+        for (const int key : random_keys(1 << 16))
+        {
+            map->insert({key, key});
+        }
+    }
+
+    const auto keys = random_keys(1 << 12, static_cast<uint32_t>(state.thread_index() + 2));
+    size_t i = 0;
+
+    for (auto _ : state)
+    {
+        const int key = keys[i++ % keys.size()];
+        map->insert({key, key});
+        benchmark::DoNotOptimize(map->contains(key));
+        map->erase(key);
+    }
+    state.SetItemsProcessed(state.iterations() * 3);
+
+    if (state.thread_index() == 0)
+    {
+        delete map;
+        map = nullptr;
+    }
+}
+BENCHMARK_TEMPLATE(BM_ConcurrentUpdate, LockedMap)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentUpdate, ConcurrentSkipList<int, int>)->ThreadRange(1, 16)->UseRealTime();
+
+// Median of each window of Arg elements over 64K random numbers
+static void BM_MovingMedian_MultisetHandler(benchmark::State& state)
+{
+    const auto values = random_keys(1 << 16);
+    const auto window = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        MedianHandler handler;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (i >= window) handler.erase(values[i - window]);
+            handler.insert(values[i]);
+            benchmark::DoNotOptimize(handler.get_median());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_MovingMedian_MultisetHandler)->RangeMultiplier(16)->Range(16, 1 << 12);
+
+static void BM_MovingMedian_SkipListHandler(benchmark::State& state)
+{
+    const auto values = random_keys(1 << 16);
+    const auto window = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        SkipListMedianHandler handler;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (i >= window) handler.erase(values[i - window], i - window);
+            handler.insert(values[i], i);
+            benchmark::DoNotOptimize(handler.get_median());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_MovingMedian_SkipListHandler)->RangeMultiplier(16)->Range(16, 1 << 12);
@@ -0,0 +1,72 @@
+#include "ForwardList.hpp"
+#include "UnrolledForwardList.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using namespace AlgoStruct;
+
+template<typename List>
+static void fill_random(List& list, size_t count)
+{
+    std::mt19937 gen(42);
+    for (size_t i = 0; i < count; ++i)
+    {
+        list.push_back(static_cast<int>(gen()));
+    }
+}
+
+template<typename List>
+static long long sum(const List& list)
+{
+    long long result = 0;
+    for (const auto& elem : list)
+    {
+        result += elem;
+    }
+    return result;
+}
+
+// Iteration over a list after sort: ForwardList nodes are relinked in random memory order,
+// UnrolledForwardList elements stay contiguous inside nodes
+template<typename List>
+static void BM_IterateSorted(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    List list;
+    fill_random(list, count);
+    list.sort();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sum(list));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_IterateSorted, ForwardList<int>)->Arg(1'000'000)->Arg(10'000'000);
+BENCHMARK_TEMPLATE(BM_IterateSorted, UnrolledForwardList<int>)->Arg(1'000'000)->Arg(10'000'000);
+
+template<typename List>
+static void BM_Sort(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        List list;
+        fill_random(list, count);
+        state.ResumeTiming();
+
+        list.sort();
+        benchmark::DoNotOptimize(list.front());
+
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_Sort, ForwardList<int>)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Sort, UnrolledForwardList<int>)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
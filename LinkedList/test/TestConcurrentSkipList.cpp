@@ -0,0 +1,235 @@
+#include "ConcurrentSkipList.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+TEST(TestConcurrentSkipList, ShouldInsertFindErase)
+{
+    ConcurrentSkipList<int, std::string> sut;
+    ASSERT_TRUE(sut.empty());
+    ASSERT_EQ(sut.end(), sut.find(1));
+
+    ASSERT_TRUE(sut.insert({3, "c"}).second);
+    ASSERT_TRUE(sut.insert({1, "a"}).second);
+    ASSERT_TRUE(sut.try_emplace(2, 2, 'b').second);
+    ASSERT_FALSE(sut.insert({1, "A"}).second);
+
+    ASSERT_EQ(3, sut.size());
+    ASSERT_EQ("bb", sut.find(2)->second);
+    ASSERT_EQ(3, sut.lower_bound(3)->first);
+    ASSERT_EQ(sut.end(), sut.lower_bound(4));
+
+    ASSERT_EQ(1, sut.erase(2));
+    ASSERT_EQ(0, sut.erase(2));
+    ASSERT_FALSE(sut.contains(2));
+    ASSERT_EQ(3, sut.lower_bound(2)->first);
+
+    // Key can be inserted again after erase
+    ASSERT_TRUE(sut.insert({2, "B"}).second);
+
+    std::vector<int> keys;
+    for (const auto& [key, value] : sut)
+    {
+        keys.push_back(key);
+    }
+    ASSERT_EQ((std::vector<int>{1, 2, 3}), keys);
+}
+
+TEST(TestConcurrentSkipList, ShouldKeepErasedValuesWhilePinned)
+{
+    auto counter = std::make_shared<int>(0);
+    ConcurrentSkipList<int, std::shared_ptr<int>> sut;
+    sut.insert({1, counter});
+    sut.insert({2, counter});
+
+    {
+        const auto guard = sut.pin();
+        const auto it = sut.find(1);
+        ASSERT_EQ(1, sut.erase(1));
+
+        EpochDomain::global().reclaim();
+        ASSERT_EQ(counter, it->second);
+        ASSERT_EQ(3, counter.use_count());
+    }
+
+    // Nobody is pinned: the erased node is freed before the list
+    EpochDomain::global().reclaim();
+    ASSERT_EQ(2, counter.use_count());
+}
+
+TEST(TestConcurrentSkipList, ShouldFreeErasedNodes)
+{
+    auto counter = std::make_shared<int>(0);
+    ConcurrentSkipList<int, std::shared_ptr<int>> sut;
+
+    // Keys are inserted and erased again and again, retired nodes don't pile up
+    for (int round = 0; round < 100; ++round)
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            sut.insert({i, counter});
+        }
+        for (int i = 0; i < 100; ++i)
+        {
+            sut.erase(i);
+        }
+        ASSERT_LT(counter.use_count(), 200);
+    }
+
+    EpochDomain::global().reclaim();
+    ASSERT_TRUE(sut.empty());
+    ASSERT_EQ(1, counter.use_count());
+}
+
+TEST(TestConcurrentSkipList, ShouldInsertConcurrently)
+{
+    constexpr int threadCount = 4;
+    constexpr int keysPerThread = 5000;
+    ConcurrentSkipList<int, int> sut;
+    std::atomic<int> inserted{0};
+
+    // Threads insert interleaved keys and race on every fourth one
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&sut, &inserted, t]
+        {
+            for (int i = 0; i < keysPerThread; ++i)
+            {
+                const int key = (i % 4 == 0) ? i : i * threadCount + t;
+                if (sut.insert({key, key}).second)
+                {
+                    ++inserted;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(static_cast<size_t>(inserted.load()), sut.size());
+
+    int previous = -1;
+    size_t count = 0;
+    for (const auto& [key, value] : sut)
+    {
+        ASSERT_LT(previous, key);
+        ASSERT_EQ(key, value);
+        previous = key;
+        ++count;
+    }
+    ASSERT_EQ(sut.size(), count);
+}
+
+TEST(TestConcurrentSkipList, ShouldEraseConcurrently)
+{
+    constexpr int threadCount = 4;
+    constexpr int keyCount = 20000;
+    ConcurrentSkipList<int, int> sut;
+    for (int i = 0; i < keyCount; ++i)
+    {
+        sut.insert({i, i});
+    }
+
+    // Each key is erased by exactly one thread, while others insert new odd keys
+    std::atomic<int> erased{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&sut, &erased, t]
+        {
+            for (int i = 0; i < keyCount; i += 2)
+            {
+                erased += static_cast<int>(sut.erase(i));
+                if (i % threadCount == t)
+                {
+                    sut.insert({keyCount + i + 1, 0});
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(keyCount / 2, erased.load());
+    ASSERT_EQ(static_cast<size_t>(keyCount), sut.size());
+    for (int i = 0; i < keyCount; ++i)
+    {
+        ASSERT_EQ(i % 2 == 1, sut.contains(i));
+    }
+}
+
+TEST(TestConcurrentSkipList, ShouldReadWhileKeysAreErasedAndInserted)
+{
+    constexpr int keyCount = 64;
+    ConcurrentSkipList<int, std::string> sut;
+    std::atomic<bool> done{false};
+
+    // Writers churn a few keys, so erased nodes are retired and freed all the time
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 2; ++t)
+    {
+        threads.emplace_back([&sut, t]
+        {
+            for (int i = 0; i < 20000; ++i)
+            {
+                const int key = (i * 7 + t) % keyCount;
+                if (i % 2 == 0)
+                {
+                    sut.insert({key, std::to_string(key)});
+                }
+                else
+                {
+                    sut.erase(key);
+                }
+            }
+        });
+    }
+
+    std::atomic<int> mismatches{0};
+    std::thread reader([&]
+    {
+        while (!done.load())
+        {
+            const auto guard = sut.pin();
+            int previous = -1;
+            for (const auto& [key, value] : sut)
+            {
+                if (key <= previous || value != std::to_string(key))
+                {
+                    ++mismatches;
+                }
+                previous = key;
+            }
+        }
+    });
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    done = true;
+    reader.join();
+
+    ASSERT_EQ(0, mismatches.load());
+    size_t count = 0;
+    for (auto it = sut.begin(); it != sut.end(); ++it)
+    {
+        ++count;
+    }
+    ASSERT_EQ(sut.size(), count);
+}
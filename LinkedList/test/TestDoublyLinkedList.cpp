@@ -2,9 +2,35 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
 using namespace ::testing;
 using namespace AlgoStruct;
 
+// Counts heap allocations of the test binary
+static size_t allocationCount = 0;
+
+void* operator new(size_t size)
+{
+    ++allocationCount;
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
 template<typename T>
 std::string ToString(const DoublyLinkedList<T>& list)
 {
@@ -609,4 +635,134 @@ TEST(TestDoublyLinkedList, ShouldRetainOriginalContentAfterSwapListsTwoTimes)
         const DoublyLinkedList expected2{-10, -20, -100};
         ASSERT_EQ(expected2, sut2) << "Expected: " << ToString(expected2) << ", got: " << ToString(sut2);
     }
-}
\ No newline at end of file
+}
+TEST(TestDoublyLinkedList, ShouldSpliceWholeList)
+{
+    DoublyLinkedList<int> sut1{1, 2, 5};
+    DoublyLinkedList<int> sut2{3, 4};
+
+    sut1.splice(std::next(sut1.begin(), 2), sut2);
+
+    const DoublyLinkedList expected{1, 2, 3, 4, 5};
+    ASSERT_EQ(expected, sut1) << "Expected: " << ToString(expected) << ", got: " << ToString(sut1);
+    ASSERT_TRUE(sut2.empty());
+    ASSERT_EQ(sut2.begin(), sut2.end());
+
+    sut2.splice(sut2.end(), sut1);
+    ASSERT_EQ(expected, sut2);
+    ASSERT_TRUE(sut1.empty());
+    ASSERT_ANY_THROW(sut1.front());
+}
+
+TEST(TestDoublyLinkedList, ShouldSpliceElementAndRange)
+{
+    DoublyLinkedList<int> sut1{1, 2, 3};
+    DoublyLinkedList<int> sut2{10, 20, 30, 40};
+
+    // Single element to the front of the same list
+    sut1.splice(sut1.begin(), sut1, std::prev(sut1.end()));
+    const DoublyLinkedList expected1{3, 1, 2};
+    ASSERT_EQ(expected1, sut1) << "Expected: " << ToString(expected1) << ", got: " << ToString(sut1);
+
+    sut1.splice(sut1.end(), sut2, std::next(sut2.begin()), std::prev(sut2.end()));
+    const DoublyLinkedList expected2{3, 1, 2, 20, 30};
+    ASSERT_EQ(expected2, sut1) << "Expected: " << ToString(expected2) << ", got: " << ToString(sut1);
+    const DoublyLinkedList expected3{10, 40};
+    ASSERT_EQ(expected3, sut2) << "Expected: " << ToString(expected3) << ", got: " << ToString(sut2);
+
+    sut1.splice(sut1.begin(), sut2, sut2.begin());
+    ASSERT_EQ(6, sut1.size());
+    ASSERT_EQ(10, sut1.front());
+    ASSERT_EQ(1, sut2.size());
+    ASSERT_EQ(40, sut2.back());
+}
+
+TEST(TestDoublyLinkedList, ShouldMergeSortedLists)
+{
+    DoublyLinkedList<int> sut1{1, 4, 9};
+    DoublyLinkedList<int> sut2{0, 4, 5, 12, 13};
+
+    sut1.merge(sut2);
+
+    const DoublyLinkedList expected{0, 1, 4, 4, 5, 9, 12, 13};
+    ASSERT_EQ(expected, sut1) << "Expected: " << ToString(expected) << ", got: " << ToString(sut1);
+    ASSERT_TRUE(sut2.empty());
+    ASSERT_EQ(13, sut1.back());
+
+    DoublyLinkedList<int> sut3{9, 5};
+    DoublyLinkedList<int> sut4{7, 6, 1};
+    sut3.merge(sut4, std::greater<int>{});
+    const DoublyLinkedList expectedDesc{9, 7, 6, 5, 1};
+    ASSERT_EQ(expectedDesc, sut3) << "Expected: " << ToString(expectedDesc) << ", got: " << ToString(sut3);
+}
+
+TEST(TestDoublyLinkedList, ShouldRemoveIfAndUnique)
+{
+    DoublyLinkedList<int> sut{2, 2, 2, 3, 4, 4, 5, 2};
+
+    ASSERT_EQ(3, sut.unique());
+    const DoublyLinkedList expected1{2, 3, 4, 5, 2};
+    ASSERT_EQ(expected1, sut) << "Expected: " << ToString(expected1) << ", got: " << ToString(sut);
+
+    ASSERT_EQ(2, sut.remove_if([](int value) { return value == 2; }));
+    const DoublyLinkedList expected2{3, 4, 5};
+    ASSERT_EQ(expected2, sut) << "Expected: " << ToString(expected2) << ", got: " << ToString(sut);
+    ASSERT_EQ(5, sut.back());
+    ASSERT_EQ(3, sut.front());
+}
+
+TEST(TestDoublyLinkedList, ShouldNotAllocateOnConstructionAndMove)
+{
+    static_assert(std::is_nothrow_default_constructible_v<DoublyLinkedList<std::string>>);
+    static_assert(std::is_nothrow_move_constructible_v<DoublyLinkedList<std::string>>);
+
+    const size_t before = allocationCount;
+    {
+        DoublyLinkedList<std::string> empty1;
+        DoublyLinkedList<std::string> empty2(std::move(empty1));
+        empty1 = std::move(empty2);
+        empty1.swap(empty2);
+    }
+    ASSERT_EQ(before, allocationCount);
+
+    DoublyLinkedList<std::string> sut{"a", "b", "c"};
+    auto it = std::next(sut.begin());
+    const size_t filled = allocationCount;
+
+    DoublyLinkedList<std::string> moved(std::move(sut));
+    DoublyLinkedList<std::string> assigned;
+    assigned = std::move(moved);
+    ASSERT_EQ(filled, allocationCount);
+
+    // Nodes are not relocated: iterators stay valid, end() belongs to the new owner
+    ASSERT_EQ("b", *it);
+    ASSERT_EQ(assigned.end(), std::next(it, 2));
+    ASSERT_TRUE(sut.empty());
+    ASSERT_TRUE(moved.empty());
+    ASSERT_EQ(sut.begin(), sut.end());
+    ASSERT_EQ(3, assigned.size());
+    ASSERT_EQ("c", assigned.back());
+
+    sut.push_back("d");
+    ASSERT_EQ("d", sut.front());
+}
+
+TEST(TestDoublyLinkedList, ShouldCopyList)
+{
+    DoublyLinkedList<std::string> sut{"a", "b"};
+    DoublyLinkedList<std::string> copy(sut);
+
+    sut.front() = "changed";
+    const DoublyLinkedList<std::string> expected{"a", "b"};
+    ASSERT_EQ(expected, copy);
+
+    copy = sut;
+    ASSERT_EQ(sut, copy);
+    ASSERT_EQ("changed", copy.front());
+
+    copy.pop_back();
+    copy.pop_front();
+    ASSERT_TRUE(copy.empty());
+    ASSERT_THROW(copy.erase(copy.end()), std::invalid_argument);
+    ASSERT_EQ(1, std::next(sut.begin())->size());
+}
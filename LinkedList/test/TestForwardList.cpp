@@ -3,6 +3,12 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
 #include <vector>
 
 using namespace ::testing;
@@ -215,3 +221,347 @@ TEST(TestForwardList, ShouldSortWithDuplicates)
     list.sort();
     ASSERT_THAT(traverse(list), ElementsAreArray({-1, 2, 2, 3, 3, 4, 5, 9, 10, 21}));
 }
+
+TEST(TestForwardList, ShouldSortWithComparator)
+{
+    ForwardList list{3, 1, 4, 1, 5, 9, 2, 6};
+    list.sort(std::greater<int>{});
+
+    ASSERT_THAT(traverse(list), ElementsAreArray({9, 6, 5, 4, 3, 2, 1, 1}));
+    ASSERT_EQ(list.back(), 1);
+}
+
+TEST(TestForwardList, ShouldSortStable)
+{
+    ForwardList<std::pair<int, int>> list;
+    for (int i = 0; i < 100; ++i)
+    {
+        list.push_back({i % 3, i});
+    }
+
+    list.sort([](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    const auto values = traverse(list);
+    ASSERT_TRUE(std::is_sorted(values.begin(), values.end()));
+}
+
+TEST(TestForwardList, ShouldSortLongListInParallel)
+{
+    std::mt19937 gen(42);
+    std::vector<int> values(100'000);
+    for (auto& value : values)
+    {
+        value = static_cast<int>(gen() % 1000);
+    }
+
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    for (size_t threads : {1, 3, 8})
+    {
+        ForwardList<int> list;
+        for (const auto value : values)
+        {
+            list.push_back(value);
+        }
+
+        list.parallel_sort(threads);
+
+        ASSERT_EQ(traverse(list), expected) << "threads: " << threads;
+        ASSERT_EQ(list.back(), expected.back());
+        list.push_back(-1);
+        ASSERT_EQ(list.size(), values.size() + 1);
+    }
+
+    ForwardList<int> list;
+    list.parallel_sort(4);
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(TestForwardList, ShouldPushAfterClear)
+{
+    ForwardList<std::string> list{"a", "b", "c"};
+
+    list.clear();
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.begin(), list.end());
+
+    list.push_back("d");
+    list.push_front("e");
+    ASSERT_THAT(traverse(list), ElementsAreArray({"e", "d"}));
+}
+
+TEST(TestForwardList, ShouldReuseNodesAfterPopFront)
+{
+    ForwardList<std::string> list;
+
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.push_back(std::to_string(i));
+        }
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            ASSERT_EQ(list.front(), std::to_string(i));
+            list.pop_front();
+        }
+    }
+
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(TestForwardList, ShouldCopyList)
+{
+    ForwardList list1{1, 2, 3};
+    ForwardList list2(list1);
+
+    list1.push_back(4);
+    ASSERT_THAT(traverse(list2), ElementsAreArray({1, 2, 3}));
+
+    list2 = list1;
+    list1.clear();
+    ASSERT_THAT(traverse(list2), ElementsAreArray({1, 2, 3, 4}));
+    ASSERT_EQ(list2.back(), 4);
+}
+
+TEST(TestForwardList, ShouldMoveList)
+{
+    ForwardList list1{1, 2, 3};
+    ForwardList list2(std::move(list1));
+
+    ASSERT_TRUE(list1.empty());
+    ASSERT_THAT(traverse(list2), ElementsAreArray({1, 2, 3}));
+
+    list1 = std::move(list2);
+    list1.push_back(5);
+    ASSERT_TRUE(list2.empty());
+    ASSERT_THAT(traverse(list1), ElementsAreArray({1, 2, 3, 5}));
+}
+
+TEST(TestForwardList, ShouldSpliceWholeList)
+{
+    ForwardList list1{1, 2, 5};
+    ForwardList list2{3, 4};
+
+    auto it = list1.begin();
+    ++it;
+    list1.splice_after(it, list2);
+
+    ASSERT_TRUE(list2.empty());
+    ASSERT_EQ(list1.size(), 5);
+    ASSERT_THAT(traverse(list1), ElementsAreArray({1, 2, 3, 4, 5}));
+
+    // Appending to the back, adopted nodes stay valid after source list is gone
+    {
+        ForwardList list3{6, 7};
+        list1.splice_after(list1.end(), list3);
+    }
+    ASSERT_EQ(list1.back(), 7);
+    list1.push_back(8);
+    ASSERT_THAT(traverse(list1), ElementsAreArray({1, 2, 3, 4, 5, 6, 7, 8}));
+
+    ForwardList<int> empty;
+    empty.splice_after(empty.end(), list1);
+    ASSERT_EQ(empty.size(), 8);
+    ASSERT_EQ(empty.back(), 8);
+}
+
+TEST(TestForwardList, ShouldSpliceTemporaryListsRepeatedly)
+{
+    ForwardList<int> list;
+    std::vector<int> expected;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        ForwardList<int> tmp{i, -i};
+        list.splice_after(list.end(), tmp);
+        ASSERT_TRUE(tmp.empty());
+        tmp.push_back(i);
+
+        expected.push_back(i);
+        expected.push_back(-i);
+    }
+    ASSERT_THAT(traverse(list), ElementsAreArray(expected));
+
+    // Adopted blocks are dropped once the list is empty, the list stays usable
+    while (!list.empty())
+    {
+        list.pop_front();
+    }
+    list.push_back(1);
+    ASSERT_THAT(traverse(list), ElementsAre(1));
+}
+
+TEST(TestForwardList, ShouldSpliceRange)
+{
+    ForwardList list{1, 2, 3, 4, 5, 6};
+
+    // Move (1, 4) = {2, 3} after 6
+    auto first = list.begin();
+    auto last = list.begin();
+    last += 3;
+    list.splice_after(list.end(), list, first, last);
+
+    ASSERT_THAT(traverse(list), ElementsAreArray({1, 4, 5, 6, 2, 3}));
+    ASSERT_EQ(list.back(), 3);
+
+    ForwardList<std::string> other{"a", "b", "c", "d"};
+    ForwardList<std::string> target{"x"};
+    target.splice_after(target.begin(), other, other.begin(), other.end());
+
+    ASSERT_THAT(traverse(target), ElementsAreArray({"x", "b", "c", "d"}));
+    ASSERT_THAT(traverse(other), ElementsAreArray({"a"}));
+    ASSERT_EQ(other.back(), "a");
+    ASSERT_EQ(target.back(), "d");
+    ASSERT_EQ(target.size(), 4);
+}
+
+TEST(TestForwardList, ShouldKeepNodesSplicedFromAnotherList)
+{
+    ForwardList<std::string> target{"x", "y"};
+    const std::string* spliced = nullptr;
+    {
+        ForwardList<std::string> other{"a", "b", "c", "d"};
+        auto first = other.begin();
+        auto last = other.begin();
+        last += 3;
+        spliced = &*std::next(first);
+
+        // Move (a, d) = {b, c} after x
+        target.splice_after(target.begin(), other, first, last);
+
+        ASSERT_EQ(spliced, &*std::next(target.begin()));
+        ASSERT_THAT(traverse(other), ElementsAreArray({"a", "d"}));
+        ASSERT_EQ(other.size(), 2);
+        ASSERT_EQ(target.size(), 4);
+
+        other.push_back("e");
+        ASSERT_EQ(other.back(), "e");
+    }
+
+    // Nodes outlive the list they were carved for
+    ASSERT_EQ(spliced, &*std::next(target.begin()));
+    ASSERT_THAT(traverse(target), ElementsAreArray({"x", "b", "c", "y"}));
+
+    auto head = target.begin();
+    target.erase_after(head);
+    target.push_back("z");
+    ASSERT_THAT(traverse(target), ElementsAreArray({"x", "c", "y", "z"}));
+
+    ForwardList<std::string> empty;
+    empty.splice_after(empty.end(), target, target.begin(), target.end());
+    ASSERT_THAT(traverse(empty), ElementsAreArray({"c", "y", "z"}));
+    ASSERT_EQ(empty.back(), "z");
+    ASSERT_EQ(target.back(), "x");
+}
+
+TEST(TestForwardList, ShouldMergeSortedLists)
+{
+    ForwardList<std::pair<int, char>> list1{{1, 'a'}, {3, 'a'}, {5, 'a'}};
+    ForwardList<std::pair<int, char>> list2{{0, 'b'}, {3, 'b'}, {5, 'b'}};
+    const auto by_key = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+
+    list1.merge(list2, by_key);
+
+    ASSERT_TRUE(list2.empty());
+    ASSERT_EQ(list1.size(), 6);
+    ASSERT_THAT(traverse(list1), ElementsAreArray(std::vector<std::pair<int, char>>{
+        {0, 'b'}, {1, 'a'}, {3, 'a'}, {3, 'b'}, {5, 'a'}, {5, 'b'}}));
+    ASSERT_EQ(list1.back(), std::make_pair(5, 'b'));
+
+    ForwardList list3{1, 10};
+    ForwardList list4{2, 3};
+    list3.merge(list4);
+    ASSERT_THAT(traverse(list3), ElementsAreArray({1, 2, 3, 10}));
+    list3.push_back(11);
+    ASSERT_EQ(list3.back(), 11);
+}
+
+TEST(TestForwardList, ShouldRemoveIfAndUnique)
+{
+    ForwardList list{1, 1, 2, 3, 3, 3, 4, 5, 5};
+
+    ASSERT_EQ(list.unique(), 4);
+    ASSERT_THAT(traverse(list), ElementsAreArray({1, 2, 3, 4, 5}));
+
+    ASSERT_EQ(list.remove_if([](int value) { return value % 2 != 0; }), 3);
+    ASSERT_THAT(traverse(list), ElementsAreArray({2, 4}));
+    ASSERT_EQ(list.size(), 2);
+    ASSERT_EQ(list.back(), 4);
+
+    ASSERT_EQ(list.remove_if([](int) { return true; }), 2);
+    ASSERT_TRUE(list.empty());
+    list.push_back(7);
+    ASSERT_EQ(list.front(), 7);
+}
+
+namespace
+{
+    // Counts copies of a heavy object
+    struct QueuedMessage
+    {
+        QueuedMessage(std::string t, int p): text(std::move(t)), priority(p) {}
+        QueuedMessage(const QueuedMessage& other): text(other.text), priority(other.priority) { ++copies; }
+        QueuedMessage(QueuedMessage&&) noexcept = default;
+
+        std::string text;
+        int priority = 0;
+
+        static inline int copies = 0;
+    };
+}
+
+TEST(TestForwardList, ShouldEmplaceWithoutCopies)
+{
+    QueuedMessage::copies = 0;
+    ForwardList<QueuedMessage> list;
+
+    list.emplace_back("second", 2);
+    QueuedMessage& front = list.emplace_front("first", 1);
+    ASSERT_EQ(front.text, "first");
+
+    auto it = list.begin();
+    ++it;
+    auto inserted = list.emplace_after(it, "fourth", 4);
+    ASSERT_EQ(inserted->priority, 4);
+    ASSERT_EQ(list.back().text, "fourth");
+
+    list.insert_after(it, QueuedMessage("third", 3));
+    list.push_back(QueuedMessage("fifth", 5));
+    list.push_front(QueuedMessage("zeroth", 0));
+
+    ASSERT_EQ(QueuedMessage::copies, 0);
+    ASSERT_EQ(list.size(), 6);
+
+    int expected = 0;
+    for (const auto& message : list)
+    {
+        ASSERT_EQ(message.priority, expected++);
+    }
+
+    const QueuedMessage copied("sixth", 6);
+    list.push_back(copied);
+    ASSERT_EQ(QueuedMessage::copies, 1);
+
+    auto end = list.end();
+    ASSERT_EQ(list.emplace_after(end, "none", -1), list.end());
+}
+
+TEST(TestForwardList, ShouldStoreMoveOnlyValues)
+{
+    ForwardList<std::unique_ptr<int>> list;
+
+    list.push_back(std::make_unique<int>(2));
+    list.emplace_front(new int(1));
+    auto it = list.begin();
+    list.insert_after(it, std::make_unique<int>(10));
+
+    ASSERT_EQ(*list.front(), 1);
+    ASSERT_EQ(*list.back(), 2);
+    ASSERT_EQ(list.size(), 3);
+
+    list.pop_front();
+    ASSERT_EQ(**list.begin(), 10);
+}
@@ -0,0 +1,210 @@
+#include "IntrusiveList.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+namespace
+{
+    struct LruTag {};
+    struct BucketTag {};
+
+    struct Order: IntrusiveListHook<LruTag>, IntrusiveListHook<BucketTag>
+    {
+        explicit Order(int i): id(i) {}
+
+        int id = 0;
+    };
+
+    // Member hooks need a standard-layout type
+    struct Task
+    {
+        explicit Task(int i): id(i) {}
+
+        int id = 0;
+        IntrusiveForwardListHook<> pending;
+        IntrusiveListHook<> member;
+    };
+
+    using PendingHook = ALGO_STRUCT_MEMBER_HOOK(Task, pending);
+    using MemberListHook = ALGO_STRUCT_MEMBER_HOOK(Task, member);
+
+    template <typename List>
+    std::vector<int> traverse(const List& list)
+    {
+        std::vector<int> ids;
+
+        for (const auto& order : list)
+        {
+            ids.push_back(order.id);
+        }
+
+        return ids;
+    }
+}
+
+TEST(TestIntrusiveForwardList, ShouldPushAndPopWithoutCopies)
+{
+    std::vector<Task> orders{Task(0), Task(1), Task(2), Task(3)};
+    IntrusiveForwardList<Task, PendingHook> list;
+
+    list.push_back(orders[1]);
+    list.push_back(orders[2]);
+    list.push_front(orders[0]);
+
+    ASSERT_EQ(3, list.size());
+    ASSERT_EQ(&orders[0], &list.front());
+    ASSERT_EQ(&orders[2], &list.back());
+    ASSERT_TRUE(orders[0].pending.is_linked());
+    ASSERT_FALSE(orders[3].pending.is_linked());
+    ASSERT_THAT(traverse(list), ElementsAreArray({0, 1, 2}));
+
+    list.pop_front();
+    ASSERT_FALSE(orders[0].pending.is_linked());
+    ASSERT_THAT(traverse(list), ElementsAreArray({1, 2}));
+
+    // Already linked value is rejected
+    ASSERT_THROW(list.push_back(orders[1]), std::logic_error);
+}
+
+TEST(TestIntrusiveForwardList, ShouldInsertAndEraseAfter)
+{
+    std::vector<Task> orders{Task(0), Task(1), Task(2)};
+    IntrusiveForwardList<Task, PendingHook> list;
+
+    auto it = list.insert_after(list.before_begin(), orders[0]);
+    list.insert_after(it, orders[2]);
+    list.insert_after(it, orders[1]);
+    ASSERT_THAT(traverse(list), ElementsAreArray({0, 1, 2}));
+
+    auto next = list.erase_after(list.begin());
+    ASSERT_EQ(2, next->id);
+    ASSERT_EQ(list.end(), list.erase_after(next));
+
+    // Erasing the tail updates back()
+    list.erase_after(list.begin());
+    ASSERT_EQ(&orders[0], &list.back());
+    list.push_back(orders[1]);
+    ASSERT_THAT(traverse(list), ElementsAreArray({0, 1}));
+
+    list.clear();
+    ASSERT_TRUE(list.empty());
+    ASSERT_FALSE(orders[0].pending.is_linked());
+    ASSERT_THROW(list.pop_front(), std::invalid_argument);
+}
+
+TEST(TestIntrusiveList, ShouldKeepObjectOnSeveralLists)
+{
+    std::vector<Order> orders;
+    for (int i = 0; i < 6; ++i)
+    {
+        orders.emplace_back(i);
+    }
+
+    IntrusiveList<Order, BaseHook<LruTag>> lru;
+    IntrusiveList<Order, BaseHook<BucketTag>> even;
+    IntrusiveList<Order, BaseHook<BucketTag>> odd;
+
+    for (auto& order : orders)
+    {
+        lru.push_front(order);
+        (order.id % 2 ? odd : even).push_back(order);
+    }
+
+    ASSERT_THAT(traverse(lru), ElementsAreArray({5, 4, 3, 2, 1, 0}));
+    ASSERT_THAT(traverse(even), ElementsAreArray({0, 2, 4}));
+    ASSERT_THAT(traverse(odd), ElementsAreArray({1, 3, 5}));
+
+    // Unlink by reference from one list does not affect another
+    lru.erase(orders[3]);
+    odd.erase(orders[3]);
+    even.erase(orders[0]);
+
+    ASSERT_THAT(traverse(lru), ElementsAreArray({5, 4, 2, 1, 0}));
+    ASSERT_THAT(traverse(even), ElementsAreArray({2, 4}));
+    ASSERT_THAT(traverse(odd), ElementsAreArray({1, 5}));
+    ASSERT_EQ(5, lru.size());
+    ASSERT_EQ(&orders[0], &lru.back());
+}
+
+TEST(TestIntrusiveList, ShouldMoveElementToFront)
+{
+    std::vector<Task> orders{Task(0), Task(1), Task(2)};
+    IntrusiveList<Task, MemberListHook> list;
+
+    for (auto& order : orders)
+    {
+        list.push_back(order);
+    }
+
+    list.move_to(list.begin(), orders[2]);
+    ASSERT_THAT(traverse(list), ElementsAreArray({2, 0, 1}));
+    list.move_to(list.end(), orders[2]);
+    ASSERT_THAT(traverse(list), ElementsAreArray({0, 1, 2}));
+    list.move_to(list.begin(), orders[0]);
+    ASSERT_THAT(traverse(list), ElementsAreArray({0, 1, 2}));
+
+    ASSERT_EQ(&orders[1], &*list.iterator_to(orders[1]));
+    ASSERT_EQ(2, std::prev(list.end())->id);
+    ASSERT_EQ(3, list.size());
+}
+
+TEST(TestIntrusiveList, ShouldPopAndIterateBackward)
+{
+    std::vector<Order> orders{Order(0), Order(1), Order(2), Order(3)};
+    IntrusiveList<Order, BaseHook<LruTag>> list;
+
+    for (auto& order : orders)
+    {
+        list.push_back(order);
+    }
+
+    std::vector<int> reversed;
+    for (auto it = list.rbegin(); it != list.rend(); ++it)
+    {
+        reversed.push_back(it->id);
+    }
+    ASSERT_THAT(reversed, ElementsAreArray({3, 2, 1, 0}));
+
+    list.pop_back();
+    list.pop_front();
+    ASSERT_THAT(traverse(list), ElementsAreArray({1, 2}));
+    ASSERT_FALSE(static_cast<IntrusiveListHook<LruTag>&>(orders[0]).is_linked());
+
+    list.clear();
+    ASSERT_THROW(list.front(), std::invalid_argument);
+    ASSERT_THROW(list.pop_back(), std::invalid_argument);
+    ASSERT_THROW(list.erase(list.end()), std::invalid_argument);
+}
+
+TEST(TestIntrusiveList, ShouldSwapAndMoveLists)
+{
+    std::vector<Order> orders{Order(0), Order(1), Order(2)};
+    IntrusiveList<Order, BaseHook<LruTag>> list1;
+    IntrusiveList<Order, BaseHook<LruTag>> list2;
+
+    list1.push_back(orders[0]);
+    list1.push_back(orders[1]);
+    list1.swap(list2);
+
+    ASSERT_TRUE(list1.empty());
+    ASSERT_THAT(traverse(list2), ElementsAreArray({0, 1}));
+
+    IntrusiveList<Order, BaseHook<LruTag>> list3(std::move(list2));
+    ASSERT_TRUE(list2.empty());
+    list3.push_back(orders[2]);
+    ASSERT_THAT(traverse(list3), ElementsAreArray({0, 1, 2}));
+
+    list1 = std::move(list3);
+    list1.pop_front();
+    ASSERT_THAT(traverse(list1), ElementsAreArray({1, 2}));
+
+    // Copy of a linked object is not linked
+    Order copy = orders[1];
+    ASSERT_FALSE(static_cast<IntrusiveListHook<LruTag>&>(copy).is_linked());
+}
@@ -0,0 +1,113 @@
+#include "LockFreeQueue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+TEST(TestLockFreeQueue, ShouldPopInInsertionOrder)
+{
+    LockFreeQueue<std::string> sut;
+    ASSERT_TRUE(sut.empty());
+    ASSERT_FALSE(sut.pop().has_value());
+
+    sut.push("a");
+    sut.push(std::string("b"));
+    sut.emplace(3, 'c');
+
+    ASSERT_FALSE(sut.empty());
+    ASSERT_EQ("a", sut.pop());
+    ASSERT_EQ("b", sut.pop());
+    ASSERT_EQ("ccc", sut.pop());
+    ASSERT_FALSE(sut.pop().has_value());
+    ASSERT_TRUE(sut.empty());
+
+    sut.push("d");
+    ASSERT_EQ("d", sut.pop());
+}
+
+TEST(TestLockFreeQueue, ShouldDestroyRemainingElements)
+{
+    auto counter = std::make_shared<int>(0);
+    {
+        LockFreeQueue<std::shared_ptr<int>> sut;
+        for (int i = 0; i < 10; ++i)
+        {
+            sut.push(counter);
+        }
+        sut.pop();
+        ASSERT_EQ(10, counter.use_count());
+    }
+
+    ASSERT_EQ(1, counter.use_count());
+}
+
+TEST(TestLockFreeQueue, ShouldKeepPerProducerOrderWithConcurrentConsumers)
+{
+    constexpr int producerCount = 2;
+    constexpr int consumerCount = 2;
+    constexpr int perProducer = 20'000;
+
+    LockFreeQueue<std::pair<int, int>> sut;
+    std::atomic<int> consumed{0};
+    std::vector<std::vector<std::pair<int, int>>> received(consumerCount);
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producerCount; ++p)
+    {
+        threads.emplace_back([&sut, p]
+        {
+            for (int i = 0; i < perProducer; ++i)
+            {
+                sut.push({p, i});
+            }
+        });
+    }
+
+    for (int c = 0; c < consumerCount; ++c)
+    {
+        threads.emplace_back([&sut, &consumed, &received, c]
+        {
+            while (consumed.load() < producerCount * perProducer)
+            {
+                if (auto value = sut.pop())
+                {
+                    received[c].push_back(*value);
+                    ++consumed;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_TRUE(sut.empty());
+
+    // Every consumer sees values of a producer in the order they were pushed
+    std::vector<int> count(producerCount);
+    for (const auto& values : received)
+    {
+        std::vector<int> last(producerCount, -1);
+        for (const auto& [producer, i] : values)
+        {
+            ASSERT_LT(last[producer], i);
+            last[producer] = i;
+            ++count[producer];
+        }
+    }
+
+    for (int p = 0; p < producerCount; ++p)
+    {
+        ASSERT_EQ(perProducer, count[p]);
+    }
+}
@@ -0,0 +1,94 @@
+#include "LockFreeStack.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+TEST(TestLockFreeStack, ShouldPopInReverseOrder)
+{
+    LockFreeStack<std::string> sut;
+    ASSERT_TRUE(sut.empty());
+    ASSERT_FALSE(sut.pop().has_value());
+
+    sut.push("a");
+    sut.push(std::string("b"));
+    sut.emplace(3, 'c');
+
+    ASSERT_FALSE(sut.empty());
+    ASSERT_EQ("ccc", sut.pop());
+    ASSERT_EQ("b", sut.pop());
+    ASSERT_EQ("a", sut.pop());
+    ASSERT_FALSE(sut.pop().has_value());
+    ASSERT_TRUE(sut.empty());
+}
+
+TEST(TestLockFreeStack, ShouldDestroyRemainingElements)
+{
+    auto counter = std::make_shared<int>(0);
+    {
+        LockFreeStack<std::shared_ptr<int>> sut;
+        for (int i = 0; i < 10; ++i)
+        {
+            sut.push(counter);
+        }
+        sut.pop();
+        ASSERT_EQ(10, counter.use_count());
+    }
+
+    ASSERT_EQ(1, counter.use_count());
+}
+
+TEST(TestLockFreeStack, ShouldNotLoseElementsInConcurrentPushPop)
+{
+    constexpr int threadCount = 4;
+    constexpr int perThread = 20'000;
+
+    LockFreeStack<int> sut;
+    std::vector<std::vector<int>> popped(threadCount);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&sut, &popped, t]
+        {
+            // Each thread pushes own values and pops whatever it finds
+            for (int i = 0; i < perThread; ++i)
+            {
+                sut.push(t * perThread + i);
+                if (auto value = sut.pop())
+                {
+                    popped[t].push_back(*value);
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<int> all;
+    for (const auto& values : popped)
+    {
+        all.insert(all.end(), values.begin(), values.end());
+    }
+    while (auto value = sut.pop())
+    {
+        all.push_back(*value);
+    }
+
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(static_cast<size_t>(threadCount * perThread), all.size());
+    for (int i = 0; i < threadCount * perThread; ++i)
+    {
+        ASSERT_EQ(i, all[i]);
+    }
+}
@@ -0,0 +1,169 @@
+#include "NodePool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+struct TestNode
+{
+    TestNode(std::string v, TestNode* n): value(std::move(v)), next(n) {}
+    std::string value;
+    TestNode* next = nullptr;
+};
+
+TEST(TestNodePool, ShouldCreateNodesFromBlocks)
+{
+    NodePool<TestNode> sut;
+    ASSERT_EQ(0, sut.block_count());
+
+    std::vector<TestNode*> nodes;
+    for (int i = 0; i < 100; ++i)
+    {
+        nodes.push_back(sut.create(std::to_string(i), nullptr));
+    }
+
+    // 16 + 32 + 64 slots
+    ASSERT_EQ(3, sut.block_count());
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(std::to_string(i), nodes[i]->value);
+    }
+
+    for (auto* node : nodes)
+    {
+        sut.destroy(node);
+    }
+}
+
+TEST(TestNodePool, ShouldRecycleDestroyedNodes)
+{
+    NodePool<TestNode> sut;
+
+    auto* node1 = sut.create("1", nullptr);
+    auto* node2 = sut.create("2", node1);
+    sut.destroy(node2);
+    sut.destroy(node1);
+
+    const std::set<TestNode*> freed{node1, node2};
+    auto* node3 = sut.create("3", nullptr);
+    auto* node4 = sut.create("4", nullptr);
+    ASSERT_TRUE(freed.count(node3));
+    ASSERT_TRUE(freed.count(node4));
+    ASSERT_EQ(1, sut.block_count());
+
+    sut.destroy(node3);
+    sut.destroy(node4);
+}
+
+TEST(TestNodePool, ShouldReleaseAllBlocks)
+{
+    NodePool<int> sut;
+    for (int i = 0; i < 1000; ++i)
+    {
+        sut.create(i);
+    }
+
+    sut.release();
+    ASSERT_EQ(0, sut.block_count());
+
+    ASSERT_EQ(5, *sut.create(5));
+    ASSERT_EQ(1, sut.block_count());
+}
+
+TEST(TestNodePool, ShouldKeepSharedBlocksOfOtherPool)
+{
+    NodePool<int> sut;
+    int* own = sut.create(1);
+    int* moved = nullptr;
+    {
+        NodePool<int> other;
+        moved = other.create(2);
+        sut.share(other);
+
+        // Shared block is full for other, it carves a new one
+        for (int i = 0; i < 16; ++i)
+        {
+            other.destroy(other.create(i));
+        }
+        ASSERT_EQ(1, other.block_count());
+    }
+
+    ASSERT_EQ(1, *own);
+    ASSERT_EQ(2, *moved);
+
+    sut.destroy(moved);
+    ASSERT_EQ(moved, sut.create(3));
+    ASSERT_EQ(1, sut.block_count());
+}
+
+TEST(TestNodePool, ShouldAdoptBlocksOfOtherPool)
+{
+    NodePool<int> sut;
+    int* own = sut.create(1);
+    int* moved = nullptr;
+    {
+        NodePool<int> other;
+        moved = other.create(2);
+
+        // Sharing the same pool repeatedly keeps a single reference to its arena
+        sut.share(other);
+        sut.share(other);
+        sut.adopt(other);
+        ASSERT_EQ(0, other.block_count());
+
+        ASSERT_EQ(3, *other.create(3));
+        ASSERT_EQ(1, other.block_count());
+    }
+
+    ASSERT_EQ(1, *own);
+    ASSERT_EQ(2, *moved);
+    ASSERT_EQ(1, sut.block_count());
+
+    sut.destroy(moved);
+    ASSERT_EQ(moved, sut.create(4));
+}
+
+TEST(TestNodePool, ShouldTakeOtherPoolIfEmpty)
+{
+    NodePool<int> sut;
+    NodePool<int> other;
+    int* moved = other.create(1);
+
+    sut.adopt(other);
+    ASSERT_EQ(1, sut.block_count());
+    ASSERT_EQ(0, other.block_count());
+    ASSERT_EQ(1, *moved);
+
+    sut.destroy(moved);
+    ASSERT_EQ(moved, sut.create(2));
+}
+
+TEST(TestNodePool, ShouldKeepLastBlockOnTrim)
+{
+    NodePool<int> sut;
+    std::vector<int*> nodes;
+    for (int i = 0; i < 100; ++i)
+    {
+        nodes.push_back(sut.create(i));
+    }
+    ASSERT_EQ(3, sut.block_count());
+
+    for (auto* node : nodes)
+    {
+        sut.destroy(node);
+    }
+    sut.trim();
+    ASSERT_EQ(1, sut.block_count());
+
+    // Carving restarts from the most recent block
+    for (int i = 0; i < 64; ++i)
+    {
+        sut.create(i);
+    }
+    ASSERT_EQ(1, sut.block_count());
+}
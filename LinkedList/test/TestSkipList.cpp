@@ -0,0 +1,144 @@
+#include "SkipList.hpp"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+TEST(TestSkipList, ShouldInsertAndFind)
+{
+    SkipList<int, std::string> sut;
+    ASSERT_TRUE(sut.empty());
+    ASSERT_EQ(sut.end(), sut.find(1));
+
+    ASSERT_TRUE(sut.insert({5, "five"}).second);
+    ASSERT_TRUE(sut.insert({1, "one"}).second);
+    ASSERT_TRUE(sut.try_emplace(3, 3, 'c').second);
+
+    const auto [it, inserted] = sut.insert({5, "FIVE"});
+    ASSERT_FALSE(inserted);
+    ASSERT_EQ("five", it->second);
+
+    ASSERT_EQ(3, sut.size());
+    ASSERT_EQ("ccc", sut.find(3)->second);
+    ASSERT_TRUE(sut.contains(1));
+    ASSERT_FALSE(sut.contains(2));
+
+    sut.find(1)->second = "uno";
+    ASSERT_EQ("uno", sut.find(1)->second);
+}
+
+TEST(TestSkipList, ShouldIterateInOrder)
+{
+    SkipList<int, int, std::greater<int>> sut{{2, 20}, {7, 70}, {4, 40}, {9, 90}};
+
+    std::vector<int> keys;
+    for (const auto& [key, value] : sut)
+    {
+        ASSERT_EQ(key * 10, value);
+        keys.push_back(key);
+    }
+    ASSERT_EQ((std::vector<int>{9, 7, 4, 2}), keys);
+
+    // Range [7, 3) in descending order
+    keys.clear();
+    for (auto it = sut.lower_bound(7); it != sut.lower_bound(3); ++it)
+    {
+        keys.push_back(it->first);
+    }
+    ASSERT_EQ((std::vector<int>{7, 4}), keys);
+
+    ASSERT_EQ(4, sut.upper_bound(7)->first);
+    ASSERT_EQ(sut.end(), sut.lower_bound(1));
+}
+
+TEST(TestSkipList, ShouldErase)
+{
+    SkipList<int, std::unique_ptr<int>> sut;
+    for (int i = 0; i < 10; ++i)
+    {
+        sut.try_emplace(i, std::make_unique<int>(i));
+    }
+
+    ASSERT_EQ(1, sut.erase(4));
+    ASSERT_EQ(0, sut.erase(4));
+    ASSERT_EQ(9, sut.size());
+    ASSERT_EQ(5, sut.lower_bound(4)->first);
+
+    auto it = sut.erase(sut.find(0));
+    ASSERT_EQ(1, it->first);
+    ASSERT_EQ(sut.end(), sut.erase(sut.find(9)));
+    ASSERT_EQ(7, sut.size());
+    ASSERT_EQ(1, sut.begin()->first);
+
+    sut.clear();
+    ASSERT_TRUE(sut.empty());
+    ASSERT_EQ(sut.begin(), sut.end());
+    sut.try_emplace(1, std::make_unique<int>(1));
+    ASSERT_EQ(1, *sut.find(1)->second);
+}
+
+TEST(TestSkipList, ShouldCopyAndMove)
+{
+    SkipList<int, std::string> source{{1, "a"}, {2, "b"}, {3, "c"}};
+
+    SkipList<int, std::string> copy(source);
+    copy.erase(2);
+    ASSERT_EQ(3, source.size());
+    ASSERT_EQ(2, copy.size());
+    ASSERT_EQ("c", copy.find(3)->second);
+
+    SkipList<int, std::string> moved(std::move(source));
+    ASSERT_EQ(3, moved.size());
+    ASSERT_TRUE(source.empty());
+
+    copy = moved;
+    ASSERT_EQ("b", copy.find(2)->second);
+
+    moved = SkipList<int, std::string>{{7, "g"}};
+    ASSERT_EQ(1, moved.size());
+    ASSERT_EQ("g", moved.begin()->second);
+}
+
+TEST(TestSkipList, ShouldMatchStdMapOnRandomOperations)
+{
+    SkipList<int, int> sut;
+    std::map<int, int> expected;
+
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> key(0, 999);
+    for (int i = 0; i < 20000; ++i)
+    {
+        const int k = key(gen);
+        switch (gen() % 3)
+        {
+        case 0:
+            ASSERT_EQ(expected.insert({k, i}).second, sut.insert({k, i}).second);
+            break;
+        case 1:
+            ASSERT_EQ(expected.erase(k), sut.erase(k));
+            break;
+        default:
+        {
+            const auto it = expected.lower_bound(k);
+            const auto sutIt = sut.lower_bound(k);
+            ASSERT_EQ(it == expected.end(), sutIt == sut.end());
+            if (it != expected.end())
+            {
+                ASSERT_EQ(it->first, sutIt->first);
+                ASSERT_EQ(it->second, sutIt->second);
+            }
+        }
+        }
+    }
+
+    ASSERT_EQ(expected.size(), sut.size());
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), sut.begin(), sut.end()));
+}
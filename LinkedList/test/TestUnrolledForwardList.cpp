@@ -0,0 +1,315 @@
+#include "UnrolledForwardList.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <forward_list>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+// Small nodes to exercise splitting and unlinking
+template <typename T>
+using SmallList = UnrolledForwardList<T, 4>;
+
+// Helper functions
+template <typename List>
+auto traverse(const List& list)
+{
+    std::vector<typename List::value_type> values;
+
+    for (const auto& elem : list)
+    {
+        values.push_back(elem);
+    }
+
+    return values;
+}
+
+TEST(TestUnrolledForwardList, ShouldChooseNodeCapacityFromElementSize)
+{
+    ASSERT_GT(UnrolledForwardList<char>::node_capacity, UnrolledForwardList<int>::node_capacity);
+    ASSERT_GT(UnrolledForwardList<int>::node_capacity, UnrolledForwardList<double>::node_capacity);
+    ASSERT_EQ((UnrolledForwardList<std::array<char, 1024>>::node_capacity), 1);
+}
+
+TEST(TestUnrolledForwardList, ShouldPushBackAndPushFrontTheList)
+{
+    SmallList<int> list;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        list.push_back(i);
+        list.push_front(-i - 1);
+    }
+
+    ASSERT_EQ(list.size(), 20);
+    ASSERT_EQ(list.front(), -10);
+    ASSERT_EQ(list.back(), 9);
+    ASSERT_THAT(traverse(list), ElementsAreArray({-10, -9, -8, -7, -6, -5, -4, -3, -2, -1,
+                                                  0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST(TestUnrolledForwardList, ShouldPopFrontTheList)
+{
+    SmallList<std::string> list{"a", "b", "c", "d", "e", "f"};
+
+    list.pop_front();
+    list.pop_front();
+    list.pop_front();
+    list.pop_front();
+    ASSERT_THAT(traverse(list), ElementsAreArray({"e", "f"}));
+
+    list.pop_front();
+    list.pop_front();
+    list.pop_front();
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.begin(), list.end());
+    ASSERT_THROW(list.front(), std::runtime_error);
+    ASSERT_THROW(list.back(), std::runtime_error);
+
+    list.push_back("x");
+    ASSERT_EQ(list.front(), "x");
+    ASSERT_EQ(list.back(), "x");
+}
+
+TEST(TestUnrolledForwardList, ShouldInsertAfterAndSplitFullNode)
+{
+    SmallList<int> list{0, 1, 2, 3};
+
+    // Node is full: inserting after element 2 splits it, iterator keeps pointing to 2
+    auto it = list.begin();
+    it += 2;
+    list.insert_after(it, 20);
+    ASSERT_EQ(*it, 2);
+
+    list.insert_after(it, 21);
+    ++it;
+    ASSERT_EQ(*it, 21);
+
+    auto last = list.begin();
+    last += list.size() - 1;
+    list.insert_after(last, 4);
+
+    ASSERT_EQ(list.size(), 7);
+    ASSERT_EQ(list.back(), 4);
+    ASSERT_THAT(traverse(list), ElementsAreArray({0, 1, 2, 21, 20, 3, 4}));
+}
+
+TEST(TestUnrolledForwardList, ShouldInsertAfterLastElementOfSingleElementNodes)
+{
+    UnrolledForwardList<int, 1> list{0, 1, 2};
+
+    // Every node is full: each insertion links a new node holding the value
+    auto it = list.begin();
+    list.insert_after(it, 10);
+    ASSERT_EQ(*it, 0);
+
+    it += 2;
+    list.insert_after(it, 11);
+    ASSERT_EQ(*it, 1);
+
+    auto last = list.begin();
+    last += list.size() - 1;
+    list.insert_after(last, 3);
+
+    ASSERT_EQ(list.size(), 6);
+    ASSERT_EQ(list.back(), 3);
+    ASSERT_THAT(traverse(list), ElementsAreArray({0, 10, 1, 11, 2, 3}));
+}
+
+TEST(TestUnrolledForwardList, ShouldInsertAfterLastElementOfOddCapacityNode)
+{
+    UnrolledForwardList<int, 3> list{0, 1, 2, 3, 4, 5};
+
+    // Inserting after the last element of the first (full) node
+    auto it = list.begin();
+    it += 2;
+    list.insert_after(it, 20);
+    ASSERT_EQ(*it, 2);
+
+    // Inserting after the middle element of a full node splits it
+    it = list.begin();
+    ++it;
+    list.insert_after(it, 10);
+    ASSERT_EQ(*it, 1);
+
+    auto last = list.begin();
+    last += list.size() - 1;
+    list.insert_after(last, 6);
+
+    ASSERT_EQ(list.size(), 9);
+    ASSERT_EQ(list.back(), 6);
+    ASSERT_THAT(traverse(list), ElementsAreArray({0, 1, 10, 2, 20, 3, 4, 5, 6}));
+}
+
+// Copy throws when copiesLeft runs out
+struct ThrowingCopy
+{
+    static inline int copiesLeft = 0;
+
+    ThrowingCopy(int v): value(v) {}
+    ThrowingCopy(const ThrowingCopy& other): value(other.value)
+    {
+        if (copiesLeft-- <= 0) throw std::runtime_error("copy failed");
+    }
+    ThrowingCopy& operator= (const ThrowingCopy&) = default;
+
+    int value;
+};
+
+TEST(TestUnrolledForwardList, ShouldKeepListIntactIfNewNodeValueThrows)
+{
+    UnrolledForwardList<ThrowingCopy, 2> list;
+    ThrowingCopy::copiesLeft = 2;
+    list.push_back(1);
+    list.push_back(2);
+
+    // Head and tail node is full: each insertion needs a new node
+    const ThrowingCopy value(3);
+    ASSERT_THROW(list.push_back(value), std::runtime_error);
+    ASSERT_THROW(list.push_front(value), std::runtime_error);
+    auto it = list.begin();
+    ++it;
+    ASSERT_THROW(list.insert_after(it, value), std::runtime_error);
+
+    ASSERT_EQ(list.size(), 2);
+    ASSERT_EQ(list.front().value, 1);
+    ASSERT_EQ(list.back().value, 2);
+
+    std::vector<int> values;
+    for (const auto& elem : list)
+    {
+        values.push_back(elem.value);
+    }
+    ASSERT_THAT(values, ElementsAre(1, 2));
+}
+
+TEST(TestUnrolledForwardList, ShouldEraseAfterAcrossNodes)
+{
+    SmallList<int> list{0, 1, 2, 3, 4, 5};
+
+    // Element after the last one of the first node is the head of the second node
+    auto it = list.begin();
+    it += 3;
+    auto next = list.erase_after(it);
+    ASSERT_EQ(*next, 5);
+
+    next = list.erase_after(it);
+    ASSERT_EQ(next, list.end());
+    ASSERT_EQ(list.back(), 3);
+    ASSERT_EQ(list.erase_after(it), list.end());
+
+    it = list.begin();
+    next = list.erase_after(it);
+    ASSERT_EQ(*next, 2);
+
+    ASSERT_EQ(list.size(), 3);
+    ASSERT_THAT(traverse(list), ElementsAreArray({0, 2, 3}));
+
+    list.push_back(6);
+    ASSERT_THAT(traverse(list), ElementsAreArray({0, 2, 3, 6}));
+}
+
+TEST(TestUnrolledForwardList, ShouldMatchStdForwardListOnRandomOperations)
+{
+    SmallList<int> list;
+    std::forward_list<int> expected;
+    std::mt19937 gen(42);
+
+    list.push_back(0);
+    expected.push_front(0);
+
+    for (int i = 1; i < 2000; ++i)
+    {
+        const size_t size = list.size();
+        const auto pos = static_cast<long>(gen() % size);
+
+        auto it = list.begin();
+        it += pos;
+        auto exp_it = std::next(expected.begin(), pos);
+
+        if (gen() % 3 == 0 && static_cast<size_t>(pos) + 1 < size)
+        {
+            list.erase_after(it);
+            expected.erase_after(exp_it);
+        }
+        else
+        {
+            list.insert_after(it, i);
+            expected.insert_after(exp_it, i);
+        }
+    }
+
+    ASSERT_EQ(list.size(), static_cast<size_t>(std::distance(expected.begin(), expected.end())));
+    ASSERT_THAT(traverse(list), ElementsAreArray(expected.begin(), expected.end()));
+}
+
+TEST(TestUnrolledForwardList, ShouldReverseTheList)
+{
+    SmallList<int> list{0, 1, 2, 3, 4, 5, 6};
+
+    list.reverse();
+
+    ASSERT_EQ(list.front(), 6);
+    ASSERT_EQ(list.back(), 0);
+    ASSERT_THAT(traverse(list), ElementsAreArray({6, 5, 4, 3, 2, 1, 0}));
+
+    list.push_back(-1);
+    ASSERT_EQ(list.back(), -1);
+}
+
+TEST(TestUnrolledForwardList, ShouldSortTheList)
+{
+    SmallList<int> list{5, -3, 8, 0, 5, 12, -7, 1, 1};
+
+    list.sort();
+
+    ASSERT_THAT(traverse(list), ElementsAreArray({-7, -3, 0, 1, 1, 5, 5, 8, 12}));
+    ASSERT_EQ(list.back(), 12);
+}
+
+TEST(TestUnrolledForwardList, ShouldSortMoveOnlyElements)
+{
+    SmallList<std::unique_ptr<int>> list;
+    for (const int value : {3, -1, 4, 1, 5, -9, 2, 6})
+    {
+        list.push_back(std::make_unique<int>(value));
+    }
+    list.push_front(std::make_unique<int>(0));
+
+    // Sorted by address: values are checked to be all there
+    list.sort();
+
+    std::vector<int> values;
+    for (const auto& ptr : list)
+    {
+        values.push_back(*ptr);
+    }
+    ASSERT_THAT(values, UnorderedElementsAre(0, 3, -1, 4, 1, 5, -9, 2, 6));
+    ASSERT_EQ(9u, list.size());
+}
+
+TEST(TestUnrolledForwardList, ShouldCopyAndMoveList)
+{
+    SmallList<std::string> list{"one", "two", "three", "four", "five"};
+
+    SmallList<std::string> copy(list);
+    list.front() = "changed";
+    ASSERT_THAT(traverse(copy), ElementsAreArray({"one", "two", "three", "four", "five"}));
+
+    SmallList<std::string> moved(std::move(copy));
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(moved.size(), 5);
+
+    copy = moved;
+    moved.clear();
+    ASSERT_EQ(copy.back(), "five");
+    ASSERT_TRUE(moved.empty());
+}
@@ -39,12 +39,12 @@ namespace detail
         {
         }
 
-        pointer operator-> ()
+        pointer operator-> () const
         {
             return m_currentElemPtr;
         }
 
-        reference operator* ()
+        reference operator* () const
         {
             return *m_currentElemPtr;
         }
@@ -108,8 +108,8 @@ namespace AlgoStruct
         using const_reference = const value_type&;
         using pointer = value_type*;
         using const_pointer = const value_type*;
-        using iterator = detail::Iterator<RingBuffer<T>, detail::NonConstTraits<T>>;
-        using const_iterator = detail::Iterator<RingBuffer<T>, detail::ConstTraits<T>>;
+        using iterator = ::detail::Iterator<RingBuffer<T>, ::detail::NonConstTraits<T>>;
+        using const_iterator = ::detail::Iterator<RingBuffer<T>, ::detail::ConstTraits<T>>;
         using reverse_iterator = std::reverse_iterator<iterator>;
         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
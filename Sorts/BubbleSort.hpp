@@ -1,48 +1,51 @@
-#include <utility>
+#pragma once
+
+#include "Comparator.hpp"
+
+#include <algorithm>
 #include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
 
 namespace AlgoStruct
 {
-    // j ->     <- i
-    // 2  4  1  5  3
-    //   
-    // j        i
-    // 2  4  1  3 [5]
-    // 
-    // j     i
-    // 2  3  1 [4] 5
+    // Each pass swaps adjacent elements which are out of order and carries the greatest one to
+    // the end of the unsorted part. Elements after the last swap of a pass are in place already
     //
-    // j  i
-    // 2  1 [3] 4  5
+    // 2 [4  1] 5  3        2  1  4 [5  3]      ->   2  1  4  3 | 5
+    // [2  1] 4  3 | 5      1  2 [4  3] | 5     ->   1  2  3 | 4  5
+    // 1  2  3 | 4  5       no swaps            ->   1  2  3  4  5
     //
-    // 1 [2] 3  4  5
-
-    template<class Container, class Comparator = std::greater<typename Container::value_type>>
-    void BubbleSort(Container& container, Comparator comparator = {})
+    // Stable, O(n^2), one pass for presorted input. Elements are ordered by projection(element)
+    template<std::forward_iterator ForwardIt, class Comparator = std::greater<>, class Projection = std::identity>
+    void BubbleSort(ForwardIt first, ForwardIt last, Comparator comparator = {}, Projection projection = {})
     {
-        if (container.size() < 2)
-        {
-            return;
-        }
+        auto greater = detail::projected(std::move(comparator), std::move(projection));
 
-        bool isSorted = true;
-
-        for (typename Container::size_type i = container.size() - 1; i > 0; --i)
+        // End of the unsorted part
+        ForwardIt bound = last;
+        while (bound != first)
         {
-            for (typename Container::size_type j = 0; j < i; ++j)
+            ForwardIt lastSwap = first;
+            ForwardIt prev = first;
+            for (ForwardIt it = std::next(first); it != bound; ++it)
             {
-                if (comparator(container[j], container[i]))
+                if (greater(*prev, *it))
                 {
-                    using namespace std;
-                    swap(container[j], container[i]);
-                    isSorted = false;
+                    std::iter_swap(prev, it);
+                    lastSwap = it;
                 }
+                prev = it;
             }
 
-            if (isSorted)
-            {
-                return;
-            }
+            bound = lastSwap;
         }
     }
+
+    template<std::ranges::forward_range Range, class Comparator = std::greater<>, class Projection = std::identity>
+    void BubbleSort(Range&& range, Comparator comparator = {}, Projection projection = {})
+    {
+        BubbleSort(std::ranges::begin(range), detail::range_last(range), std::move(comparator), std::move(projection));
+    }
 } // namespace AlgoStruct
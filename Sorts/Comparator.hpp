@@ -0,0 +1,77 @@
+#pragma once
+
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace AlgoStruct
+{
+    namespace detail
+    {
+        // Sorts of the library take "greater" comparator: comparator(a, b) is true if a goes after b.
+        // Algorithms inside are written with strict "less" ordering as in std, this adapter turns
+        // one into another. Equal elements are neither less nor greater, so stability is preserved
+        template<class Comparator>
+        struct AsLess
+        {
+            template<class A, class B>
+            bool operator()(A&& lhs, B&& rhs)
+            {
+                return comparator(std::forward<B>(rhs), std::forward<A>(lhs));
+            }
+
+            Comparator comparator;
+        };
+
+        template<class Comparator>
+        AsLess<Comparator> as_less(Comparator comparator)
+        {
+            return AsLess<Comparator>{std::move(comparator)};
+        }
+
+        // Comparator of projections of the elements, as in std::ranges algorithms: elements are
+        // ordered by projection(element)
+        template<class Comparator, class Projection>
+        struct Projected
+        {
+            template<class A, class B>
+            bool operator()(A&& lhs, B&& rhs)
+            {
+                return std::invoke(comparator, std::invoke(projection, lhs), std::invoke(projection, rhs));
+            }
+
+            Comparator comparator;
+            Projection projection;
+        };
+
+        // Identity projection leaves the comparator as it is, so that sorts still recognize the
+        // standard comparators and use branchless partitions and sorting networks for them
+        template<class Comparator, class Projection>
+        auto projected(Comparator comparator, Projection projection)
+        {
+            if constexpr (std::is_same_v<Projection, std::identity>)
+            {
+                return comparator;
+            }
+            else
+            {
+                return Projected<Comparator, Projection>{std::move(comparator), std::move(projection)};
+            }
+        }
+
+        template<class Comparator, class Projection>
+        auto as_less(Comparator comparator, Projection projection)
+        {
+            return as_less(projected(std::move(comparator), std::move(projection)));
+        }
+
+        // Iterator to the end of a range with a sentinel of another type: constant time for sized ranges
+        template<std::ranges::range Range>
+        std::ranges::iterator_t<Range> range_last(Range& range)
+        {
+            return std::ranges::next(std::ranges::begin(range), std::ranges::end(range));
+        }
+    } // namespace detail
+} // namespace AlgoStruct
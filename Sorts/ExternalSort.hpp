@@ -0,0 +1,393 @@
+#pragma once
+
+#include "Comparator.hpp"
+#include "PdqSort.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace AlgoStruct
+{
+    struct ExternalSortOptions
+    {
+        // Bytes of memory for records and I/O buffers: the size of sorted runs and of all merge
+        // buffers together
+        size_t memoryBudget = size_t{256} << 20;
+        // The smallest read of a run in the merge. Runs are read in turns, each read is a seek on
+        // a disk, so the merge fan-in is limited to keep reads at least this long
+        size_t minReadSize = size_t{256} << 10;
+        // Runs are spilled here, the system temp directory if empty
+        std::filesystem::path tempDirectory;
+    };
+
+    struct ExternalSortStats
+    {
+        // Sorted runs spilled to disk, 1 if the file fits in the memory budget
+        size_t runCount = 0;
+        // Reads and writes of all records by the merge, the last one writes the output
+        size_t mergePassCount = 0;
+    };
+
+    namespace detail
+    {
+        // Runs merged at once at most, each needs an open file
+        constexpr size_t ExternalSortMaxFanIn = 512;
+
+        struct FileCloser
+        {
+            void operator()(std::FILE* file) const noexcept { std::fclose(file); }
+        };
+
+        using FilePtr = std::unique_ptr<std::FILE, FileCloser>;
+
+        // Reads and writes go through our own large buffers, stdio buffering would copy them once more
+        inline FilePtr open_file(const std::filesystem::path& path, const char* mode)
+        {
+            FilePtr file(std::fopen(path.string().c_str(), mode));
+            if (!file)
+            {
+                throw std::system_error(errno, std::generic_category(), "ExternalSort: can't open " + path.string());
+            }
+            std::setvbuf(file.get(), nullptr, _IONBF, 0);
+            return file;
+        }
+
+        template<class T>
+        void read_records(std::FILE* file, T* data, size_t count)
+        {
+            if (std::fread(data, sizeof(T), count, file) != count)
+            {
+                throw std::runtime_error("ExternalSort: read error");
+            }
+        }
+
+        template<class T>
+        void write_records(std::FILE* file, const T* data, size_t count)
+        {
+            if (std::fwrite(data, sizeof(T), count, file) != count)
+            {
+                throw std::runtime_error("ExternalSort: write error");
+            }
+        }
+
+        inline void get_position(std::FILE* file, std::fpos_t& position)
+        {
+            if (std::fgetpos(file, &position) != 0)
+            {
+                throw std::runtime_error("ExternalSort: seek error");
+            }
+        }
+
+        // File with a unique name in the directory, removed with the object
+        class TempFile
+        {
+        public:
+            explicit TempFile(const std::filesystem::path& directory)
+            {
+                static std::mt19937_64 gen(std::random_device{}());
+                for (int attempt = 0; attempt < 100 && !m_file; ++attempt)
+                {
+                    m_path = directory / ("algo_struct_sort_" + std::to_string(gen()) + ".tmp");
+                    // "x": fails if the file exists
+                    m_file.reset(std::fopen(m_path.string().c_str(), "w+bx"));
+                }
+                if (!m_file)
+                {
+                    throw std::system_error(errno, std::generic_category(), "ExternalSort: can't create a file in " + directory.string());
+                }
+                std::setvbuf(m_file.get(), nullptr, _IONBF, 0);
+            }
+
+            ~TempFile()
+            {
+                m_file.reset();
+                std::error_code error;
+                std::filesystem::remove(m_path, error);
+            }
+
+            TempFile(const TempFile&) = delete;
+            TempFile& operator=(const TempFile&) = delete;
+
+            std::FILE* get() const noexcept { return m_file.get(); }
+            const std::filesystem::path& path() const noexcept { return m_path; }
+
+        private:
+            std::filesystem::path m_path;
+            FilePtr m_file;
+        };
+
+        // Sorted run in a temp file: position of the first record and record count
+        struct ExternalRun
+        {
+            std::fpos_t start;
+            size_t size;
+        };
+
+        // Reads a run block by block into its part of the merge memory
+        template<class T>
+        class RunReader
+        {
+        public:
+            RunReader(const std::filesystem::path& path, const ExternalRun& run, T* buffer, size_t bufferSize)
+                : m_file(open_file(path, "rb")), m_buffer(buffer), m_bufferSize(bufferSize), m_left(run.size)
+            {
+                if (std::fsetpos(m_file.get(), &run.start) != 0)
+                {
+                    throw std::runtime_error("ExternalSort: seek error");
+                }
+            }
+
+            // Next record of the run, nullptr after the last one
+            const T* next()
+            {
+                if (m_pos == m_count)
+                {
+                    if (m_left == 0)
+                    {
+                        return nullptr;
+                    }
+                    m_count = std::min(m_bufferSize, m_left);
+                    m_left -= m_count;
+                    m_pos = 0;
+                    read_records(m_file.get(), m_buffer, m_count);
+                }
+                return m_buffer + m_pos++;
+            }
+
+        private:
+            FilePtr m_file;
+            T* m_buffer;
+            size_t m_bufferSize;
+            size_t m_left;
+            size_t m_pos = 0;
+            size_t m_count = 0;
+        };
+
+        template<class T>
+        class RecordWriter
+        {
+        public:
+            RecordWriter(std::FILE* file, T* buffer, size_t bufferSize) : m_file(file), m_buffer(buffer), m_bufferSize(bufferSize) {}
+
+            void push(const T& record)
+            {
+                if (m_count == m_bufferSize)
+                {
+                    flush();
+                }
+                m_buffer[m_count++] = record;
+            }
+
+            void flush()
+            {
+                write_records(m_file, m_buffer, m_count);
+                m_count = 0;
+            }
+
+        private:
+            std::FILE* m_file;
+            T* m_buffer;
+            size_t m_bufferSize;
+            size_t m_count = 0;
+        };
+
+        // Tournament tree for the k-way merge. Internal nodes keep the loser of the match below
+        // them and node 0 the overall winner, so replacing the winner replays only the matches on
+        // its path to the root: log2(k) comparisons against a heap's 2 * log2(k). Sources are
+        // pointers to their current elements, nullptr for exhausted ones which lose every match.
+        // Ties go to the lower source, so merging runs in their order is stable. At least one source
+        template<class T, class Less>
+        class LoserTree
+        {
+        public:
+            LoserTree(std::vector<const T*> heads, Less& less) : m_heads(std::move(heads)), m_tree(m_heads.size()), m_less(less)
+            {
+                m_tree[0] = build(1);
+            }
+
+            // The least current element, nullptr when all sources are exhausted
+            const T* top() const noexcept { return m_heads[m_tree[0]]; }
+            size_t top_source() const noexcept { return m_tree[0]; }
+
+            // Replaces the current element of the winner source with its next one
+            void replace_top(const T* next)
+            {
+                size_t winner = m_tree[0];
+                m_heads[winner] = next;
+                for (size_t node = (winner + m_heads.size()) / 2; node > 0; node /= 2)
+                {
+                    if (beats(m_tree[node], winner))
+                    {
+                        std::swap(m_tree[node], winner);
+                    }
+                }
+                m_tree[0] = winner;
+            }
+
+        private:
+            // Source k is the leaf at node k + size, leaves are the children of nodes 1 ... size - 1
+            size_t build(size_t node)
+            {
+                if (node >= m_heads.size())
+                {
+                    return node - m_heads.size();
+                }
+
+                const size_t left = build(2 * node);
+                const size_t right = build(2 * node + 1);
+                const bool leftWins = beats(left, right);
+                m_tree[node] = leftWins ? right : left;
+                return leftWins ? left : right;
+            }
+
+            bool beats(size_t lhs, size_t rhs)
+            {
+                if (!m_heads[lhs] || !m_heads[rhs])
+                {
+                    return m_heads[lhs] != nullptr;
+                }
+                return lhs < rhs ? !m_less(*m_heads[rhs], *m_heads[lhs]) : m_less(*m_heads[lhs], *m_heads[rhs]);
+            }
+
+            std::vector<const T*> m_heads;
+            std::vector<size_t> m_tree;
+            Less& m_less;
+        };
+
+        // Merges runs of the file into the output with fanIn + 1 equal blocks of the memory:
+        // one per run and one for the output
+        template<class T, class Less>
+        void merge_runs(const std::filesystem::path& path, const ExternalRun* runs, size_t fanIn, std::FILE* output,
+                        T* memory, size_t memorySize, Less& less)
+        {
+            const size_t blockSize = memorySize / (fanIn + 1);
+
+            std::vector<RunReader<T>> readers;
+            readers.reserve(fanIn);
+            std::vector<const T*> heads;
+            for (size_t run = 0; run < fanIn; ++run)
+            {
+                readers.emplace_back(path, runs[run], memory + run * blockSize, blockSize);
+                heads.push_back(readers.back().next());
+            }
+
+            RecordWriter<T> writer(output, memory + fanIn * blockSize, blockSize);
+            LoserTree<T, Less> tree(std::move(heads), less);
+            while (const T* record = tree.top())
+            {
+                writer.push(*record);
+                tree.replace_top(readers[tree.top_source()].next());
+            }
+            writer.flush();
+        }
+
+        template<class T, class Less>
+        ExternalSortStats external_sort(const std::filesystem::path& input, const std::filesystem::path& output,
+                                        const ExternalSortOptions& options, Less& less)
+        {
+            const size_t memorySize = options.memoryBudget / sizeof(T);
+            if (memorySize < 3)
+            {
+                throw std::invalid_argument("ExternalSort: memory budget is less than 3 records");
+            }
+
+            const auto inputBytes = std::filesystem::file_size(input);
+            if (inputBytes % sizeof(T) != 0)
+            {
+                throw std::invalid_argument("ExternalSort: file size is not a multiple of the record size");
+            }
+            const size_t size = static_cast<size_t>(inputBytes / sizeof(T));
+
+            // Whatever the type, records are bytes of the file: no construction needed
+            auto memory = std::make_unique_for_overwrite<T[]>(memorySize);
+            ExternalSortStats stats;
+
+            // The whole file in memory: no runs. Input is closed before the output is opened, so
+            // they may be the same file
+            if (size <= memorySize)
+            {
+                read_records(open_file(input, "rb").get(), memory.get(), size);
+                PdqSort(memory.get(), memory.get() + size, less.comparator);
+                write_records(open_file(output, "wb").get(), memory.get(), size);
+                stats.runCount = 1;
+                return stats;
+            }
+
+            const auto tempDirectory = options.tempDirectory.empty() ? std::filesystem::temp_directory_path() : options.tempDirectory;
+            auto runFile = std::make_unique<TempFile>(tempDirectory);
+            std::vector<ExternalRun> runs;
+            {
+                auto inputFile = open_file(input, "rb");
+                for (size_t done = 0; done < size; done += memorySize)
+                {
+                    const size_t runSize = std::min(memorySize, size - done);
+                    read_records(inputFile.get(), memory.get(), runSize);
+                    PdqSort(memory.get(), memory.get() + runSize, less.comparator);
+
+                    ExternalRun& run = runs.emplace_back(ExternalRun{{}, runSize});
+                    get_position(runFile->get(), run.start);
+                    write_records(runFile->get(), memory.get(), runSize);
+                }
+            }
+            stats.runCount = runs.size();
+            std::fflush(runFile->get());
+
+            const size_t readBlocks = options.memoryBudget / std::max<size_t>(options.minReadSize, sizeof(T));
+            // Budget below two reads still merges pairs of runs
+            const size_t maxFanIn = std::clamp<size_t>(readBlocks > 2 ? readBlocks - 1 : 2, 2, std::min(ExternalSortMaxFanIn, memorySize - 1));
+
+            // Passes merge groups of maxFanIn runs into longer runs until one pass is enough
+            while (runs.size() > maxFanIn)
+            {
+                auto mergedFile = std::make_unique<TempFile>(tempDirectory);
+                std::vector<ExternalRun> merged;
+                for (size_t first = 0; first < runs.size(); first += maxFanIn)
+                {
+                    const size_t fanIn = std::min(maxFanIn, runs.size() - first);
+                    ExternalRun& run = merged.emplace_back(ExternalRun{{}, 0});
+                    get_position(mergedFile->get(), run.start);
+                    for (size_t i = first; i < first + fanIn; ++i)
+                    {
+                        run.size += runs[i].size;
+                    }
+                    merge_runs(runFile->path(), runs.data() + first, fanIn, mergedFile->get(), memory.get(), memorySize, less);
+                }
+                std::fflush(mergedFile->get());
+
+                runFile = std::move(mergedFile);
+                runs = std::move(merged);
+                ++stats.mergePassCount;
+            }
+
+            merge_runs(runFile->path(), runs.data(), runs.size(), open_file(output, "wb").get(), memory.get(), memorySize, less);
+            ++stats.mergePassCount;
+            return stats;
+        }
+    } // namespace detail
+
+    // Sorts a binary file of trivially copyable records of type T into the output file, which may
+    // be the input itself. Runs of memoryBudget bytes are sorted with PdqSort and spilled to temp
+    // files, then merged with a loser tree in as few passes as the budget allows. Not stable.
+    // Throws std::system_error if files can't be opened and std::runtime_error on I/O errors,
+    // the output is incomplete then
+    template<class T, class Comparator = std::greater<T>>
+        requires std::is_trivially_copyable_v<T>
+    ExternalSortStats ExternalSort(const std::filesystem::path& input, const std::filesystem::path& output,
+                                   const ExternalSortOptions& options = {}, Comparator comparator = {})
+    {
+        auto less = detail::as_less(std::move(comparator));
+        return detail::external_sort<T>(input, output, options, less);
+    }
+} // namespace AlgoStruct
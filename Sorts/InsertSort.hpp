@@ -1,4 +1,11 @@
+#pragma once
+
+#include "Comparator.hpp"
+
 #include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
 
 namespace AlgoStruct
 {
@@ -20,27 +27,46 @@ namespace AlgoStruct
     //
     // 1  2  3  4  5
 
-    template<class Container, class Comparator = std::greater<typename Container::value_type>>
-    void InsertSort(Container& container, Comparator comparator = {})
+    namespace detail
     {
-        if (container.size() < 2)
-        {
-            return;
-        }
-
-        for (typename Container::size_type i = 1; i < container.size(); ++i)
+        // Stable: an element is moved only over the greater ones
+        template<class BidirIt, class Less>
+        void insert_sort(BidirIt first, BidirIt last, Less& less)
         {
-            const auto tmp = container[i];;
-            auto j = i;
-
-            while (j > 0 && !comparator(tmp, container[j - 1]))
+            if (first == last)
             {
-                container[j] = container[j - 1];
-                --j;
+                return;
             }
 
-            container[j] = tmp;
+            for (BidirIt i = std::next(first); i != last; ++i)
+            {
+                auto tmp = std::move(*i);
+                BidirIt j = i;
+
+                while (j != first && less(tmp, *std::prev(j)))
+                {
+                    *j = std::move(*std::prev(j));
+                    --j;
+                }
+
+                *j = std::move(tmp);
+            }
         }
+    } // namespace detail
+
+    // Sorts range [first, last), used for small parts of the range in other sorts. Stable, O(n^2),
+    // O(n) for presorted input. Elements are ordered by projection(element)
+    template<std::bidirectional_iterator BidirIt, class Comparator = std::greater<>, class Projection = std::identity>
+    void InsertSort(BidirIt first, BidirIt last, Comparator comparator = {}, Projection projection = {})
+    {
+        auto less = detail::as_less(std::move(comparator), std::move(projection));
+        detail::insert_sort(first, last, less);
+    }
+
+    template<std::ranges::bidirectional_range Range, class Comparator = std::greater<>, class Projection = std::identity>
+    void InsertSort(Range&& range, Comparator comparator = {}, Projection projection = {})
+    {
+        InsertSort(std::ranges::begin(range), detail::range_last(range), std::move(comparator), std::move(projection));
     }
 } // namespace AlgoStruct
 
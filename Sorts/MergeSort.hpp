@@ -0,0 +1,249 @@
+#pragma once
+
+#include "Comparator.hpp"
+#include "InsertSort.hpp"
+#include "SortingNetwork.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace AlgoStruct
+{
+    namespace detail
+    {
+        // Ranges of this size and less are sorted with a sorting network or insertion sort
+        constexpr std::ptrdiff_t MergeSortInsertThreshold = NetworkSortMaxSmall;
+
+        // Stable merge of sorted [first, mid) and [mid, last) into out. Equal elements are taken
+        // from the left part first
+        template<class InIt, class OutIt, class Less>
+        void merge_move(InIt first, InIt mid, InIt last, OutIt out, Less& less)
+        {
+            // Parts are already in order: common for presorted input
+            if (!less(*mid, *(mid - 1)))
+            {
+                std::move(first, last, out);
+                return;
+            }
+
+            InIt left = first;
+            InIt right = mid;
+            while (left != mid && right != last)
+            {
+                if (less(*right, *left))
+                {
+                    *out = std::move(*right);
+                    ++right;
+                }
+                else
+                {
+                    *out = std::move(*left);
+                    ++left;
+                }
+                ++out;
+            }
+
+            out = std::move(left, mid, out);
+            std::move(right, last, out);
+        }
+
+        template<class It, class BufIt, class Less>
+        void merge_sort_to(It first, It last, BufIt out, Less& less);
+
+        // Sorts [first, last) in place, [buffer, buffer + size) is scratch space
+        //
+        //   data:    [ 5 2 7 | 1 8 3 ]      halves are sorted into the buffer
+        //   buffer:  [ 2 5 7 | 1 3 8 ]  ->  merged back into data: [ 1 2 3 5 7 8 ]
+        //
+        // Sorting a half into the buffer uses the matching half of the data as scratch, so source
+        // and destination alternate between levels and no element is copied back
+        template<class It, class BufIt, class Less>
+        void merge_sort_in_place(It first, It last, BufIt buffer, Less& less)
+        {
+            const std::ptrdiff_t size = last - first;
+            if (size <= MergeSortInsertThreshold)
+            {
+                small_sort<true>(first, last, less);
+                return;
+            }
+
+            const std::ptrdiff_t half = size / 2;
+            merge_sort_to(first, first + half, buffer, less);
+            merge_sort_to(first + half, last, buffer + half, less);
+            merge_move(buffer, buffer + half, buffer + size, first, less);
+        }
+
+        // Sorts [first, last) into [out, out + size), the source range is scratch space
+        template<class It, class BufIt, class Less>
+        void merge_sort_to(It first, It last, BufIt out, Less& less)
+        {
+            const std::ptrdiff_t size = last - first;
+            if (size <= MergeSortInsertThreshold)
+            {
+                small_sort<true>(first, last, less);
+                std::move(first, last, out);
+                return;
+            }
+
+            const std::ptrdiff_t half = size / 2;
+            merge_sort_in_place(first, first + half, out, less);
+            merge_sort_in_place(first + half, last, out + half, less);
+            merge_move(first, first + half, last, out, less);
+        }
+
+        // Insertion sort of size elements from first for iterators which can't go back: an element
+        // less than the one before it is rotated into place after the elements not greater than it.
+        // Returns the iterator to the last element
+        template<class ForwardIt, class Less>
+        ForwardIt forward_insert_sort(ForwardIt first, std::ptrdiff_t size, Less& less)
+        {
+            ForwardIt back = first;
+            for (std::ptrdiff_t i = 1; i < size; ++i)
+            {
+                const ForwardIt it = std::next(back);
+                if (less(*it, *back))
+                {
+                    ForwardIt pos = first;
+                    while (!less(*it, *pos))
+                    {
+                        ++pos;
+                    }
+                    std::rotate(pos, it, std::next(it));
+                }
+                back = it;
+            }
+            return back;
+        }
+
+        // Merges sorted [first, mid) and [mid, last) in place: the left part is moved into the
+        // buffer and merged with the right one from first. Merged elements never get ahead of
+        // the right part, the gap between them is as long as the rest of the buffer
+        template<class ForwardIt, class T, class Less>
+        void forward_merge(ForwardIt first, ForwardIt mid, ForwardIt last, std::vector<T>& buffer, Less& less)
+        {
+            buffer.clear();
+            for (ForwardIt it = first; it != mid; ++it)
+            {
+                buffer.push_back(std::move(*it));
+            }
+
+            auto left = buffer.begin();
+            ForwardIt right = mid;
+            ForwardIt out = first;
+            try
+            {
+                while (left != buffer.end() && right != last)
+                {
+                    if (less(*right, *left))
+                    {
+                        *out = std::move(*right);
+                        ++right;
+                    }
+                    else
+                    {
+                        *out = std::move(*left);
+                        ++left;
+                    }
+                    ++out;
+                }
+            }
+            catch (...)
+            {
+                // The gap is filled with the rest of the buffer, all the elements are kept
+                std::move(left, buffer.end(), out);
+                throw;
+            }
+
+            std::move(left, buffer.end(), out);
+        }
+
+        // Top-down merge sort of size elements from first, halves are found by counting. Returns
+        // the iterator to the last element, so that sorted halves are not merged
+        template<class ForwardIt, class T, class Less>
+        ForwardIt forward_merge_sort(ForwardIt first, std::ptrdiff_t size, std::vector<T>& buffer, Less& less)
+        {
+            if (size <= MergeSortInsertThreshold)
+            {
+                return forward_insert_sort(first, size, less);
+            }
+
+            const std::ptrdiff_t half = size / 2;
+            const ForwardIt leftBack = forward_merge_sort(first, half, buffer, less);
+            const ForwardIt mid = std::next(leftBack);
+            const ForwardIt back = forward_merge_sort(mid, size - half, buffer, less);
+
+            if (less(*mid, *leftBack))
+            {
+                forward_merge(first, mid, std::next(back), buffer, less);
+            }
+            return back;
+        }
+    } // namespace detail
+
+    // Top-down merge sort with one auxiliary buffer for the whole sort and insertion sort for small
+    // ranges. Stable, O(n log n), O(n) extra memory. Elements are moved into the buffer first, so
+    // the values have to be move constructible only
+    template<std::random_access_iterator RandomIt, class Comparator = std::greater<>, class Projection = std::identity>
+        requires std::indirect_strict_weak_order<Comparator&, std::projected<RandomIt, Projection>>
+    void MergeSort(RandomIt first, RandomIt last, Comparator comparator = {}, Projection projection = {})
+    {
+        if (last - first < 2)
+        {
+            return;
+        }
+
+        auto less = detail::as_less(std::move(comparator), std::move(projection));
+        std::vector<std::iter_value_t<RandomIt>> buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+        detail::merge_sort_to(buffer.begin(), buffer.end(), first, less);
+    }
+
+    // Same with caller-supplied scratch space of at least last - first elements, which is
+    // overwritten. No allocations
+    template<std::random_access_iterator RandomIt, class Comparator = std::greater<>, class Projection = std::identity>
+    void MergeSort(RandomIt first, RandomIt last, std::span<std::iter_value_t<RandomIt>> scratch, Comparator comparator = {},
+                   Projection projection = {})
+    {
+        if (scratch.size() < static_cast<size_t>(last - first))
+        {
+            throw std::invalid_argument("MergeSort: scratch space is less than the range");
+        }
+
+        auto less = detail::as_less(std::move(comparator), std::move(projection));
+        detail::merge_sort_in_place(first, last, scratch.begin(), less);
+    }
+
+    // Same for forward and bidirectional iterators, e.g. of lists: halves are found by counting
+    // and merged in place through a buffer of half of the elements. Elements are moved, nodes
+    // of lists stay where they are. Stable, O(n log n), O(n / 2) extra memory. If the comparator
+    // throws, the range keeps all of its elements in unspecified order
+    template<std::forward_iterator ForwardIt, class Comparator = std::greater<>, class Projection = std::identity>
+        requires (!std::random_access_iterator<ForwardIt>) &&
+                 std::indirect_strict_weak_order<Comparator&, std::projected<ForwardIt, Projection>>
+    void MergeSort(ForwardIt first, ForwardIt last, Comparator comparator = {}, Projection projection = {})
+    {
+        const std::ptrdiff_t size = std::ranges::distance(first, last);
+        if (size < 2)
+        {
+            return;
+        }
+
+        auto less = detail::as_less(std::move(comparator), std::move(projection));
+        std::vector<std::iter_value_t<ForwardIt>> buffer;
+        buffer.reserve(static_cast<size_t>(size / 2));
+        detail::forward_merge_sort(first, size, buffer, less);
+    }
+
+    template<std::ranges::forward_range Range, class Comparator = std::greater<>, class Projection = std::identity>
+    void MergeSort(Range&& range, Comparator comparator = {}, Projection projection = {})
+    {
+        MergeSort(std::ranges::begin(range), detail::range_last(range), std::move(comparator), std::move(projection));
+    }
+} // namespace AlgoStruct
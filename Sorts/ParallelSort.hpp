@@ -0,0 +1,431 @@
+#pragma once
+
+#include "Comparator.hpp"
+#include "MergeSort.hpp"
+#include "PdqSort.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace AlgoStruct
+{
+    // Ranges of this size and less are sorted or merged by one thread. Smaller grain gives the pool
+    // more tasks to balance, larger one less scheduling overhead
+    constexpr size_t ParallelSortGrainSize = 1 << 15;
+
+    namespace detail
+    {
+        // Buckets of the sample sort before equality buckets are added, bucket indices are
+        // stored as uint16_t
+        constexpr size_t SampleSortMaxBuckets = 1024;
+        // Sample elements per bucket: more of them give more even buckets
+        constexpr size_t SampleSortOversampling = 16;
+
+        // Uninitialized storage for size elements. The owner constructs and destroys elements
+        template<class T>
+        class RawBuffer
+        {
+        public:
+            explicit RawBuffer(size_t size) : m_data(std::allocator<T>{}.allocate(size)), m_size(size) {}
+            ~RawBuffer() { std::allocator<T>{}.deallocate(m_data, m_size); }
+
+            RawBuffer(const RawBuffer&) = delete;
+            RawBuffer& operator=(const RawBuffer&) = delete;
+
+            T* data() const noexcept { return m_data; }
+
+        private:
+            T* m_data;
+            size_t m_size;
+        };
+
+        // Destroys [first, last) when leaving the scope
+        template<class T>
+        struct DestroyGuard
+        {
+            ~DestroyGuard() { std::destroy(first, last); }
+
+            T* first;
+            T* last;
+        };
+
+        // Chunks of at least grain elements, a few per thread so that uneven ones even out
+        inline size_t parallel_chunk_count(const ThreadPool& pool, size_t size, size_t grain)
+        {
+            return std::clamp<size_t>(size / grain, 1, 4 * (pool.size() + 1));
+        }
+
+        // Calls func(chunk, begin, end) for chunkCount equal chunks of [0, size) on the pool.
+        // Chunk bounds depend on size and chunkCount only
+        template<class Func>
+        void parallel_for_chunks(ThreadPool& pool, size_t size, size_t chunkCount, Func&& func)
+        {
+            TaskGroup group(pool);
+            for (size_t chunk = 1; chunk < chunkCount; ++chunk)
+            {
+                group.run([&func, size, chunkCount, chunk]
+                {
+                    func(chunk, size * chunk / chunkCount, size * (chunk + 1) / chunkCount);
+                });
+            }
+
+            func(0, 0, size / chunkCount);
+            group.wait();
+        }
+
+        // Stable merge of sorted [first1, last1) and [first2, last2) into out, equal elements are
+        // taken from the first range first. Long merges are split in two independent ones at the
+        // middle of the longer range and the bound of that element in the other one:
+        //
+        //   first:   [ 1 3 | 5 7 9 ]
+        //   second:  [ 2 4 | 6 8 ]        lower bound of 5
+        //
+        //   out:     [ merge(1 3, 2 4) | merge(5 7 9, 6 8) ]
+        //
+        // grain has to be at least 2 for both halves to be shorter than the merge
+        template<class InIt, class OutIt, class Less>
+        void parallel_merge_move(ThreadPool& pool, InIt first1, InIt last1, InIt first2, InIt last2, OutIt out,
+                                 std::ptrdiff_t grain, Less& less)
+        {
+            const std::ptrdiff_t size1 = last1 - first1;
+            const std::ptrdiff_t size2 = last2 - first2;
+
+            if (size1 + size2 <= grain)
+            {
+                if (size1 != 0 && size2 != 0 && less(*first2, *(last1 - 1)))
+                {
+                    std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+                               std::make_move_iterator(first2), std::make_move_iterator(last2), out, std::ref(less));
+                }
+                else
+                {
+                    std::move(first2, last2, std::move(first1, last1, out));
+                }
+                return;
+            }
+
+            // Elements of the second range equal to the split one go after it, elements of the
+            // first range equal to the split one go before it
+            InIt mid1;
+            InIt mid2;
+            if (size1 >= size2)
+            {
+                mid1 = first1 + size1 / 2;
+                mid2 = std::lower_bound(first2, last2, *mid1, std::ref(less));
+            }
+            else
+            {
+                mid2 = first2 + size2 / 2;
+                mid1 = std::upper_bound(first1, last1, *mid2, std::ref(less));
+            }
+            const OutIt outMid = out + (mid1 - first1) + (mid2 - first2);
+
+            TaskGroup group(pool);
+            group.run([&]{ parallel_merge_move(pool, first1, mid1, first2, mid2, out, grain, less); });
+            parallel_merge_move(pool, mid1, last1, mid2, last2, outMid, grain, less);
+            group.wait();
+        }
+
+        template<class It, class BufIt, class Less>
+        void parallel_merge_sort_to(ThreadPool& pool, It first, It last, BufIt out, std::ptrdiff_t grain, Less& less);
+
+        // merge_sort_in_place with halves sorted on different threads and a parallel merge
+        template<class It, class BufIt, class Less>
+        void parallel_merge_sort_in_place(ThreadPool& pool, It first, It last, BufIt buffer, std::ptrdiff_t grain, Less& less)
+        {
+            const std::ptrdiff_t size = last - first;
+            if (size <= grain)
+            {
+                merge_sort_in_place(first, last, buffer, less);
+                return;
+            }
+
+            const std::ptrdiff_t half = size / 2;
+            {
+                TaskGroup group(pool);
+                group.run([&]{ parallel_merge_sort_to(pool, first, first + half, buffer, grain, less); });
+                parallel_merge_sort_to(pool, first + half, last, buffer + half, grain, less);
+                group.wait();
+            }
+            parallel_merge_move(pool, buffer, buffer + half, buffer + half, buffer + size, first, grain, less);
+        }
+
+        // merge_sort_to with halves sorted on different threads and a parallel merge
+        template<class It, class BufIt, class Less>
+        void parallel_merge_sort_to(ThreadPool& pool, It first, It last, BufIt out, std::ptrdiff_t grain, Less& less)
+        {
+            const std::ptrdiff_t size = last - first;
+            if (size <= grain)
+            {
+                merge_sort_to(first, last, out, less);
+                return;
+            }
+
+            const std::ptrdiff_t half = size / 2;
+            {
+                TaskGroup group(pool);
+                group.run([&]{ parallel_merge_sort_in_place(pool, first, first + half, out, grain, less); });
+                parallel_merge_sort_in_place(pool, first + half, last, out + half, grain, less);
+                group.wait();
+            }
+            parallel_merge_move(pool, first, first + half, first + half, last, out, grain, less);
+        }
+
+        // Index of the bucket for value: number of splitters not greater than it. Binary search
+        // without branches over bucketCount - 1 sorted splitters, bucketCount is a power of two
+        template<class T, class Less>
+        size_t find_bucket(const T& value, const T* splitters, size_t bucketCount, Less& less)
+        {
+            size_t bucket = 0;
+            for (size_t step = bucketCount / 2; step != 0; step /= 2)
+            {
+                bucket += step * static_cast<size_t>(!less(value, splitters[bucket + step - 1]));
+            }
+            return bucket;
+        }
+
+        // Buckets of the sample sort defined by splitters, evenly spaced elements of a sorted sample.
+        // Repeated splitters are kept once and every splitter gets an equality bucket for the
+        // elements equal to it, as in IPS4o: these are sorted already, so few unique keys spread
+        // over many buckets instead of landing in one, which is sorted by one thread
+        //
+        //   splitters:   2  2  5  5      ->   < 2 | = 2 | (2, 5) | = 5 | > 5
+        template<class T>
+        class SampleSortBuckets
+        {
+        public:
+            template<class Less>
+            SampleSortBuckets(const std::vector<T>& sample, size_t bucketCount, Less& less)
+            {
+                m_splitters.reserve(bucketCount - 1);
+                for (size_t bucket = 1; bucket < bucketCount; ++bucket)
+                {
+                    const T& splitter = sample[bucket * sample.size() / bucketCount];
+                    if (m_splitters.empty() || less(m_splitters.back(), splitter))
+                    {
+                        m_splitters.push_back(splitter);
+                    }
+                    else
+                    {
+                        m_equalityBuckets = true;
+                    }
+                }
+
+                // Branchless search runs over bucketCount - 1 splitters: the last one is repeated
+                m_distinct = m_splitters.size();
+                m_searchBuckets = bucketCount;
+                m_splitters.resize(bucketCount - 1, m_splitters.back());
+            }
+
+            size_t bucket_count() const noexcept
+            {
+                return m_equalityBuckets ? 2 * m_distinct + 1 : m_distinct + 1;
+            }
+
+            bool is_equality_bucket(size_t bucket) const noexcept
+            {
+                return m_equalityBuckets && bucket % 2 == 1;
+            }
+
+            template<class Less>
+            size_t classify(const T& value, Less& less) const
+            {
+                const size_t bucket = std::min(find_bucket(value, m_splitters.data(), m_searchBuckets, less), m_distinct);
+                if (!m_equalityBuckets)
+                {
+                    return bucket;
+                }
+
+                // Splitter before the bucket is not greater than value: equal unless less
+                return 2 * bucket - static_cast<size_t>(bucket != 0 && !less(m_splitters[bucket - 1], value));
+            }
+
+        private:
+            std::vector<T> m_splitters;
+            size_t m_distinct = 0;
+            size_t m_searchBuckets = 0;
+            bool m_equalityBuckets = false;
+        };
+
+        // Splitter 5, two blocks and two buckets:
+        //
+        //   input:    [ 7 2 9 4 | 1 8 3 6 ]      blocks are classified in parallel
+        //   buffer:   [ 2 4 1 3 | 7 9 8 6 ]      blocks scatter to their own parts of the buckets
+        //   output:   [ 1 2 3 4 | 6 7 8 9 ]      buckets are sorted in parallel and moved back
+        template<class RandomIt, class Comparator>
+        void sample_sort(ThreadPool& pool, RandomIt first, RandomIt last, size_t grain, const Comparator& comparator)
+        {
+            using T = std::iter_value_t<RandomIt>;
+
+            const size_t size = static_cast<size_t>(last - first);
+            const size_t threadCount = pool.size() + 1;
+            if (threadCount == 1 || size <= grain)
+            {
+                PdqSort(first, last, comparator);
+                return;
+            }
+
+            // A few buckets per thread of about grain elements or more
+            const size_t sampleBuckets = std::bit_floor(std::clamp<size_t>(std::min(size / grain, 4 * threadCount), 2, SampleSortMaxBuckets));
+
+            // Splitters are evenly spaced elements of a sorted random sample
+            const size_t sampleSize = std::min(size, sampleBuckets * SampleSortOversampling);
+            std::vector<T> sample;
+            sample.reserve(sampleSize);
+            uint64_t state = size * 0x9E3779B97F4A7C15ull | 1;
+            for (size_t i = 0; i < sampleSize; ++i)
+            {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                sample.push_back(first[static_cast<std::ptrdiff_t>(state % size)]);
+            }
+            PdqSort(sample.begin(), sample.end(), comparator);
+
+            auto sampleLess = as_less(comparator);
+            const SampleSortBuckets<T> buckets(sample, sampleBuckets, sampleLess);
+            const size_t bucketCount = buckets.bucket_count();
+
+            // offsets[block * bucketCount + bucket]: number of elements of the block in the bucket,
+            // then position of the first of them in the buffer
+            const size_t blockCount = parallel_chunk_count(pool, size, grain);
+            std::vector<size_t> offsets(blockCount * bucketCount);
+            RawBuffer<uint16_t> bucketOf(size);
+
+            parallel_for_chunks(pool, size, blockCount, [&](size_t block, size_t begin, size_t end)
+            {
+                auto blockLess = as_less(comparator);
+                std::vector<size_t> counts(bucketCount);
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const size_t bucket = buckets.classify(first[static_cast<std::ptrdiff_t>(i)], blockLess);
+                    bucketOf.data()[i] = static_cast<uint16_t>(bucket);
+                    ++counts[bucket];
+                }
+                std::copy(counts.begin(), counts.end(), offsets.begin() + static_cast<std::ptrdiff_t>(block * bucketCount));
+            });
+
+            // Buckets follow each other in the buffer, blocks inside a bucket too
+            std::vector<size_t> bucketStart(bucketCount + 1);
+            size_t position = 0;
+            for (size_t bucket = 0; bucket < bucketCount; ++bucket)
+            {
+                bucketStart[bucket] = position;
+                for (size_t block = 0; block < blockCount; ++block)
+                {
+                    position += std::exchange(offsets[block * bucketCount + bucket], position);
+                }
+            }
+            bucketStart[bucketCount] = size;
+
+            RawBuffer<T> buffer(size);
+            T* const out = buffer.data();
+            parallel_for_chunks(pool, size, blockCount, [&](size_t block, size_t begin, size_t end)
+            {
+                size_t* const positions = offsets.data() + block * bucketCount;
+                for (size_t i = begin; i < end; ++i)
+                {
+                    std::construct_at(out + positions[bucketOf.data()[i]]++, std::move(first[static_cast<std::ptrdiff_t>(i)]));
+                }
+            });
+            DestroyGuard<T> guard{out, out + size};
+
+            TaskGroup group(pool);
+            for (size_t bucket = 0; bucket < bucketCount; ++bucket)
+            {
+                auto sortBucket = [&, bucket]
+                {
+                    T* const bucketFirst = out + bucketStart[bucket];
+                    T* const bucketLast = out + bucketStart[bucket + 1];
+                    if (!buckets.is_equality_bucket(bucket))
+                    {
+                        PdqSort(bucketFirst, bucketLast, comparator);
+                    }
+                    std::move(bucketFirst, bucketLast, first + static_cast<std::ptrdiff_t>(bucketStart[bucket]));
+                };
+
+                if (bucket + 1 < bucketCount)
+                {
+                    group.run(sortBucket);
+                }
+                else
+                {
+                    sortBucket();
+                }
+            }
+            group.wait();
+        }
+    } // namespace detail
+
+    // Stable merge sort on the pool: halves are sorted in parallel down to grainSize elements and
+    // long merges are split into independent ones by binary search, so the last merges don't run
+    // on one thread. O(n log n), O(n) extra memory. Comparator is called from several threads
+    // at once
+    template<std::random_access_iterator RandomIt, class Comparator = std::greater<>, class Projection = std::identity>
+        requires std::is_nothrow_move_constructible_v<std::iter_value_t<RandomIt>>
+    void ParallelMergeSort(ThreadPool& pool, RandomIt first, RandomIt last, Comparator comparator = {},
+                           size_t grainSize = ParallelSortGrainSize, Projection projection = {})
+    {
+        using T = std::iter_value_t<RandomIt>;
+
+        const size_t size = static_cast<size_t>(last - first);
+        if (size < 2)
+        {
+            return;
+        }
+
+        auto less = detail::as_less(std::move(comparator), std::move(projection));
+        const auto grain = static_cast<std::ptrdiff_t>(std::max<size_t>(grainSize, detail::MergeSortInsertThreshold));
+
+        // Filling the buffer on one thread would take as long as the rest of the sort on many
+        detail::RawBuffer<T> buffer(size);
+        detail::parallel_for_chunks(pool, size, detail::parallel_chunk_count(pool, size, static_cast<size_t>(grain)),
+                                    [&](size_t, size_t begin, size_t end)
+        {
+            std::uninitialized_move(first + static_cast<std::ptrdiff_t>(begin), first + static_cast<std::ptrdiff_t>(end), buffer.data() + begin);
+        });
+        detail::DestroyGuard<T> guard{buffer.data(), buffer.data() + size};
+
+        detail::parallel_merge_sort_to(pool, buffer.data(), buffer.data() + size, first, grain, less);
+    }
+
+    template<std::ranges::random_access_range Range, class Comparator = std::greater<>, class Projection = std::identity>
+    void ParallelMergeSort(ThreadPool& pool, Range&& range, Comparator comparator = {},
+                           size_t grainSize = ParallelSortGrainSize, Projection projection = {})
+    {
+        ParallelMergeSort(pool, std::ranges::begin(range), detail::range_last(range), std::move(comparator), grainSize,
+                          std::move(projection));
+    }
+
+    // Sample sort on the pool: splitters from a random sample define a few buckets per thread,
+    // blocks of the range are scattered into the buckets in parallel and the buckets are sorted
+    // with PdqSort independently. Keys equal to a repeated splitter get buckets of their own,
+    // which need no sorting. Not stable, O(n log n), O(n) extra memory. Comparator is called
+    // from several threads at once
+    template<std::random_access_iterator RandomIt, class Comparator = std::greater<>, class Projection = std::identity>
+        requires std::copy_constructible<std::iter_value_t<RandomIt>> &&
+                 std::is_nothrow_move_constructible_v<std::iter_value_t<RandomIt>>
+    void ParallelSort(ThreadPool& pool, RandomIt first, RandomIt last, Comparator comparator = {},
+                      size_t grainSize = ParallelSortGrainSize, Projection projection = {})
+    {
+        detail::sample_sort(pool, first, last, std::max<size_t>(grainSize, 2), detail::projected(std::move(comparator), std::move(projection)));
+    }
+
+    template<std::ranges::random_access_range Range, class Comparator = std::greater<>, class Projection = std::identity>
+    void ParallelSort(ThreadPool& pool, Range&& range, Comparator comparator = {},
+                      size_t grainSize = ParallelSortGrainSize, Projection projection = {})
+    {
+        ParallelSort(pool, std::ranges::begin(range), detail::range_last(range), std::move(comparator), grainSize, std::move(projection));
+    }
+} // namespace AlgoStruct
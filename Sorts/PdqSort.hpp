@@ -0,0 +1,445 @@
+#pragma once
+
+#include "Comparator.hpp"
+#include "InsertSort.hpp"
+#include "QuickSort.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace AlgoStruct
+{
+    namespace detail
+    {
+        constexpr std::ptrdiff_t PdqInsertThreshold = 24;
+        constexpr std::ptrdiff_t PdqNintherThreshold = 128;
+        // Partial insertion sort gives up after this number of moves
+        constexpr std::ptrdiff_t PdqPartialInsertLimit = 8;
+        constexpr size_t PdqBlockSize = 64;
+
+        // Comparison of arithmetic keys with standard comparator compiles to a flag, which can be
+        // used in arithmetic instead of a branch
+        template<class T, class Comparator>
+        constexpr bool IsBranchlessCompare = std::is_arithmetic_v<T> && (
+            std::is_same_v<Comparator, std::greater<T>> || std::is_same_v<Comparator, std::greater<>> ||
+            std::is_same_v<Comparator, std::less<T>> || std::is_same_v<Comparator, std::less<>>);
+
+        // Insertion sort without bounds check: *(first - 1) is not greater than any element of the range
+        template<class RandomIt, class Less>
+        void unguarded_insert_sort(RandomIt first, RandomIt last, Less& less)
+        {
+            if (first == last)
+            {
+                return;
+            }
+
+            for (RandomIt i = first + 1; i != last; ++i)
+            {
+                RandomIt j = i;
+                if (less(*j, *(j - 1)))
+                {
+                    auto tmp = std::move(*j);
+                    do
+                    {
+                        *j = std::move(*(j - 1));
+                        --j;
+                    }
+                    while (less(tmp, *(j - 1)));
+                    *j = std::move(tmp);
+                }
+            }
+        }
+
+        // Insertion sort, which gives up if it has to move too many elements. True if the range is sorted
+        template<class RandomIt, class Less>
+        bool partial_insert_sort(RandomIt first, RandomIt last, Less& less)
+        {
+            if (first == last)
+            {
+                return true;
+            }
+
+            std::ptrdiff_t moves = 0;
+            for (RandomIt i = first + 1; i != last; ++i)
+            {
+                RandomIt j = i;
+                if (less(*j, *(j - 1)))
+                {
+                    auto tmp = std::move(*j);
+                    do
+                    {
+                        *j = std::move(*(j - 1));
+                        --j;
+                    }
+                    while (j != first && less(tmp, *(j - 1)));
+                    *j = std::move(tmp);
+                    moves += i - j;
+                }
+
+                if (moves > PdqPartialInsertLimit)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Partitions around pivot *first: [less than pivot] pivot [not less than pivot]. Returns pivot
+        // position and flag, that no elements were swapped. Median of 3 guarantees an element not less
+        // than pivot at the end, so the forward scan is unguarded
+        template<class RandomIt, class Less>
+        std::pair<RandomIt, bool> partition_right(RandomIt first, RandomIt last, Less& less)
+        {
+            auto pivot = std::move(*first);
+            RandomIt i = first;
+            RandomIt j = last;
+
+            while (less(*++i, pivot))
+            {
+            }
+
+            // No elements before pivot are less than it: guard the backward scan
+            if (i - 1 == first)
+            {
+                while (i < j && !less(*--j, pivot))
+                {
+                }
+            }
+            else
+            {
+                while (!less(*--j, pivot))
+                {
+                }
+            }
+
+            const bool alreadyPartitioned = i >= j;
+            while (i < j)
+            {
+                std::iter_swap(i, j);
+                while (less(*++i, pivot))
+                {
+                }
+                while (!less(*--j, pivot))
+                {
+                }
+            }
+
+            const RandomIt pivotPos = i - 1;
+            *first = std::move(*pivotPos);
+            *pivotPos = std::move(pivot);
+            return {pivotPos, alreadyPartitioned};
+        }
+
+        // Swaps num pairs of misplaced elements found by block partition. A cycle of moves is cheaper
+        // than swaps, but swaps are needed for descending input to keep it O(n)
+        template<class RandomIt>
+        void swap_offsets(RandomIt left, RandomIt right, const unsigned char* offsetsLeft, const unsigned char* offsetsRight,
+                          size_t num, bool useSwaps)
+        {
+            if (useSwaps)
+            {
+                for (size_t i = 0; i < num; ++i)
+                {
+                    std::iter_swap(left + offsetsLeft[i], right - offsetsRight[i]);
+                }
+            }
+            else if (num > 0)
+            {
+                RandomIt l = left + offsetsLeft[0];
+                RandomIt r = right - offsetsRight[0];
+                auto tmp = std::move(*l);
+                *l = std::move(*r);
+                for (size_t i = 1; i < num; ++i)
+                {
+                    l = left + offsetsLeft[i];
+                    *r = std::move(*l);
+                    r = right - offsetsRight[i];
+                    *l = std::move(*r);
+                }
+                *r = std::move(tmp);
+            }
+        }
+
+        // Same as partition_right, but without branches on comparison results (BlockQuicksort,
+        // Edelkamp and Weiss). Blocks of 64 elements are scanned from both ends, offsets of elements
+        // on the wrong side are written unconditionally and the counter grows by the comparison result:
+        //
+        //   left block:  [ 1 7 2 9 ]   offsets of elements >= pivot (5): 1 3
+        //   right block: [ 8 3 6 0 ]   offsets of elements <  pivot (5): 1 3 (from the end)
+        //
+        // Then pairs of found elements are swapped
+        template<class RandomIt, class Less>
+        std::pair<RandomIt, bool> partition_right_branchless(RandomIt first, RandomIt last, Less& less)
+        {
+            auto pivot = std::move(*first);
+            RandomIt i = first;
+            RandomIt j = last;
+
+            while (less(*++i, pivot))
+            {
+            }
+
+            if (i - 1 == first)
+            {
+                while (i < j && !less(*--j, pivot))
+                {
+                }
+            }
+            else
+            {
+                while (!less(*--j, pivot))
+                {
+                }
+            }
+
+            const bool alreadyPartitioned = i >= j;
+            if (!alreadyPartitioned)
+            {
+                std::iter_swap(i, j);
+                ++i;
+
+                alignas(64) unsigned char offsetsLeft[PdqBlockSize];
+                alignas(64) unsigned char offsetsRight[PdqBlockSize];
+
+                RandomIt leftBase = i;
+                RandomIt rightBase = j;
+                size_t numLeft = 0;
+                size_t numRight = 0;
+                size_t startLeft = 0;
+                size_t startRight = 0;
+
+                // [i, j) is not scanned yet
+                while (i < j)
+                {
+                    // Refill empty blocks, split the rest evenly if both are empty
+                    const size_t unknown = static_cast<size_t>(j - i);
+                    const size_t leftSplit = numLeft == 0 ? (numRight == 0 ? unknown / 2 : unknown) : 0;
+                    const size_t rightSplit = numRight == 0 ? (unknown - leftSplit) : 0;
+
+                    const size_t leftCount = std::min(leftSplit, PdqBlockSize);
+                    for (size_t k = 0; k < leftCount; ++k)
+                    {
+                        offsetsLeft[numLeft] = static_cast<unsigned char>(k);
+                        numLeft += !less(*i, pivot);
+                        ++i;
+                    }
+
+                    const size_t rightCount = std::min(rightSplit, PdqBlockSize);
+                    for (size_t k = 0; k < rightCount; ++k)
+                    {
+                        offsetsRight[numRight] = static_cast<unsigned char>(k + 1);
+                        numRight += less(*--j, pivot);
+                    }
+
+                    const size_t num = std::min(numLeft, numRight);
+                    swap_offsets(leftBase, rightBase, offsetsLeft + startLeft, offsetsRight + startRight, num, numLeft == numRight);
+                    numLeft -= num;
+                    numRight -= num;
+                    startLeft += num;
+                    startRight += num;
+
+                    if (numLeft == 0)
+                    {
+                        startLeft = 0;
+                        leftBase = i;
+                    }
+
+                    if (numRight == 0)
+                    {
+                        startRight = 0;
+                        rightBase = j;
+                    }
+                }
+
+                // Only one block has misplaced elements left: move them to the border
+                if (numLeft)
+                {
+                    while (numLeft--)
+                    {
+                        std::iter_swap(leftBase + offsetsLeft[startLeft + numLeft], --j);
+                    }
+                    i = j;
+                }
+
+                if (numRight)
+                {
+                    while (numRight--)
+                    {
+                        std::iter_swap(rightBase - offsetsRight[startRight + numRight], i);
+                        ++i;
+                    }
+                }
+            }
+
+            const RandomIt pivotPos = i - 1;
+            *first = std::move(*pivotPos);
+            *pivotPos = std::move(pivot);
+            return {pivotPos, alreadyPartitioned};
+        }
+
+        // Partitions around pivot *first: [not greater than pivot] pivot [greater than pivot]. Used when
+        // pivot is equal to the element before the range, so the left part is all equal and done
+        template<class RandomIt, class Less>
+        RandomIt partition_left(RandomIt first, RandomIt last, Less& less)
+        {
+            auto pivot = std::move(*first);
+            RandomIt i = first;
+            RandomIt j = last;
+
+            while (less(pivot, *--j))
+            {
+            }
+
+            if (j + 1 == last)
+            {
+                while (i < j && !less(pivot, *++i))
+                {
+                }
+            }
+            else
+            {
+                while (!less(pivot, *++i))
+                {
+                }
+            }
+
+            while (i < j)
+            {
+                std::iter_swap(i, j);
+                while (less(pivot, *--j))
+                {
+                }
+                while (!less(pivot, *++i))
+                {
+                }
+            }
+
+            *first = std::move(*j);
+            *j = std::move(pivot);
+            return j;
+        }
+
+        // Breaks patterns, which made the partition unbalanced, by swapping elements around quarters
+        template<class RandomIt>
+        void break_patterns(RandomIt first, RandomIt last)
+        {
+            const std::ptrdiff_t size = last - first;
+            if (size < PdqInsertThreshold)
+            {
+                return;
+            }
+
+            const std::ptrdiff_t quarter = size / 4;
+            std::iter_swap(first, first + quarter);
+            std::iter_swap(last - 1, last - quarter);
+
+            if (size > PdqNintherThreshold)
+            {
+                std::iter_swap(first + 1, first + (quarter + 1));
+                std::iter_swap(first + 2, first + (quarter + 2));
+                std::iter_swap(last - 2, last - (quarter + 1));
+                std::iter_swap(last - 3, last - (quarter + 2));
+            }
+        }
+
+        template<bool Branchless, class RandomIt, class Less>
+        void pdq_sort(RandomIt first, RandomIt last, Less& less, int badAllowed, bool leftmost)
+        {
+            while (true)
+            {
+                const std::ptrdiff_t size = last - first;
+                if (size < PdqInsertThreshold)
+                {
+                    if (leftmost) insert_sort(first, last, less);
+                    else unguarded_insert_sort(first, last, less);
+                    return;
+                }
+
+                // Median of 3 or ninther goes to *first
+                const std::ptrdiff_t half = size / 2;
+                if (size > PdqNintherThreshold)
+                {
+                    sort3(first, first + half, last - 1, less);
+                    sort3(first + 1, first + (half - 1), last - 2, less);
+                    sort3(first + 2, first + (half + 1), last - 3, less);
+                    sort3(first + (half - 1), first + half, first + (half + 1), less);
+                    std::iter_swap(first, first + half);
+                }
+                else
+                {
+                    sort3(first + half, first, last - 1, less);
+                }
+
+                // Element before the range is the pivot of the previous partition and is not greater
+                // than any element here. If it is equal to the new pivot, there are many equal elements:
+                // put them to the left, they need no more sorting
+                if (!leftmost && !less(*(first - 1), *first))
+                {
+                    first = partition_left(first, last, less) + 1;
+                    continue;
+                }
+
+                const auto [pivotPos, alreadyPartitioned] = Branchless
+                    ? partition_right_branchless(first, last, less)
+                    : partition_right(first, last, less);
+
+                const std::ptrdiff_t leftSize = pivotPos - first;
+                const std::ptrdiff_t rightSize = last - (pivotPos + 1);
+
+                if (leftSize < size / 8 || rightSize < size / 8)
+                {
+                    // Too many bad pivots: guarantee O(n log n)
+                    if (--badAllowed == 0)
+                    {
+                        heap_sort(first, last, less);
+                        return;
+                    }
+
+                    break_patterns(first, pivotPos);
+                    break_patterns(pivotPos + 1, last);
+                }
+                else if (alreadyPartitioned &&
+                         partial_insert_sort(first, pivotPos, less) &&
+                         partial_insert_sort(pivotPos + 1, last, less))
+                {
+                    // Balanced partition without swaps: the range is probably sorted
+                    return;
+                }
+
+                pdq_sort<Branchless>(first, pivotPos, less, badAllowed, leftmost);
+                first = pivotPos + 1;
+                leftmost = false;
+            }
+        }
+    } // namespace detail
+
+    // Pattern-defeating quicksort (Orson Peters): introsort which detects sorted runs and many equal
+    // elements, breaks patterns causing bad pivots and partitions arithmetic keys in blocks without
+    // branches. O(n) on sorted, reversed and all-equal input, O(n log n) in the worst case, not stable
+    template<std::random_access_iterator RandomIt, class Comparator = std::greater<>, class Projection = std::identity>
+    void PdqSort(RandomIt first, RandomIt last, Comparator comparator = {}, Projection projection = {})
+    {
+        if (last - first < 2)
+        {
+            return;
+        }
+
+        auto less = detail::as_less(std::move(comparator), std::move(projection));
+        constexpr bool branchless = detail::IsBranchlessCompare<std::iter_value_t<RandomIt>, decltype(less.comparator)>;
+        const int badAllowed = static_cast<int>(std::bit_width(static_cast<size_t>(last - first)));
+
+        detail::pdq_sort<branchless>(first, last, less, badAllowed, true);
+    }
+
+    template<std::ranges::random_access_range Range, class Comparator = std::greater<>, class Projection = std::identity>
+    void PdqSort(Range&& range, Comparator comparator = {}, Projection projection = {})
+    {
+        PdqSort(std::ranges::begin(range), detail::range_last(range), std::move(comparator), std::move(projection));
+    }
+} // namespace AlgoStruct
@@ -0,0 +1,196 @@
+#pragma once
+
+#include "Comparator.hpp"
+#include "InsertSort.hpp"
+#include "SortingNetwork.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace AlgoStruct
+{
+    namespace detail
+    {
+        // Ranges of this size and less are finished with a sorting network or insertion sort
+        constexpr std::ptrdiff_t QuickSortInsertThreshold = NetworkSortMaxSmall;
+        // Ninther (median of three medians) pivot is used for ranges longer than this
+        constexpr std::ptrdiff_t QuickSortNintherThreshold = 128;
+
+        // Orders *a <= *b <= *c
+        template<class RandomIt, class Less>
+        void sort3(RandomIt a, RandomIt b, RandomIt c, Less& less)
+        {
+            if (less(*b, *a)) std::iter_swap(a, b);
+            if (less(*c, *b))
+            {
+                std::iter_swap(b, c);
+                if (less(*b, *a)) std::iter_swap(a, b);
+            }
+        }
+
+        template<class RandomIt, class Less>
+        void sift_down(RandomIt first, std::ptrdiff_t size, std::ptrdiff_t root, Less& less)
+        {
+            auto value = std::move(first[root]);
+
+            std::ptrdiff_t child = 2 * root + 1;
+            while (child < size)
+            {
+                if (child + 1 < size && less(first[child], first[child + 1]))
+                {
+                    ++child;
+                }
+
+                if (!less(value, first[child]))
+                {
+                    break;
+                }
+
+                first[root] = std::move(first[child]);
+                root = child;
+                child = 2 * root + 1;
+            }
+
+            first[root] = std::move(value);
+        }
+
+        // O(n log n) in the worst case: fallback of introsort for bad pivots
+        template<class RandomIt, class Less>
+        void heap_sort(RandomIt first, RandomIt last, Less& less)
+        {
+            const std::ptrdiff_t size = last - first;
+            for (std::ptrdiff_t root = size / 2; root-- > 0; )
+            {
+                sift_down(first, size, root, less);
+            }
+
+            for (std::ptrdiff_t end = size; end-- > 1; )
+            {
+                std::iter_swap(first, first + end);
+                sift_down(first, end, 0, less);
+            }
+        }
+
+        // Moves pivot to *first: median of first, middle and last elements or ninther for long ranges
+        template<class RandomIt, class Less>
+        void choose_pivot(RandomIt first, RandomIt last, Less& less)
+        {
+            const std::ptrdiff_t size = last - first;
+            const RandomIt mid = first + size / 2;
+
+            if (size > QuickSortNintherThreshold)
+            {
+                const std::ptrdiff_t step = size / 8;
+                sort3(first, first + step, first + 2 * step, less);
+                sort3(mid - step, mid, mid + step, less);
+                sort3(last - 1 - 2 * step, last - 1 - step, last - 1, less);
+                sort3(first + step, mid, last - 1 - step, less);
+            }
+            else
+            {
+                sort3(first, mid, last - 1, less);
+            }
+
+            std::iter_swap(first, mid);
+        }
+
+        // Hoare partition around pivot in *first. Scans stop on elements equal to pivot, so
+        // ranges with many equal elements are split in halves too
+        //
+        // pivot i ->           <- j
+        //   3   1  4  0  5  2  6
+        //
+        //          i        j
+        //   3   1  2  0  5  4  6     (4 <-> 2)
+        //
+        //             j  i
+        //   3   1  2  0  5  4  6     (scans met)
+        //
+        //   0   1  2 [3] 5  4  6     (pivot <-> j)
+        template<class RandomIt, class Less>
+        RandomIt hoare_partition(RandomIt first, RandomIt last, Less& less)
+        {
+            RandomIt i = first;
+            RandomIt j = last;
+
+            while (true)
+            {
+                while (++i != last && less(*i, *first))
+                {
+                }
+
+                // Stops at pivot itself at the latest
+                while (less(*first, *--j))
+                {
+                }
+
+                if (i >= j)
+                {
+                    break;
+                }
+
+                std::iter_swap(i, j);
+            }
+
+            std::iter_swap(first, j);
+            return j;
+        }
+
+        // Beyond depthLimit pivots are considered bad and the rest goes to heap sort
+        template<class RandomIt, class Less>
+        void intro_sort(RandomIt first, RandomIt last, int depthLimit, Less& less)
+        {
+            while (last - first > QuickSortInsertThreshold)
+            {
+                if (depthLimit-- == 0)
+                {
+                    heap_sort(first, last, less);
+                    return;
+                }
+
+                choose_pivot(first, last, less);
+                const RandomIt pivot = hoare_partition(first, last, less);
+
+                // Recursion into the smaller part, loop on the larger one: O(log n) stack
+                if (pivot - first < last - pivot)
+                {
+                    intro_sort(first, pivot, depthLimit, less);
+                    first = pivot + 1;
+                }
+                else
+                {
+                    intro_sort(pivot + 1, last, depthLimit, less);
+                    last = pivot;
+                }
+            }
+
+            small_sort<false>(first, last, less);
+        }
+
+        // 2 * log2(n), as in std::sort
+        template<class RandomIt>
+        int intro_sort_depth_limit(RandomIt first, RandomIt last)
+        {
+            return 2 * static_cast<int>(std::bit_width(static_cast<size_t>(last - first)));
+        }
+    } // namespace detail
+
+    // Introsort: quick sort with median-of-three or ninther pivot, heap sort if recursion gets
+    // too deep and insertion sort for small ranges. O(n log n) in the worst case, not stable
+    template<std::random_access_iterator RandomIt, class Comparator = std::greater<>, class Projection = std::identity>
+    void QuickSort(RandomIt first, RandomIt last, Comparator comparator = {}, Projection projection = {})
+    {
+        auto less = detail::as_less(std::move(comparator), std::move(projection));
+        detail::intro_sort(first, last, detail::intro_sort_depth_limit(first, last), less);
+    }
+
+    template<std::ranges::random_access_range Range, class Comparator = std::greater<>, class Projection = std::identity>
+    void QuickSort(Range&& range, Comparator comparator = {}, Projection projection = {})
+    {
+        QuickSort(std::ranges::begin(range), detail::range_last(range), std::move(comparator), std::move(projection));
+    }
+} // namespace AlgoStruct
@@ -0,0 +1,295 @@
+#pragma once
+
+#include "Comparator.hpp"
+#include "InsertSort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace AlgoStruct
+{
+    // Keys of LSD radix sort: integers and IEEE floating point numbers up to 64 bits
+    template<class T>
+    concept RadixSortKey = (std::integral<T> && !std::same_as<T, bool>) ||
+                           (std::floating_point<T> && sizeof(T) <= sizeof(uint64_t));
+
+    // Digit width of RadixSort: 8-bit digit histograms fit in L1. 11-bit digits sort 32-bit keys
+    // in 3 passes instead of 4 and 16-bit ones 64-bit keys in 4 instead of 8, which pays off
+    // on large arrays only
+    constexpr unsigned RadixSortDigitBits = 8;
+
+    namespace detail
+    {
+        // Shorter ranges are sorted with insertion sort
+        constexpr std::ptrdiff_t RadixSortInsertThreshold = 64;
+        constexpr std::ptrdiff_t MsdRadixSortInsertThreshold = 32;
+
+        // Unsigned integer with the same order as the key. Signed integers get the sign bit flipped.
+        // Negative floats get all bits flipped and positive ones the sign bit:
+        //
+        //   -2.0f  0xC0000000 -> 0x3FFFFFFF
+        //   -0.0f  0x80000000 -> 0x7FFFFFFF
+        //    0.0f  0x00000000 -> 0x80000000
+        //    2.0f  0x40000000 -> 0xC0000000
+        template<RadixSortKey T>
+        auto radix_bits(T key) noexcept
+        {
+            if constexpr (std::floating_point<T>)
+            {
+                using Bits = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+                constexpr Bits signBit = Bits{1} << (std::numeric_limits<Bits>::digits - 1);
+
+                const Bits bits = std::bit_cast<Bits>(key);
+                return static_cast<Bits>((bits & signBit) ? ~bits : bits | signBit);
+            }
+            else
+            {
+                using Bits = std::make_unsigned_t<T>;
+                constexpr Bits signBit = std::is_signed_v<T> ? Bits(Bits{1} << (std::numeric_limits<Bits>::digits - 1)) : Bits{0};
+
+                return static_cast<Bits>(static_cast<Bits>(key) ^ signBit);
+            }
+        }
+
+        template<unsigned DigitBits, class Bits>
+        size_t radix_digit(Bits bits, unsigned pass) noexcept
+        {
+            return static_cast<size_t>(bits >> (pass * DigitBits)) & ((size_t{1} << DigitBits) - 1);
+        }
+
+        // Stable distribution of src by the digit of the pass, offsets are the first positions of
+        // the digits in dst
+        template<unsigned DigitBits, class SrcIt, class DstIt, class Key>
+        void radix_scatter(SrcIt src, std::ptrdiff_t size, DstIt dst, size_t* offsets, unsigned pass, Key& key)
+        {
+            for (std::ptrdiff_t i = 0; i < size; ++i)
+            {
+                const size_t digit = radix_digit<DigitBits>(radix_bits(std::invoke(key, src[i])), pass);
+                dst[static_cast<std::ptrdiff_t>(offsets[digit]++)] = std::move(src[i]);
+            }
+        }
+
+        // Sorts data by digits of keys from the least significant one, each pass moves elements
+        // between data and buffer. Histograms of all passes are counted in one read of the data
+        // before the first pass, which also finds out if the data is sorted already. Passes where
+        // all keys have the same digit are skipped: high bytes of small numbers or timestamps
+        // cost nothing
+        template<unsigned DigitBits, class It, class BufIt, class Key>
+        void lsd_radix_sort(It data, BufIt buffer, std::ptrdiff_t size, Key& key)
+        {
+            using Bits = decltype(radix_bits(std::invoke(key, *data)));
+            constexpr unsigned PassCount = (std::numeric_limits<Bits>::digits + DigitBits - 1) / DigitBits;
+            constexpr size_t Radix = size_t{1} << DigitBits;
+
+            std::vector<size_t> counts(PassCount * Radix);
+            Bits prevBits = 0;
+            bool sorted = true;
+            for (std::ptrdiff_t i = 0; i < size; ++i)
+            {
+                const Bits bits = radix_bits(std::invoke(key, data[i]));
+                for (unsigned pass = 0; pass < PassCount; ++pass)
+                {
+                    ++counts[pass * Radix + radix_digit<DigitBits>(bits, pass)];
+                }
+
+                sorted &= prevBits <= bits;
+                prevBits = bits;
+            }
+
+            if (sorted)
+            {
+                return;
+            }
+
+            // Any element will do to find the digit common for all of them
+            const Bits firstBits = radix_bits(std::invoke(key, *data));
+            bool inBuffer = false;
+            for (unsigned pass = 0; pass < PassCount; ++pass)
+            {
+                size_t* const offsets = counts.data() + pass * Radix;
+                if (offsets[radix_digit<DigitBits>(firstBits, pass)] == static_cast<size_t>(size))
+                {
+                    continue;
+                }
+
+                size_t offset = 0;
+                for (size_t digit = 0; digit < Radix; ++digit)
+                {
+                    offset += std::exchange(offsets[digit], offset);
+                }
+
+                if (inBuffer)
+                {
+                    radix_scatter<DigitBits>(buffer, size, data, offsets, pass, key);
+                }
+                else
+                {
+                    radix_scatter<DigitBits>(data, size, buffer, offsets, pass, key);
+                }
+                inBuffer = !inBuffer;
+            }
+
+            if (inBuffer)
+            {
+                std::move(buffer, buffer + size, data);
+            }
+        }
+
+        // Byte of the key at depth plus one, 0 past the end of the key: shorter keys go first
+        template<class T, class Key>
+        size_t radix_byte(const T& value, size_t depth, Key& key)
+        {
+            decltype(auto) keyValue = std::invoke(key, value);
+            const std::string_view str = keyValue;
+            return depth < str.size() ? static_cast<size_t>(static_cast<unsigned char>(str[depth])) + 1 : 0;
+        }
+
+        // American flag sort: elements are swapped into the buckets of their byte at depth in
+        // place, then buckets are sorted by the next byte. Buckets except the largest one are
+        // sorted recursively and are at most half of the range, so the recursion is O(log n) deep
+        template<class RandomIt, class Key>
+        void msd_radix_sort(RandomIt first, RandomIt last, size_t depth, Key& key)
+        {
+            constexpr size_t Radix = 257;
+
+            while (last - first > MsdRadixSortInsertThreshold)
+            {
+                std::array<std::ptrdiff_t, Radix + 1> starts{};
+                for (RandomIt it = first; it != last; ++it)
+                {
+                    ++starts[radix_byte(*it, depth, key) + 1];
+                }
+
+                // Common prefix: nothing to move
+                const size_t firstByte = radix_byte(*first, depth, key);
+                if (starts[firstByte + 1] == last - first)
+                {
+                    if (firstByte == 0)
+                    {
+                        return;
+                    }
+                    ++depth;
+                    continue;
+                }
+
+                for (size_t bucket = 0; bucket < Radix; ++bucket)
+                {
+                    starts[bucket + 1] += starts[bucket];
+                }
+
+                // next[bucket]: first element of the bucket which may be not in place yet
+                std::array<std::ptrdiff_t, Radix> next;
+                std::copy(starts.begin(), starts.end() - 1, next.begin());
+                for (size_t bucket = 0; bucket < Radix; ++bucket)
+                {
+                    while (next[bucket] < starts[bucket + 1])
+                    {
+                        const size_t target = radix_byte(first[next[bucket]], depth, key);
+                        if (target == bucket)
+                        {
+                            ++next[bucket];
+                        }
+                        else
+                        {
+                            std::iter_swap(first + next[bucket], first + next[target]++);
+                        }
+                    }
+                }
+
+                // Bucket 0 holds keys ending at depth, they are equal
+                size_t largest = 1;
+                for (size_t bucket = 2; bucket < Radix; ++bucket)
+                {
+                    if (starts[bucket + 1] - starts[bucket] > starts[largest + 1] - starts[largest])
+                    {
+                        largest = bucket;
+                    }
+                }
+
+                for (size_t bucket = 1; bucket < Radix; ++bucket)
+                {
+                    if (bucket != largest && starts[bucket + 1] - starts[bucket] > 1)
+                    {
+                        msd_radix_sort(first + starts[bucket], first + starts[bucket + 1], depth + 1, key);
+                    }
+                }
+
+                last = first + starts[largest + 1];
+                first += starts[largest];
+                ++depth;
+            }
+
+            // All keys of the range have the same first depth bytes
+            auto less = [&key, depth](const auto& lhs, const auto& rhs)
+            {
+                decltype(auto) lhsKey = std::invoke(key, lhs);
+                decltype(auto) rhsKey = std::invoke(key, rhs);
+                return std::string_view(lhsKey).substr(depth) < std::string_view(rhsKey).substr(depth);
+            };
+            insert_sort(first, last, less);
+        }
+    } // namespace detail
+
+    // LSD radix sort by key(element), integer or floating point: the element itself by default,
+    // a field of a record with a member pointer or a lambda. Floats are ordered by value with
+    // -0.0 before 0.0 and NaNs at the ends by their sign. Stable, O(n * bits / DigitBits) with
+    // one buffer of n elements, which are default constructible
+    template<unsigned DigitBits = RadixSortDigitBits, std::random_access_iterator RandomIt, class Key = std::identity>
+        requires RadixSortKey<std::remove_cvref_t<std::invoke_result_t<Key&, std::iter_reference_t<RandomIt>>>> &&
+                 std::default_initializable<std::iter_value_t<RandomIt>>
+    void RadixSort(RandomIt first, RandomIt last, Key key = {})
+    {
+        static_assert(DigitBits >= 1 && DigitBits <= 16, "RadixSort: histograms of digits longer than 16 bits don't fit in cache");
+
+        using T = std::iter_value_t<RandomIt>;
+        const std::ptrdiff_t size = last - first;
+
+        if (size <= detail::RadixSortInsertThreshold)
+        {
+            auto less = [&key](const T& lhs, const T& rhs)
+            {
+                return detail::radix_bits(std::invoke(key, lhs)) < detail::radix_bits(std::invoke(key, rhs));
+            };
+            detail::insert_sort(first, last, less);
+            return;
+        }
+
+        // Each pass overwrites the whole buffer, trivial elements are left uninitialized
+        auto buffer = std::make_unique_for_overwrite<T[]>(static_cast<size_t>(size));
+        detail::lsd_radix_sort<DigitBits>(first, buffer.get(), size, key);
+    }
+
+    template<unsigned DigitBits = RadixSortDigitBits, std::ranges::random_access_range Range, class Key = std::identity>
+    void RadixSort(Range&& range, Key key = {})
+    {
+        RadixSort<DigitBits>(std::ranges::begin(range), detail::range_last(range), std::move(key));
+    }
+
+    // MSD radix sort by key(element) convertible to std::string_view, in the order of string
+    // comparison. In place, not stable, O(n * k) for k bytes of distinguishing prefixes
+    template<std::random_access_iterator RandomIt, class Key = std::identity>
+        requires std::convertible_to<std::invoke_result_t<Key&, std::iter_reference_t<RandomIt>>, std::string_view>
+    void MsdRadixSort(RandomIt first, RandomIt last, Key key = {})
+    {
+        detail::msd_radix_sort(first, last, 0, key);
+    }
+
+    template<std::ranges::random_access_range Range, class Key = std::identity>
+    void MsdRadixSort(Range&& range, Key key = {})
+    {
+        MsdRadixSort(std::ranges::begin(range), detail::range_last(range), std::move(key));
+    }
+} // namespace AlgoStruct
@@ -0,0 +1,276 @@
+#pragma once
+
+#include "Comparator.hpp"
+#include "InsertSort.hpp"
+#include "QuickSort.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace AlgoStruct
+{
+    namespace detail
+    {
+        // PartialSort of k first elements out of n keeps a heap of k when k <= n / this: one
+        // comparison for most of the elements. Selection is better for larger k
+        constexpr std::ptrdiff_t PartialSortHeapRatio = 64;
+
+        template<class RandomIt, class Less>
+        void sift_up(RandomIt first, std::ptrdiff_t child, Less& less)
+        {
+            auto value = std::move(first[child]);
+
+            while (child > 0)
+            {
+                const std::ptrdiff_t parent = (child - 1) / 2;
+                if (!less(first[parent], value))
+                {
+                    break;
+                }
+
+                first[child] = std::move(first[parent]);
+                child = parent;
+            }
+
+            first[child] = std::move(value);
+        }
+
+        template<class RandomIt, class Less>
+        void median_of_medians_select(RandomIt first, RandomIt nth, RandomIt last, Less& less);
+
+        // Moves the median of medians of groups of 5 to *first. At least 3 of 5 elements in half
+        // of the groups are not greater than it, and as many not less: either side of the
+        // partition gets at least 3/10 of the range
+        template<class RandomIt, class Less>
+        void median_of_medians_pivot(RandomIt first, RandomIt last, Less& less)
+        {
+            const std::ptrdiff_t groupCount = (last - first) / 5;
+            for (std::ptrdiff_t group = 0; group < groupCount; ++group)
+            {
+                const RandomIt groupFirst = first + 5 * group;
+                insert_sort(groupFirst, groupFirst + 5, less);
+                std::iter_swap(first + group, groupFirst + 2);
+            }
+
+            median_of_medians_select(first, first + groupCount / 2, first + groupCount, less);
+            std::iter_swap(first, first + groupCount / 2);
+        }
+
+        // Selection with median of medians pivots: O(n) in the worst case, though a few times
+        // slower than with a median of three
+        template<class RandomIt, class Less>
+        void median_of_medians_select(RandomIt first, RandomIt nth, RandomIt last, Less& less)
+        {
+            while (last - first > QuickSortInsertThreshold)
+            {
+                median_of_medians_pivot(first, last, less);
+                const RandomIt pivot = hoare_partition(first, last, less);
+                if (pivot == nth)
+                {
+                    return;
+                }
+
+                if (nth < pivot)
+                {
+                    last = pivot;
+                }
+                else
+                {
+                    first = pivot + 1;
+                }
+            }
+
+            small_sort<false>(first, last, less);
+        }
+
+        // Introselect: quickselect with the pivots of QuickSort goes on into the part with nth
+        // only. Beyond depthLimit pivots are considered bad and the rest goes to median of medians
+        template<class RandomIt, class Less>
+        void intro_select(RandomIt first, RandomIt nth, RandomIt last, int depthLimit, Less& less)
+        {
+            while (last - first > QuickSortInsertThreshold)
+            {
+                if (depthLimit-- == 0)
+                {
+                    median_of_medians_select(first, nth, last, less);
+                    return;
+                }
+
+                choose_pivot(first, last, less);
+                const RandomIt pivot = hoare_partition(first, last, less);
+                if (pivot == nth)
+                {
+                    return;
+                }
+
+                if (nth < pivot)
+                {
+                    last = pivot;
+                }
+                else
+                {
+                    first = pivot + 1;
+                }
+            }
+
+            small_sort<false>(first, last, less);
+        }
+
+        // Max-heap of [first, middle) is the first middle - first elements seen so far, the root
+        // is the one to drop for a less element
+        template<class RandomIt, class Less>
+        void heap_select(RandomIt first, RandomIt middle, RandomIt last, Less& less)
+        {
+            const std::ptrdiff_t size = middle - first;
+            for (std::ptrdiff_t root = size / 2; root-- > 0; )
+            {
+                sift_down(first, size, root, less);
+            }
+
+            for (RandomIt it = middle; it != last; ++it)
+            {
+                if (less(*it, *first))
+                {
+                    std::iter_swap(it, first);
+                    sift_down(first, size, 0, less);
+                }
+            }
+        }
+    } // namespace detail
+
+    // Puts the element which would be at nth in the sorted range there, with no element after it
+    // going before it and vice versa. Introselect: O(n) on average and in the worst case, not stable
+    template<std::random_access_iterator RandomIt, class Comparator = std::greater<>, class Projection = std::identity>
+    void NthElement(RandomIt first, RandomIt nth, RandomIt last, Comparator comparator = {}, Projection projection = {})
+    {
+        if (nth == last)
+        {
+            return;
+        }
+
+        auto less = detail::as_less(std::move(comparator), std::move(projection));
+        detail::intro_select(first, nth, last, detail::intro_sort_depth_limit(first, last), less);
+    }
+
+    template<std::ranges::random_access_range Range, class Comparator = std::greater<>, class Projection = std::identity>
+    void NthElement(Range&& range, size_t nth, Comparator comparator = {}, Projection projection = {})
+    {
+        const auto first = std::ranges::begin(range);
+        NthElement(first, first + static_cast<std::ptrdiff_t>(nth), detail::range_last(range), std::move(comparator), std::move(projection));
+    }
+
+    // Sorts [first, middle) with the first middle - first elements of the sorted range, the rest
+    // is left in unspecified order. A heap of k elements for small k: O(n log k) in the worst
+    // case, about n comparisons for random data. Selection and QuickSort of k otherwise:
+    // O(n + k log k). Not stable
+    template<std::random_access_iterator RandomIt, class Comparator = std::greater<>, class Projection = std::identity>
+    void PartialSort(RandomIt first, RandomIt middle, RandomIt last, Comparator comparator = {}, Projection projection = {})
+    {
+        if (first == middle)
+        {
+            return;
+        }
+
+        auto less = detail::as_less(std::move(comparator), std::move(projection));
+        if ((middle - first) * detail::PartialSortHeapRatio <= last - first)
+        {
+            detail::heap_select(first, middle, last, less);
+        }
+        else if (middle != last)
+        {
+            detail::intro_select(first, middle, last, detail::intro_sort_depth_limit(first, last), less);
+        }
+        detail::intro_sort(first, middle, detail::intro_sort_depth_limit(first, middle), less);
+    }
+
+    template<std::ranges::random_access_range Range, class Comparator = std::greater<>, class Projection = std::identity>
+    void PartialSort(Range&& range, size_t count, Comparator comparator = {}, Projection projection = {})
+    {
+        const auto first = std::ranges::begin(range);
+        PartialSort(first, first + static_cast<std::ptrdiff_t>(count), detail::range_last(range), std::move(comparator), std::move(projection));
+    }
+
+    // The first k elements of a stream in the order of the comparator: the greatest ones with the
+    // default std::less, which sorts in descending order. A heap of k elements with the worst of
+    // them at the root: O(log k) per pushed element in the worst case, one comparison for elements
+    // which don't get in, O(k) memory whatever the length of the stream
+    template<class T, class Comparator = std::less<T>>
+    class TopK
+    {
+    public:
+        explicit TopK(size_t k, Comparator comparator = {}) : m_capacity(k), m_less(detail::as_less(std::move(comparator)))
+        {
+            if (k == 0) throw std::invalid_argument("TopK capacity must be positive");
+            m_heap.reserve(k);
+        }
+
+        void push(const T& value)
+        {
+            if (m_heap.size() < m_capacity)
+            {
+                m_heap.push_back(value);
+                detail::sift_up(m_heap.begin(), static_cast<std::ptrdiff_t>(m_heap.size()) - 1, m_less);
+            }
+            else if (m_less(value, m_heap.front()))
+            {
+                m_heap.front() = value;
+                detail::sift_down(m_heap.begin(), static_cast<std::ptrdiff_t>(m_heap.size()), 0, m_less);
+            }
+        }
+
+        void push(T&& value)
+        {
+            if (m_heap.size() < m_capacity)
+            {
+                m_heap.push_back(std::move(value));
+                detail::sift_up(m_heap.begin(), static_cast<std::ptrdiff_t>(m_heap.size()) - 1, m_less);
+            }
+            else if (m_less(value, m_heap.front()))
+            {
+                m_heap.front() = std::move(value);
+                detail::sift_down(m_heap.begin(), static_cast<std::ptrdiff_t>(m_heap.size()), 0, m_less);
+            }
+        }
+
+        template<std::input_iterator InputIt>
+        void push(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+            {
+                push(*first);
+            }
+        }
+
+        // The last of the kept elements: a new one gets in if it goes before this one
+        const T& worst() const
+        {
+            if (m_heap.empty()) throw std::invalid_argument("worst() on empty TopK");
+            return m_heap.front();
+        }
+
+        // Kept elements in the order of the comparator
+        std::vector<T> sorted() const
+        {
+            auto result = m_heap;
+            auto less = m_less;
+            detail::intro_sort(result.begin(), result.end(), detail::intro_sort_depth_limit(result.begin(), result.end()), less);
+            return result;
+        }
+
+        void clear() noexcept { m_heap.clear(); }
+
+        size_t size() const noexcept { return m_heap.size(); }
+        size_t capacity() const noexcept { return m_capacity; }
+        bool empty() const noexcept { return m_heap.empty(); }
+
+    private:
+        std::vector<T> m_heap;
+        size_t m_capacity;
+        detail::AsLess<Comparator> m_less;
+    };
+} // namespace AlgoStruct
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "MergeSort.hpp"
+#include "PdqSort.hpp"
+#include "TimSort.hpp"
+
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace AlgoStruct
+{
+    // Sorts with the best algorithm for the iterator category, in place: PdqSort for random
+    // access iterators, merge sort for forward and bidirectional ones (lists, ring buffers),
+    // which can't be partitioned efficiently. Not stable. Elements are ordered by projection(element)
+    template<std::forward_iterator ForwardIt, class Comparator = std::greater<>, class Projection = std::identity>
+        requires std::sortable<ForwardIt, Comparator, Projection>
+    void Sort(ForwardIt first, ForwardIt last, Comparator comparator = {}, Projection projection = {})
+    {
+        if constexpr (std::random_access_iterator<ForwardIt>)
+        {
+            PdqSort(first, last, std::move(comparator), std::move(projection));
+        }
+        else
+        {
+            MergeSort(first, last, std::move(comparator), std::move(projection));
+        }
+    }
+
+    template<std::ranges::forward_range Range, class Comparator = std::greater<>, class Projection = std::identity>
+        requires std::sortable<std::ranges::iterator_t<Range>, Comparator, Projection>
+    void Sort(Range&& range, Comparator comparator = {}, Projection projection = {})
+    {
+        Sort(std::ranges::begin(range), detail::range_last(range), std::move(comparator), std::move(projection));
+    }
+
+    // Same, stable: TimSort for random access iterators, which takes O(n) on presorted input and
+    // half of the range of memory, merge sort for forward and bidirectional ones
+    template<std::forward_iterator ForwardIt, class Comparator = std::greater<>, class Projection = std::identity>
+        requires std::sortable<ForwardIt, Comparator, Projection>
+    void StableSort(ForwardIt first, ForwardIt last, Comparator comparator = {}, Projection projection = {})
+    {
+        if constexpr (std::random_access_iterator<ForwardIt>)
+        {
+            TimSort(first, last, std::move(comparator), std::move(projection));
+        }
+        else
+        {
+            MergeSort(first, last, std::move(comparator), std::move(projection));
+        }
+    }
+
+    template<std::ranges::forward_range Range, class Comparator = std::greater<>, class Projection = std::identity>
+        requires std::sortable<std::ranges::iterator_t<Range>, Comparator, Projection>
+    void StableSort(Range&& range, Comparator comparator = {}, Projection projection = {})
+    {
+        StableSort(std::ranges::begin(range), detail::range_last(range), std::move(comparator), std::move(projection));
+    }
+} // namespace AlgoStruct
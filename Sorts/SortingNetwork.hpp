@@ -0,0 +1,297 @@
+#pragma once
+
+#include "Comparator.hpp"
+#include "InsertSort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+
+// AVX2 code is compiled for the target attribute and chosen at run time, so the library doesn't
+// need -mavx2 and runs on any x86 CPU
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ALGO_STRUCT_SORTING_NETWORK_AVX2
+#define ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+namespace AlgoStruct
+{
+    // Element types of NetworkSort
+    template<class T>
+    concept SortingNetworkValue = std::same_as<T, int32_t> || std::same_as<T, float>;
+
+    // Sizes of NetworkSort
+    template<size_t N>
+    concept SortingNetworkSize = N == 8 || N == 16 || N == 32 || N == 64;
+
+    namespace detail
+    {
+        // Bitonic sorting network: for each k = 2, 4 ... N and j = k / 2 ... 1 element i is
+        // compared and exchanged with i ^ j, ascending if bit k of i is 0. For 8 elements:
+        //
+        //   k = 2   j = 1   [0 1] [2 3] [4 5] [6 7]      pairs up, down, up, down
+        //   k = 4   j = 2   [0 2] [1 3] [4 6] [5 7]      quads up, down
+        //           j = 1   [0 1] [2 3] [4 5] [6 7]
+        //   k = 8   j = 4   [0 4] [1 5] [2 6] [3 7]      all up
+        //           j = 2   ...
+        //
+        // Comparisons don't depend on the data, so there are no branches to mispredict
+        template<size_t N, class T>
+        void scalar_network_sort(T* data)
+        {
+            for (size_t k = 2; k <= N; k *= 2)
+            {
+                for (size_t j = k / 2; j > 0; j /= 2)
+                {
+                    // Blocks of 2 * j elements compare halves, the direction is the same inside
+                    for (size_t block = 0; block < N; block += 2 * j)
+                    {
+                        const bool ascending = (block & k) == 0;
+                        for (size_t i = block; i < block + j; ++i)
+                        {
+                            const T lo = std::min(data[i], data[i + j]);
+                            const T hi = std::max(data[i], data[i + j]);
+                            data[i] = ascending ? lo : hi;
+                            data[i + j] = ascending ? hi : lo;
+                        }
+                    }
+                }
+            }
+        }
+
+        inline bool has_avx2()
+        {
+#ifdef ALGO_STRUCT_SORTING_NETWORK_AVX2
+            static const bool supported = __builtin_cpu_supports("avx2");
+            return supported;
+#else
+            return false;
+#endif
+        }
+
+#ifdef ALGO_STRUCT_SORTING_NETWORK_AVX2
+        // One layer of the network inside a register of 8 lanes: partner of each lane and lanes
+        // taking the greater of the pair as a blend mask. Flip reverses the direction for
+        // registers in descending blocks when k >= 8
+        struct LaneLayer
+        {
+            std::array<int, 8> partners;
+            int takeMax;
+        };
+
+        constexpr LaneLayer lane_layer(int k, int j, bool flip)
+        {
+            LaneLayer layer{};
+            for (int lane = 0; lane < 8; ++lane)
+            {
+                const int partner = lane ^ j;
+                const bool ascending = ((lane & k) == 0) != flip;
+                layer.partners[lane] = partner;
+                layer.takeMax |= ((lane > partner) == ascending ? 1 : 0) << lane;
+            }
+            return layer;
+        }
+
+        struct Avx2Int32
+        {
+            using Value = int32_t;
+            using Vec = __m256i;
+
+            ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 static Vec load(const Value* data) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)); }
+            ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 static void store(Value* data, Vec vec) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), vec); }
+            ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 static Vec min(Vec lhs, Vec rhs) { return _mm256_min_epi32(lhs, rhs); }
+            ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 static Vec max(Vec lhs, Vec rhs) { return _mm256_max_epi32(lhs, rhs); }
+            ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 static Vec permute(Vec vec, __m256i index) { return _mm256_permutevar8x32_epi32(vec, index); }
+
+            template<int Mask>
+            ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 static Vec blend(Vec lhs, Vec rhs) { return _mm256_blend_epi32(lhs, rhs, Mask); }
+        };
+
+        struct Avx2Float
+        {
+            using Value = float;
+            using Vec = __m256;
+
+            ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 static Vec load(const Value* data) { return _mm256_loadu_ps(data); }
+            ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 static void store(Value* data, Vec vec) { _mm256_storeu_ps(data, vec); }
+            ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 static Vec min(Vec lhs, Vec rhs) { return _mm256_min_ps(lhs, rhs); }
+            ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 static Vec max(Vec lhs, Vec rhs) { return _mm256_max_ps(lhs, rhs); }
+            ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 static Vec permute(Vec vec, __m256i index) { return _mm256_permutevar8x32_ps(vec, index); }
+
+            template<int Mask>
+            ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 static Vec blend(Vec lhs, Vec rhs) { return _mm256_blend_ps(lhs, rhs, Mask); }
+        };
+
+        template<class Ops, int K, int J, bool Flip>
+        ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 typename Ops::Vec lane_compare_exchange(typename Ops::Vec vec)
+        {
+            constexpr LaneLayer layer = lane_layer(K, J, Flip);
+            const __m256i index = _mm256_setr_epi32(layer.partners[0], layer.partners[1], layer.partners[2], layer.partners[3],
+                                                    layer.partners[4], layer.partners[5], layer.partners[6], layer.partners[7]);
+
+            const auto partner = Ops::permute(vec, index);
+            return Ops::template blend<layer.takeMax>(Ops::min(vec, partner), Ops::max(vec, partner));
+        }
+
+        // Layer (K, J) of the network over R registers, element i is lane i % 8 of register i / 8.
+        // For J >= 8 partners are the same lanes of another register, one min and one max for
+        // two registers
+        template<class Ops, int R, int K, int J>
+        ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 void avx2_network_layer(typename Ops::Vec* regs)
+        {
+            for (int reg = 0; reg < R; ++reg)
+            {
+                const bool ascending = ((reg * 8) & K) == 0;
+                if constexpr (J >= 8)
+                {
+                    const int partner = reg ^ (J / 8);
+                    if (partner > reg)
+                    {
+                        const auto lo = Ops::min(regs[reg], regs[partner]);
+                        const auto hi = Ops::max(regs[reg], regs[partner]);
+                        regs[reg] = ascending ? lo : hi;
+                        regs[partner] = ascending ? hi : lo;
+                    }
+                }
+                else
+                {
+                    regs[reg] = ascending ? lane_compare_exchange<Ops, K, J, false>(regs[reg])
+                                          : lane_compare_exchange<Ops, K, J, true>(regs[reg]);
+                }
+            }
+        }
+
+        template<class Ops, int R, int K = 2, int J = 1>
+        ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 void avx2_network_layers(typename Ops::Vec* regs)
+        {
+            avx2_network_layer<Ops, R, K, J>(regs);
+
+            if constexpr (J > 1)
+            {
+                avx2_network_layers<Ops, R, K, J / 2>(regs);
+            }
+            else if constexpr (K < 8 * R)
+            {
+                avx2_network_layers<Ops, R, 2 * K, K>(regs);
+            }
+        }
+
+        // The network of scalar_network_sort on 8-lane registers: 4 instructions per layer and
+        // register, 21 layers for 64 elements
+        template<size_t N, class Ops>
+        ALGO_STRUCT_SORTING_NETWORK_TARGET_AVX2 void avx2_network_sort(typename Ops::Value* data)
+        {
+            constexpr int R = static_cast<int>(N / 8);
+
+            typename Ops::Vec regs[R];
+            for (int reg = 0; reg < R; ++reg)
+            {
+                regs[reg] = Ops::load(data + 8 * reg);
+            }
+
+            avx2_network_layers<Ops, R>(regs);
+
+            for (int reg = 0; reg < R; ++reg)
+            {
+                Ops::store(data + 8 * reg, regs[reg]);
+            }
+        }
+#endif
+    } // namespace detail
+
+    // Sorts exactly N int32_t or float values in ascending order with a bitonic sorting network:
+    // AVX2 if the CPU has it, scalar code otherwise. Not stable, floats have to be not NaN
+    template<size_t N, SortingNetworkValue T>
+        requires SortingNetworkSize<N>
+    void NetworkSort(T* data)
+    {
+#ifdef ALGO_STRUCT_SORTING_NETWORK_AVX2
+        if (detail::has_avx2())
+        {
+            if constexpr (std::same_as<T, int32_t>)
+            {
+                detail::avx2_network_sort<N, detail::Avx2Int32>(data);
+            }
+            else
+            {
+                detail::avx2_network_sort<N, detail::Avx2Float>(data);
+            }
+            return;
+        }
+#endif
+        detail::scalar_network_sort<N>(data);
+    }
+
+    namespace detail
+    {
+        // Ranges of the base case of quick and merge sort
+        constexpr std::ptrdiff_t NetworkSortMaxSmall = 16;
+
+        // Sorting networks give the order of the default comparator. Stable sorts use them for
+        // integers only: equal floats 0.0 and -0.0 can be told apart. Without AVX2 the network
+        // is slower than insertion sort
+        template<class It, class Less, bool Stable>
+        constexpr bool UseSmallNetworkSort = [] {
+            using T = std::iter_value_t<It>;
+            if constexpr (std::contiguous_iterator<It> && SortingNetworkValue<T>)
+            {
+                return (std::same_as<Less, AsLess<std::greater<T>>> || std::same_as<Less, AsLess<std::greater<>>>) &&
+                       (!Stable || std::integral<T>);
+            }
+            else
+            {
+                return false;
+            }
+        }();
+
+        template<size_t N, class T>
+        void padded_network_sort(T* data, std::ptrdiff_t size)
+        {
+            if (size == static_cast<std::ptrdiff_t>(N))
+            {
+                NetworkSort<N>(data);
+                return;
+            }
+
+            // Padding with the greatest value stays after the data
+            std::array<T, N> padded;
+            std::copy(data, data + size, padded.begin());
+            std::fill(padded.begin() + size, padded.end(), std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                                                                : std::numeric_limits<T>::max());
+            NetworkSort<N>(padded.data());
+            std::copy(padded.begin(), padded.begin() + size, data);
+        }
+
+        // Base case of quick and merge sort: sorting network of 8 or 16 elements for int32_t and
+        // float in the default order on CPUs with AVX2, insertion sort otherwise
+        template<bool Stable, class It, class Less>
+        void small_sort(It first, It last, Less& less)
+        {
+            const std::ptrdiff_t size = last - first;
+            if constexpr (UseSmallNetworkSort<It, Less, Stable>)
+            {
+                if (size > 1 && size <= NetworkSortMaxSmall && has_avx2())
+                {
+                    if (size <= 8)
+                    {
+                        padded_network_sort<8>(std::to_address(first), size);
+                    }
+                    else
+                    {
+                        padded_network_sort<16>(std::to_address(first), size);
+                    }
+                    return;
+                }
+            }
+
+            insert_sort(first, last, less);
+        }
+    } // namespace detail
+} // namespace AlgoStruct
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace AlgoStruct
+{
+    // Fixed set of worker threads executing tasks from a shared queue. A thread waiting for a
+    // TaskGroup runs queued tasks as well, so nested fork-join work can't deadlock the pool and
+    // ThreadPool(n) gives n + 1 threads to the waiting caller. ThreadPool(0) runs everything on
+    // the thread which waits
+    class ThreadPool
+    {
+    public:
+        explicit ThreadPool(size_t workerCount = std::max(std::thread::hardware_concurrency(), 1u) - 1);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        size_t size() const noexcept { return m_workers.size(); }
+
+        // Task must not throw, TaskGroup catches exceptions of its tasks
+        void submit(std::function<void()> task);
+
+        // Runs the most recently queued task on the calling thread. Returns false if there is none
+        bool run_pending_task();
+
+    private:
+        void worker_loop();
+        void stop() noexcept;
+
+        std::mutex m_mutex;
+        std::condition_variable m_hasTask;
+        // Workers take the oldest tasks, which are the largest in divide and conquer algorithms,
+        // waiting threads take the newest ones, most likely their own subtasks
+        std::deque<std::function<void()>> m_tasks;
+        bool m_stop = false;
+        std::vector<std::thread> m_workers;
+    };
+
+    // Tasks on a pool which are waited for together. The first exception thrown by a task is
+    // rethrown by wait()
+    //
+    //   TaskGroup group(pool);
+    //   group.run([&]{ sort(left); });
+    //   sort(right);
+    //   group.wait();
+    class TaskGroup
+    {
+    public:
+        explicit TaskGroup(ThreadPool& pool) noexcept : m_pool(pool) {}
+        // Waits for the remaining tasks, they may reference locals of the caller
+        ~TaskGroup();
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        template<class Func>
+        void run(Func&& func);
+
+        void wait();
+
+    private:
+        void wait_pending() noexcept;
+
+        ThreadPool& m_pool;
+        std::atomic<size_t> m_pending{0};
+        std::mutex m_errorMutex;
+        std::exception_ptr m_error;
+    };
+
+    inline ThreadPool::ThreadPool(size_t workerCount)
+    {
+        m_workers.reserve(workerCount);
+        try
+        {
+            for (size_t i = 0; i < workerCount; ++i)
+            {
+                m_workers.emplace_back(&ThreadPool::worker_loop, this);
+            }
+        }
+        catch (...)
+        {
+            stop();
+            throw;
+        }
+    }
+
+    inline ThreadPool::~ThreadPool()
+    {
+        stop();
+    }
+
+    inline void ThreadPool::stop() noexcept
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_hasTask.notify_all();
+
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+        m_workers.clear();
+    }
+
+    inline void ThreadPool::submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_tasks.push_back(std::move(task));
+        }
+        m_hasTask.notify_one();
+    }
+
+    inline bool ThreadPool::run_pending_task()
+    {
+        std::function<void()> task;
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_tasks.empty())
+            {
+                return false;
+            }
+
+            task = std::move(m_tasks.back());
+            m_tasks.pop_back();
+        }
+
+        task();
+        return true;
+    }
+
+    inline void ThreadPool::worker_loop()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(m_mutex);
+                m_hasTask.wait(lock, [this]{ return m_stop || !m_tasks.empty(); });
+                if (m_tasks.empty())
+                {
+                    return;
+                }
+
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    inline TaskGroup::~TaskGroup()
+    {
+        wait_pending();
+    }
+
+    template<class Func>
+    void TaskGroup::run(Func&& func)
+    {
+        m_pending.fetch_add(1, std::memory_order_relaxed);
+        auto task = [this, func = std::forward<Func>(func)]() mutable
+        {
+            try
+            {
+                // Destroyed before the group is released
+                auto localFunc = std::move(func);
+                localFunc();
+            }
+            catch (...)
+            {
+                std::lock_guard lock(m_errorMutex);
+                if (!m_error)
+                {
+                    m_error = std::current_exception();
+                }
+            }
+
+            // The group may be destroyed right after the last decrement
+            m_pending.fetch_sub(1, std::memory_order_release);
+        };
+
+        try
+        {
+            m_pool.submit(std::move(task));
+        }
+        catch (...)
+        {
+            m_pending.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+    }
+
+    inline void TaskGroup::wait()
+    {
+        wait_pending();
+
+        if (m_error)
+        {
+            std::rethrow_exception(std::exchange(m_error, nullptr));
+        }
+    }
+
+    inline void TaskGroup::wait_pending() noexcept
+    {
+        // Tasks of the group may be running on other threads while the queue is empty: spin
+        // helping with whatever else is queued
+        while (m_pending.load(std::memory_order_acquire) != 0)
+        {
+            if (!m_pool.run_pending_task())
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+} // namespace AlgoStruct
@@ -0,0 +1,437 @@
+#pragma once
+
+#include "Comparator.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace AlgoStruct
+{
+    namespace detail
+    {
+        // Shorter ranges are one binary insertion sort, runs shorter than minrun get extended
+        // to it with the same sort
+        constexpr std::ptrdiff_t TimSortMinMerge = 64;
+        // Wins in a row of one run which switch a merge into galloping
+        constexpr std::ptrdiff_t TimSortMinGallop = 7;
+
+        // Length of the ascending run at first, descending runs are reversed. Only strictly
+        // descending ones are, so equal elements keep their order
+        template<class RandomIt, class Less>
+        std::ptrdiff_t count_run_and_make_ascending(RandomIt first, RandomIt last, Less& less)
+        {
+            RandomIt runEnd = first + 1;
+            if (runEnd == last)
+            {
+                return 1;
+            }
+
+            if (less(*runEnd, *first))
+            {
+                while (++runEnd != last && less(*runEnd, *(runEnd - 1)))
+                {
+                }
+                std::reverse(first, runEnd);
+            }
+            else
+            {
+                while (++runEnd != last && !less(*runEnd, *(runEnd - 1)))
+                {
+                }
+            }
+
+            return runEnd - first;
+        }
+
+        // Runs of at least minrun: n / minrun is a power of two or a bit less, so merges stay
+        // balanced for random data. Between 32 and 64
+        inline std::ptrdiff_t tim_sort_min_run(std::ptrdiff_t size)
+        {
+            std::ptrdiff_t lowBits = 0;
+            while (size >= TimSortMinMerge)
+            {
+                lowBits |= size & 1;
+                size >>= 1;
+            }
+            return size + lowBits;
+        }
+
+        // Powersort merge policy: the power of the boundary between runs [start1, start1 + size1)
+        // and the next one of size2 is the first bit where the binary fractions of their midpoints
+        // over the range differ. Runs are merged in the order of decreasing powers, which is
+        // close to the optimal merge tree of the run lengths
+        inline int tim_sort_power(std::ptrdiff_t start1, std::ptrdiff_t size1, std::ptrdiff_t size2, std::ptrdiff_t size)
+        {
+            // Doubled midpoints, so that they stay integers
+            std::ptrdiff_t a = 2 * start1 + size1;
+            std::ptrdiff_t b = a + size1 + size2;
+            int power = 0;
+            while (true)
+            {
+                ++power;
+                if (a >= size)
+                {
+                    a -= size;
+                    b -= size;
+                }
+                else if (b >= size)
+                {
+                    return power;
+                }
+                a <<= 1;
+                b <<= 1;
+            }
+        }
+
+        // Exponential search from the front or the back, then binary search: the point where
+        // pred switches from true to false in O(log k) comparisons for k elements from that end
+        template<class It, class Pred>
+        std::ptrdiff_t gallop(It base, std::ptrdiff_t size, Pred pred, bool fromBack)
+        {
+            std::ptrdiff_t lo = 0;
+            std::ptrdiff_t hi = size;
+            std::ptrdiff_t offset = 1;
+            if (fromBack)
+            {
+                while (offset <= size && !pred(base[size - offset]))
+                {
+                    hi = size - offset;
+                    offset *= 2;
+                }
+                lo = std::max<std::ptrdiff_t>(size - offset + 1, 0);
+            }
+            else
+            {
+                while (offset <= size && pred(base[offset - 1]))
+                {
+                    lo = offset;
+                    offset *= 2;
+                }
+                hi = std::min(offset - 1, size);
+            }
+
+            return std::partition_point(base + lo, base + hi, pred) - base;
+        }
+
+        // Insertion sort of [first, last) with sorted [first, start). The place is found with a
+        // gallop from the back: O(log d) comparisons for an element d places out of order, so
+        // bursts of disorder in presorted data are cheap, and O(n log n) comparisons overall
+        template<class RandomIt, class Less>
+        void binary_insert_sort(RandomIt first, RandomIt start, RandomIt last, Less& less)
+        {
+            for (RandomIt it = start; it != last; ++it)
+            {
+                // In place already: common for nearly sorted input
+                if (!less(*it, *(it - 1)))
+                {
+                    continue;
+                }
+
+                const RandomIt pos = first + gallop(first, it - 1 - first, [&less, it](const auto& value) { return !less(*it, value); }, true);
+                auto value = std::move(*it);
+                std::move_backward(pos, it, it + 1);
+                *pos = std::move(value);
+            }
+        }
+
+        // Natural merge sort of Tim Peters: runs which are in order already are found and
+        // merged, so presorted input costs close to n comparisons. Merges copy the shorter run
+        // to one buffer kept for the whole sort and gallop when one run keeps winning
+        template<class RandomIt, class Less>
+        class TimSorter
+        {
+        public:
+            TimSorter(RandomIt first, RandomIt last, Less& less) : m_first(first), m_size(last - first), m_less(less)
+            {
+                // Powers only grow towards the top of the stack, at most one run per power
+                m_runs.reserve(std::bit_width(static_cast<size_t>(m_size)) + 1);
+            }
+
+            void sort()
+            {
+                const std::ptrdiff_t minRun = tim_sort_min_run(m_size);
+                for (std::ptrdiff_t start = 0; start < m_size; )
+                {
+                    const RandomIt runFirst = m_first + start;
+                    std::ptrdiff_t runSize = count_run_and_make_ascending(runFirst, m_first + m_size, m_less);
+                    if (runSize < minRun)
+                    {
+                        const std::ptrdiff_t forced = std::min(minRun, m_size - start);
+                        binary_insert_sort(runFirst, runFirst + runSize, runFirst + forced, m_less);
+                        runSize = forced;
+                    }
+
+                    if (!m_runs.empty())
+                    {
+                        const int power = tim_sort_power(m_runs.back().start, m_runs.back().size, runSize, m_size);
+                        while (m_runs.size() > 1 && m_runs[m_runs.size() - 2].power > power)
+                        {
+                            merge_top();
+                        }
+                        m_runs.back().power = power;
+                    }
+
+                    m_runs.push_back({start, runSize, 0});
+                    start += runSize;
+                }
+
+                while (m_runs.size() > 1)
+                {
+                    merge_top();
+                }
+            }
+
+        private:
+            // Power is of the boundary with the next run
+            struct Run
+            {
+                std::ptrdiff_t start;
+                std::ptrdiff_t size;
+                int power;
+            };
+
+            void merge_top()
+            {
+                Run& left = m_runs[m_runs.size() - 2];
+                const Run& right = m_runs.back();
+                merge(m_first + left.start, left.size, m_first + right.start, right.size);
+                left.size += right.size;
+                m_runs.pop_back();
+            }
+
+            // Elements of the left run not greater than the first right one and elements of the right
+            // run not less than the last left one are in place already, the rest is merged
+            void merge(RandomIt left, std::ptrdiff_t leftSize, RandomIt right, std::ptrdiff_t rightSize)
+            {
+                const std::ptrdiff_t inPlace = gallop(left, leftSize, [this, right](const auto& value) { return !m_less(*right, value); }, false);
+                left += inPlace;
+                leftSize -= inPlace;
+                if (leftSize == 0)
+                {
+                    return;
+                }
+
+                const RandomIt leftLast = left + leftSize - 1;
+                rightSize = gallop(right, rightSize, [this, leftLast](const auto& value) { return m_less(value, *leftLast); }, true);
+
+                if (leftSize <= rightSize)
+                {
+                    merge_low(left, leftSize, right, rightSize);
+                }
+                else
+                {
+                    merge_high(left, leftSize, right, rightSize);
+                }
+            }
+
+            // Left run goes to the buffer, merged from the front
+            void merge_low(RandomIt left, std::ptrdiff_t leftSize, RandomIt right, std::ptrdiff_t rightSize)
+            {
+                m_buffer.assign(std::make_move_iterator(left), std::make_move_iterator(left + leftSize));
+                auto cur1 = m_buffer.begin();
+                const auto end1 = m_buffer.end();
+                RandomIt cur2 = right;
+                const RandomIt end2 = right + rightSize;
+                RandomIt dest = left;
+
+                // If the comparator throws, the range still holds all of the elements
+                try
+                {
+                    std::ptrdiff_t minGallop = m_minGallop;
+                    while (cur1 != end1 && cur2 != end2)
+                    {
+                        // One element at a time until a run wins minGallop times in a row
+                        std::ptrdiff_t wins1 = 0;
+                        std::ptrdiff_t wins2 = 0;
+                        while (cur1 != end1 && cur2 != end2 && std::max(wins1, wins2) < minGallop)
+                        {
+                            if (m_less(*cur2, *cur1))
+                            {
+                                *dest++ = std::move(*cur2++);
+                                ++wins2;
+                                wins1 = 0;
+                            }
+                            else
+                            {
+                                *dest++ = std::move(*cur1++);
+                                ++wins1;
+                                wins2 = 0;
+                            }
+                        }
+
+                        // Galloping: blocks of one run go at once while they are long enough.
+                        // Staying in the mode makes it easier to enter again
+                        while (cur1 != end1 && cur2 != end2)
+                        {
+                            minGallop -= minGallop > 1;
+
+                            const std::ptrdiff_t count1 = gallop(cur1, end1 - cur1, [this, cur2](const auto& value) { return !m_less(*cur2, value); }, false);
+                            dest = std::move(cur1, cur1 + count1, dest);
+                            cur1 += count1;
+                            if (cur1 == end1)
+                            {
+                                break;
+                            }
+                            *dest++ = std::move(*cur2++);
+                            if (cur2 == end2)
+                            {
+                                break;
+                            }
+
+                            const std::ptrdiff_t count2 = gallop(cur2, end2 - cur2, [this, cur1](const auto& value) { return m_less(value, *cur1); }, false);
+                            dest = std::move(cur2, cur2 + count2, dest);
+                            cur2 += count2;
+                            if (cur2 == end2)
+                            {
+                                break;
+                            }
+                            *dest++ = std::move(*cur1++);
+
+                            if (count1 < TimSortMinGallop && count2 < TimSortMinGallop)
+                            {
+                                minGallop += 2;
+                                break;
+                            }
+                        }
+                    }
+                    m_minGallop = std::max<std::ptrdiff_t>(minGallop, 1);
+                }
+                catch (...)
+                {
+                    std::move(cur1, end1, dest);
+                    throw;
+                }
+
+                // The rest of the right run is in place
+                std::move(cur1, end1, dest);
+            }
+
+            // Right run goes to the buffer, merged from the back
+            void merge_high(RandomIt left, std::ptrdiff_t leftSize, RandomIt right, std::ptrdiff_t rightSize)
+            {
+                m_buffer.assign(std::make_move_iterator(right), std::make_move_iterator(right + rightSize));
+                const RandomIt begin1 = left;
+                RandomIt cur1 = left + leftSize;
+                const auto begin2 = m_buffer.begin();
+                auto cur2 = m_buffer.end();
+                RandomIt dest = right + rightSize;
+
+                try
+                {
+                    std::ptrdiff_t minGallop = m_minGallop;
+                    while (cur1 != begin1 && cur2 != begin2)
+                    {
+                        std::ptrdiff_t wins1 = 0;
+                        std::ptrdiff_t wins2 = 0;
+                        while (cur1 != begin1 && cur2 != begin2 && std::max(wins1, wins2) < minGallop)
+                        {
+                            // Equal elements: the right one goes last
+                            if (m_less(*(cur2 - 1), *(cur1 - 1)))
+                            {
+                                *--dest = std::move(*--cur1);
+                                ++wins1;
+                                wins2 = 0;
+                            }
+                            else
+                            {
+                                *--dest = std::move(*--cur2);
+                                ++wins2;
+                                wins1 = 0;
+                            }
+                        }
+
+                        while (cur1 != begin1 && cur2 != begin2)
+                        {
+                            minGallop -= minGallop > 1;
+
+                            const auto key2 = cur2 - 1;
+                            const std::ptrdiff_t count1 = (cur1 - begin1) -
+                                gallop(begin1, cur1 - begin1, [this, key2](const auto& value) { return !m_less(*key2, value); }, true);
+                            dest = std::move_backward(cur1 - count1, cur1, dest);
+                            cur1 -= count1;
+                            if (cur1 == begin1)
+                            {
+                                break;
+                            }
+                            *--dest = std::move(*--cur2);
+                            if (cur2 == begin2)
+                            {
+                                break;
+                            }
+
+                            const RandomIt key1 = cur1 - 1;
+                            const std::ptrdiff_t count2 = (cur2 - begin2) -
+                                gallop(begin2, cur2 - begin2, [this, key1](const auto& value) { return m_less(value, *key1); }, true);
+                            dest = std::move_backward(cur2 - count2, cur2, dest);
+                            cur2 -= count2;
+                            if (cur2 == begin2)
+                            {
+                                break;
+                            }
+                            *--dest = std::move(*--cur1);
+
+                            if (count1 < TimSortMinGallop && count2 < TimSortMinGallop)
+                            {
+                                minGallop += 2;
+                                break;
+                            }
+                        }
+                    }
+                    m_minGallop = std::max<std::ptrdiff_t>(minGallop, 1);
+                }
+                catch (...)
+                {
+                    std::move_backward(begin2, cur2, dest);
+                    throw;
+                }
+
+                // The rest of the left run is in place
+                std::move_backward(begin2, cur2, dest);
+            }
+
+            RandomIt m_first;
+            std::ptrdiff_t m_size;
+            Less& m_less;
+            std::vector<Run> m_runs;
+            std::vector<std::iter_value_t<RandomIt>> m_buffer;
+            std::ptrdiff_t m_minGallop = TimSortMinGallop;
+        };
+    } // namespace detail
+
+    // Timsort with the powersort merge policy: natural runs are found, short ones extended with
+    // binary insertion sort, and merged with galloping. Stable, O(n) for sorted, reversed and
+    // nearly sorted input, O(n log n) in the worst case, at most n / 2 elements of extra memory
+    template<std::random_access_iterator RandomIt, class Comparator = std::greater<>, class Projection = std::identity>
+        requires std::indirect_strict_weak_order<Comparator&, std::projected<RandomIt, Projection>>
+    void TimSort(RandomIt first, RandomIt last, Comparator comparator = {}, Projection projection = {})
+    {
+        const std::ptrdiff_t size = last - first;
+        if (size < 2)
+        {
+            return;
+        }
+
+        auto less = detail::as_less(std::move(comparator), std::move(projection));
+        if (size < detail::TimSortMinMerge)
+        {
+            const std::ptrdiff_t runSize = detail::count_run_and_make_ascending(first, last, less);
+            detail::binary_insert_sort(first, first + runSize, last, less);
+            return;
+        }
+
+        detail::TimSorter<RandomIt, decltype(less)>(first, last, less).sort();
+    }
+
+    template<std::ranges::random_access_range Range, class Comparator = std::greater<>, class Projection = std::identity>
+    void TimSort(Range&& range, Comparator comparator = {}, Projection projection = {})
+    {
+        TimSort(std::ranges::begin(range), detail::range_last(range), std::move(comparator), std::move(projection));
+    }
+} // namespace AlgoStruct
@@ -0,0 +1,126 @@
+#include "ParallelSort.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+
+#ifdef ALGO_STRUCT_WITH_TBB
+#include <execution>
+#include <tbb/global_control.h>
+#endif
+
+using namespace AlgoStruct;
+
+namespace
+{
+    std::vector<int> make_input(size_t size)
+    {
+        std::mt19937 gen(42);
+        std::vector<int> vec(size);
+        for (auto& value : vec)
+        {
+            value = static_cast<int>(gen());
+        }
+        return vec;
+    }
+
+    // Sorters get a pool of threads - 1 workers, the benchmark thread is the last one
+    struct SampleSort
+    {
+        template<class RandomIt>
+        void operator()(ThreadPool& pool, RandomIt first, RandomIt last, size_t grain = ParallelSortGrainSize) const
+        {
+            ParallelSort(pool, first, last, std::greater<int>{}, grain);
+        }
+    };
+
+    struct StableMergeSort
+    {
+        template<class RandomIt>
+        void operator()(ThreadPool& pool, RandomIt first, RandomIt last, size_t grain = ParallelSortGrainSize) const
+        {
+            ParallelMergeSort(pool, first, last, std::greater<int>{}, grain);
+        }
+    };
+
+#ifdef ALGO_STRUCT_WITH_TBB
+    // TBB threads are limited by global_control of the benchmark
+    struct StdSortPar
+    {
+        template<class RandomIt>
+        void operator()(ThreadPool&, RandomIt first, RandomIt last) const { std::sort(std::execution::par, first, last); }
+    };
+
+    struct StdStableSortPar
+    {
+        template<class RandomIt>
+        void operator()(ThreadPool&, RandomIt first, RandomIt last) const { std::stable_sort(std::execution::par, first, last); }
+    };
+#endif
+}
+
+// Args: threads, size. Wall time: the work is spread over the threads
+template<class Sorter>
+static void BM_ParallelSort(benchmark::State& state)
+{
+    const auto threads = static_cast<size_t>(state.range(0));
+    ThreadPool pool(threads - 1);
+#ifdef ALGO_STRUCT_WITH_TBB
+    tbb::global_control limit(tbb::global_control::max_allowed_parallelism, threads);
+#endif
+
+    const auto input = make_input(static_cast<size_t>(state.range(1)));
+    std::vector<int> vec(input.size());
+
+    for (auto _ : state)
+    {
+        std::copy(input.begin(), input.end(), vec.begin());
+        Sorter{}(pool, vec.begin(), vec.end());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+// 1, 2, 4... threads up to the number of cores
+static void ScalingArgs(benchmark::internal::Benchmark* bench)
+{
+    const int64_t cores = std::max<int64_t>(std::thread::hardware_concurrency(), 1);
+    for (const int64_t size : {1 << 20, 1 << 24})
+    {
+        for (int64_t threads = 1; threads < cores; threads *= 2)
+        {
+            bench->Args({threads, size});
+        }
+        bench->Args({cores, size});
+    }
+}
+BENCHMARK_TEMPLATE(BM_ParallelSort, SampleSort)->Apply(ScalingArgs)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ParallelSort, StableMergeSort)->Apply(ScalingArgs)->UseRealTime()->Unit(benchmark::kMillisecond);
+#ifdef ALGO_STRUCT_WITH_TBB
+BENCHMARK_TEMPLATE(BM_ParallelSort, StdSortPar)->Apply(ScalingArgs)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ParallelSort, StdStableSortPar)->Apply(ScalingArgs)->UseRealTime()->Unit(benchmark::kMillisecond);
+#endif
+
+// Args: grain size. All cores, 16M elements
+template<class Sorter>
+static void BM_ParallelSortGrain(benchmark::State& state)
+{
+    ThreadPool pool;
+    const auto grain = static_cast<size_t>(state.range(0));
+    const auto input = make_input(1 << 24);
+    std::vector<int> vec(input.size());
+
+    for (auto _ : state)
+    {
+        std::copy(input.begin(), input.end(), vec.begin());
+        Sorter{}(pool, vec.begin(), vec.end(), grain);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * (1 << 24));
+}
+BENCHMARK_TEMPLATE(BM_ParallelSortGrain, SampleSort)->RangeMultiplier(4)->Range(1 << 11, 1 << 19)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ParallelSortGrain, StableMergeSort)->RangeMultiplier(4)->Range(1 << 11, 1 << 19)->UseRealTime()->Unit(benchmark::kMillisecond);
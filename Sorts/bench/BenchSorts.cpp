@@ -0,0 +1,430 @@
+#include "InsertSort.hpp"
+#include "MergeSort.hpp"
+#include "PdqSort.hpp"
+#include "QuickSort.hpp"
+#include "RadixSort.hpp"
+#include "Selection.hpp"
+#include "Sort.hpp"
+#include "SortingNetwork.hpp"
+#include "TimSort.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace AlgoStruct;
+
+namespace
+{
+    enum Distribution
+    {
+        Random,
+        Sorted,
+        Reversed,
+        FewUnique,      // 16 distinct values
+        OrganPipe,      // Ascending, then descending
+        SawTooth,       // Sorted runs of 1024 elements
+        NearlySorted,   // Sorted with 1% of random swaps
+        Bursts,         // Sorted with 1% of positions starting 16 shuffled elements, as event logs
+        DistributionCount
+    };
+
+    const char* const DistributionNames[] = {"random", "sorted", "reversed", "few_unique", "organ_pipe", "saw_tooth", "nearly_sorted", "bursts"};
+
+    std::vector<int> make_input(size_t size, Distribution distribution)
+    {
+        std::mt19937 gen(42);
+        std::vector<int> vec(size);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            switch (distribution)
+            {
+            case Random: vec[i] = static_cast<int>(gen()); break;
+            case Sorted: vec[i] = static_cast<int>(i); break;
+            case Reversed: vec[i] = static_cast<int>(size - i); break;
+            case FewUnique: vec[i] = static_cast<int>(gen() % 16); break;
+            case OrganPipe: vec[i] = static_cast<int>(i < size / 2 ? i : size - i); break;
+            case SawTooth: vec[i] = static_cast<int>(i % 1024); break;
+            case NearlySorted: vec[i] = static_cast<int>(i); break;
+            case Bursts: vec[i] = static_cast<int>(i); break;
+            default: break;
+            }
+        }
+
+        if (distribution == NearlySorted)
+        {
+            for (size_t i = 0; i < size / 100; ++i)
+            {
+                std::swap(vec[gen() % size], vec[gen() % size]);
+            }
+        }
+
+        if (distribution == Bursts && size > 16)
+        {
+            for (size_t i = 0; i < size / 100; ++i)
+            {
+                const auto start = vec.begin() + static_cast<std::ptrdiff_t>(gen() % (size - 16));
+                std::shuffle(start, start + 16, gen);
+            }
+        }
+
+        return vec;
+    }
+
+    struct StdSort
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last) const { std::sort(first, last); }
+    };
+
+    struct IntroSort
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last) const { QuickSort(first, last); }
+    };
+
+    struct PatternDefeatingSort
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last) const { PdqSort(first, last); }
+    };
+
+    struct StdStableSort
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last) const { std::stable_sort(first, last); }
+    };
+
+    struct BufferedMergeSort
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last) const { MergeSort(first, last); }
+    };
+
+    struct AdaptiveMergeSort
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last) const { TimSort(first, last); }
+    };
+
+    template<unsigned DigitBits>
+    struct LsdRadixSort
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last) const { RadixSort<DigitBits>(first, last); }
+    };
+
+    struct InsertionSort
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last) const { InsertSort(first, last); }
+    };
+
+    // Sorts of exactly N elements
+    template<size_t N>
+    struct Network
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt) const { NetworkSort<N>(std::to_address(first)); }
+    };
+
+    template<size_t N>
+    struct ScalarNetwork
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt) const { detail::scalar_network_sort<N>(std::to_address(first)); }
+    };
+
+    // Selections of the first k elements: the k-th one or all of them sorted
+    struct FullSort
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last, std::ptrdiff_t) const { QuickSort(first, last); }
+    };
+
+    struct SelectNth
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last, std::ptrdiff_t k) const { NthElement(first, first + k - 1, last); }
+    };
+
+    struct StdNthElement
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last, std::ptrdiff_t k) const { std::nth_element(first, first + k - 1, last); }
+    };
+
+    struct SelectSorted
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last, std::ptrdiff_t k) const { PartialSort(first, first + k, last); }
+    };
+
+    struct StdPartialSort
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last, std::ptrdiff_t k) const { std::partial_sort(first, first + k, last); }
+    };
+
+    // Reads the range as a stream, nothing is moved in it
+    struct StreamTopK
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last, std::ptrdiff_t k) const
+        {
+            TopK<std::iter_value_t<RandomIt>, std::greater<>> top(static_cast<size_t>(k));
+            top.push(first, last);
+            benchmark::DoNotOptimize(top.sorted());
+        }
+    };
+
+    struct StringRadixSort
+    {
+        template<class RandomIt>
+        void operator()(RandomIt first, RandomIt last) const { MsdRadixSort(first, last); }
+    };
+
+    // Nanosecond timestamps within a day
+    std::vector<uint64_t> make_timestamps(size_t size)
+    {
+        std::mt19937_64 gen(42);
+        std::vector<uint64_t> vec(size);
+        for (auto& value : vec)
+        {
+            value = 1700000000000000000ull + gen() % 86400000000000ull;
+        }
+        return vec;
+    }
+
+    std::vector<double> make_doubles(size_t size)
+    {
+        std::mt19937_64 gen(42);
+        std::uniform_real_distribution<double> dist(-1e9, 1e9);
+        std::vector<double> vec(size);
+        for (auto& value : vec)
+        {
+            value = dist(gen);
+        }
+        return vec;
+    }
+
+    // Lowercase words of 4 to 16 letters
+    std::vector<std::string> make_strings(size_t size)
+    {
+        std::mt19937 gen(42);
+        std::vector<std::string> vec(size);
+        for (auto& str : vec)
+        {
+            str.resize(4 + gen() % 13);
+            for (auto& ch : str)
+            {
+                ch = static_cast<char>('a' + gen() % 26);
+            }
+        }
+        return vec;
+    }
+}
+
+// Args: size, distribution. Copy of the input is sorted each iteration, copying is a small part
+// of the time and the same for all sorts
+template<class Sorter>
+static void BM_Sort(benchmark::State& state)
+{
+    const auto distribution = static_cast<Distribution>(state.range(1));
+    const auto input = make_input(static_cast<size_t>(state.range(0)), distribution);
+    std::vector<int> vec(input.size());
+
+    for (auto _ : state)
+    {
+        std::copy(input.begin(), input.end(), vec.begin());
+        Sorter{}(vec.begin(), vec.end());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel(DistributionNames[distribution]);
+}
+
+static void SortArgs(benchmark::internal::Benchmark* bench)
+{
+    for (const int64_t size : {1 << 4, 1 << 10, 1 << 16, 1 << 22})
+    {
+        for (int64_t distribution = 0; distribution < DistributionCount; ++distribution)
+        {
+            bench->Args({size, distribution});
+        }
+    }
+}
+BENCHMARK_TEMPLATE(BM_Sort, StdSort)->Apply(SortArgs);
+BENCHMARK_TEMPLATE(BM_Sort, IntroSort)->Apply(SortArgs);
+BENCHMARK_TEMPLATE(BM_Sort, PatternDefeatingSort)->Apply(SortArgs);
+BENCHMARK_TEMPLATE(BM_Sort, StdStableSort)->Apply(SortArgs);
+BENCHMARK_TEMPLATE(BM_Sort, BufferedMergeSort)->Apply(SortArgs);
+BENCHMARK_TEMPLATE(BM_Sort, AdaptiveMergeSort)->Apply(SortArgs);
+BENCHMARK_TEMPLATE(BM_Sort, LsdRadixSort<8>)->Apply(SortArgs);
+BENCHMARK_TEMPLATE(BM_Sort, LsdRadixSort<11>)->Apply(SortArgs);
+BENCHMARK_TEMPLATE(BM_Sort, LsdRadixSort<16>)->Apply(SortArgs);
+
+// Arg: size. Keys other than int: timestamps, doubles and strings
+template<auto MakeInput, class Sorter>
+static void BM_SortKeys(benchmark::State& state)
+{
+    const auto input = MakeInput(static_cast<size_t>(state.range(0)));
+    auto vec = input;
+
+    for (auto _ : state)
+    {
+        std::copy(input.begin(), input.end(), vec.begin());
+        Sorter{}(vec.begin(), vec.end());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_SortKeys, make_timestamps, StdSort)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_SortKeys, make_timestamps, LsdRadixSort<8>)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_SortKeys, make_timestamps, LsdRadixSort<11>)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_SortKeys, make_timestamps, LsdRadixSort<16>)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_SortKeys, make_doubles, StdSort)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_SortKeys, make_doubles, LsdRadixSort<8>)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_SortKeys, make_doubles, LsdRadixSort<11>)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_SortKeys, make_doubles, LsdRadixSort<16>)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_SortKeys, make_strings, StdSort)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SortKeys, make_strings, StringRadixSort)->Range(1 << 10, 1 << 20);
+
+// Arg: array size. Many small arrays one after another, as in inner loops
+template<class T, class Sorter>
+static void BM_SortSmallArrays(benchmark::State& state)
+{
+    constexpr size_t ArrayCount = 4096;
+    const auto size = static_cast<size_t>(state.range(0));
+
+    std::mt19937 gen(42);
+    std::vector<T> input(ArrayCount * size);
+    for (auto& value : input)
+    {
+        value = static_cast<T>(static_cast<int32_t>(gen()));
+    }
+    std::vector<T> vec(input.size());
+
+    for (auto _ : state)
+    {
+        std::copy(input.begin(), input.end(), vec.begin());
+        for (auto it = vec.begin(); it != vec.end(); it += static_cast<std::ptrdiff_t>(size))
+        {
+            Sorter{}(it, it + static_cast<std::ptrdiff_t>(size));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(ArrayCount));
+}
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, int32_t, InsertionSort)->RangeMultiplier(2)->Range(8, 64);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, int32_t, StdSort)->RangeMultiplier(2)->Range(8, 64);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, int32_t, Network<8>)->Arg(8);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, int32_t, Network<16>)->Arg(16);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, int32_t, Network<32>)->Arg(32);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, int32_t, Network<64>)->Arg(64);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, int32_t, ScalarNetwork<8>)->Arg(8);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, int32_t, ScalarNetwork<16>)->Arg(16);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, int32_t, ScalarNetwork<32>)->Arg(32);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, int32_t, ScalarNetwork<64>)->Arg(64);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, float, InsertionSort)->RangeMultiplier(2)->Range(8, 64);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, float, StdSort)->RangeMultiplier(2)->Range(8, 64);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, float, Network<8>)->Arg(8);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, float, Network<16>)->Arg(16);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, float, Network<32>)->Arg(32);
+BENCHMARK_TEMPLATE(BM_SortSmallArrays, float, Network<64>)->Arg(64);
+
+// Args: size, k. The first k of size random elements, "top 100 of 10 million" or the median
+template<class Selector>
+static void BM_Select(benchmark::State& state)
+{
+    const auto input = make_input(static_cast<size_t>(state.range(0)), Random);
+    std::vector<int> vec(input.size());
+
+    for (auto _ : state)
+    {
+        std::copy(input.begin(), input.end(), vec.begin());
+        Selector{}(vec.begin(), vec.end(), static_cast<std::ptrdiff_t>(state.range(1)));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void SelectArgs(benchmark::internal::Benchmark* bench)
+{
+    constexpr int64_t size = 10000000;
+    for (const int64_t k : {int64_t{100}, int64_t{10000}, size / 100, size / 32, size / 8, size / 2})
+    {
+        bench->Args({size, k});
+    }
+}
+BENCHMARK_TEMPLATE(BM_Select, FullSort)->Args({10000000, 1})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Select, SelectNth)->Apply(SelectArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Select, StdNthElement)->Apply(SelectArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Select, SelectSorted)->Apply(SelectArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Select, StdPartialSort)->Apply(SelectArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Select, StreamTopK)->Apply(SelectArgs)->Unit(benchmark::kMillisecond);
+
+namespace
+{
+    // Relinks the nodes
+    struct ListSort
+    {
+        void operator()(std::list<int>& list) const { list.sort(); }
+    };
+
+    // Moves the values, merge sort for bidirectional iterators
+    struct InPlaceSort
+    {
+        void operator()(std::list<int>& list) const { Sort(list); }
+    };
+
+    struct CopyToVectorSort
+    {
+        void operator()(std::list<int>& list) const
+        {
+            std::vector<int> vec(list.begin(), list.end());
+            PdqSort(vec);
+            std::copy(vec.begin(), vec.end(), list.begin());
+        }
+    };
+}
+
+// Args: size, distribution. Values of the input are copied over the list each iteration, nodes
+// stay in the order of allocation only for the first one
+template<class Sorter>
+static void BM_SortList(benchmark::State& state)
+{
+    const auto distribution = static_cast<Distribution>(state.range(1));
+    const auto input = make_input(static_cast<size_t>(state.range(0)), distribution);
+    std::list<int> list(input.begin(), input.end());
+
+    for (auto _ : state)
+    {
+        std::copy(input.begin(), input.end(), list.begin());
+        Sorter{}(list);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel(DistributionNames[distribution]);
+}
+
+static void SortListArgs(benchmark::internal::Benchmark* bench)
+{
+    for (const int64_t size : {1 << 10, 1 << 16, 1 << 20})
+    {
+        for (const int64_t distribution : {Random, Sorted, NearlySorted})
+        {
+            bench->Args({size, distribution});
+        }
+    }
+}
+BENCHMARK_TEMPLATE(BM_SortList, ListSort)->Apply(SortListArgs);
+BENCHMARK_TEMPLATE(BM_SortList, InPlaceSort)->Apply(SortListArgs);
+BENCHMARK_TEMPLATE(BM_SortList, CopyToVectorSort)->Apply(SortListArgs);
@@ -1,6 +1,15 @@
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <utility>
 #include <vector>
 
+#include "MergeSort.hpp"
+#include "QuickSort.hpp"
+#include "RadixSort.hpp"
+#include "Sort.hpp"
+#include "TimSort.hpp"
+
 using namespace std;
 
 //           j       i
@@ -30,18 +39,22 @@ using namespace std;
 //
 // arr[] = 0 1 1 2 3 4
 //
-void bubble_sort(vector<int> &arr)
+template<typename ForwardIt>
+void bubble_sort(ForwardIt first, ForwardIt last)
 {
-	for(size_t i = arr.size() - 1; i > 0; --i){
+	for(; last != first; ){
 
-		for(size_t j = 1; j <= i; ++j){
+		ForwardIt prev = first;
+		ForwardIt lastSwap = first;
+		for(ForwardIt it = next(first); it != last; ++it){
 
-			if(arr[j] < arr[j - 1]){
-				int tmp = arr[j];
-				arr[j] = arr[j - 1];
-				arr[j - 1] = tmp;
+			if(*it < *prev){
+				iter_swap(prev, it);
+				lastSwap = it;
 			}
+			prev = it;
 		}
+		last = lastSwap;
 	}
 }
 
@@ -87,235 +100,28 @@ void bubble_sort(vector<int> &arr)
 //
 //   elem-> 0 1 2 3 5  
 //
-void insert_sort(vector<int> &arr)
+template<typename BidirIt>
+void insert_sort(BidirIt first, BidirIt last)
 {
-	for(size_t i = 1; i < arr.size(); ++i){
-
-		size_t j = i;
-		int elem = arr[i];
-
-		while((j > 0) && (elem < arr[j - 1])){
-			arr[j] = arr[j - 1];
-			--j;
-		}
-		arr[j] = elem;
-	}
-}
-
-//     
-//      mid (pivot)
-//       v
-//   1 4 3 2 0 
-//
-// i - greater than pivot
-// j - less or equal pivot
-//
-// i j       pivot  
-//   1 4 0 2  3
-//
-//   i j
-//   1 4 0 2  3
-//
-//   i   j
-//   1 4 0 2  3
-//    
-//     i   j
-//   1 0 4 2  3
-//  
-//       i j
-//   1 0 2 4  3
-//
-//          pivot
-//       i   v
-//   1 0 2   3   4
-//
-size_t partition(vector<int> &arr, size_t left, size_t right)
-{
-	size_t mid = left + (right - left) / 2;
-
-	size_t last = right - 1;
-	size_t i = left - 1;
-
-	std::swap(arr[mid], arr[last]);
-	const int &pivot = arr[last];
-
-	for(size_t j = left; j < last; ++j){
-
-		if(arr[j] <= pivot){
-			++i;
-			std::swap(arr[j], arr[i]);
-		}
-	}
-
-	std::swap(arr[i + 1], arr[last]);
-	return i + 1;
-}
-
-// [left, right)
-void quick_sort(vector<int> &arr, size_t left, size_t right)
-{
-	if((right <= left) || (right - left) < 2){
-		return;
-	}
-
-	size_t pivot_idx = partition(arr, left, right);
-
-	quick_sort(arr, left, pivot_idx);
-	quick_sort(arr, pivot_idx + 1, right);
-}
-
-// [left, right)
-//
-// left = 0
-// right = 6
-//      
-//    mid = 3 (pivot)          pivot
-//        v                      v
-//  5 4 3 2 1 10             3 6 5 10
-//  l         r              l      r
-//
-//  5 4 3 2 1 10 - swap      3 6 5 10 - swap
-//  l       r                  l r
-//
-//  1 4 3 2 5 10 - swap      3 5  6 10
-//    l   r                    r  l
-//
-//  1 2 3 4 5 10
-//     l,r  
-//
-//  1 2  3  4 5 10
-//    r     l
-//
-//  pivot
-//   v
-// 4 5 10
-// l   r 
-//
-// 4 5 10
-//  l,r
-//
-// 4  5  10
-// r     l
-//
-void quick_sort_v2(vector<int> &arr, size_t left, size_t right)
-{
-	if((right <= left) || (right - left) < 2){
+	if(first == last){
 		return;
 	}
 
-	size_t mid = left + (right - left) / 2;
-	const int &pivot = arr[mid];
-
-	size_t l = left;
-	size_t r = right - 1;
-
-	while(l <= r){
-
-		while(arr[l] < pivot){
-			++l;
-		}
-
-		while(arr[r] > pivot){
-			--r;
-		}
-
-		if(l <= r){
-			std::swap(arr[l], arr[r]);
-			++l;
-			--r;
-		}
-	}
-
-	quick_sort_v2(arr, left, r + 1);
-	quick_sort_v2(arr, l, right);
-}
+	for(BidirIt i = next(first); i != last; ++i){
 
+		BidirIt j = i;
+		auto elem = std::move(*i);
 
-//      mid
-//       v
-// 1 4 9 1 10 13 20
-//
-// sorted parts
-// 1 4 9   1 10 13 20
-// l       r
-// res <- 1
-// 
-// 1 4 9   1 10 13 20
-//   l     r
-// res <- 1
-//
-// 1 4 9   1 10 13 20
-//   l        r
-// res <- 4 
-//
-// 1 4 9   1 10 13 20
-//     l      r
-// res <- 9
-//
-// 1 10 13 20
-//   r
-// res <- 10, 13, 20
-//
-void merge(vector<int> &arr, 
-			size_t left_begin, size_t left_end,
-			size_t right_begin, size_t right_end)
-{
-	size_t l = left_begin;
-	size_t r = right_begin;
-
-	vector<int> res;
-
-	while(l < left_end && r < right_end){
-
-		if(arr[l] <= arr[r]){
-			res.push_back(arr[l]);
-			++l;
-		}
-		else{
-			res.push_back(arr[r]);
-			++r;
+		while((j != first) && (elem < *prev(j))){
+			*j = std::move(*prev(j));
+			--j;
 		}
+		*j = std::move(elem);
 	}
-
-	while(l < left_end){
-		res.push_back(arr[l]);
-		++l;
-	}
-
-	while(r < right_end){
-		res.push_back(arr[r]);
-		++r;
-	}
-
-	// update input array part
-	for(size_t i = 0; i < res.size(); ++i){
-		arr[left_begin + i] = res[i];
-	}
-
-}
-
-void merge_sort(vector<int> &arr, size_t left, size_t right)
-{
-	if((right <= left) || (right - left) < 2 ){
-		return;
-	}
-
-	// split array
-	size_t mid = left + (right - left) / 2;
-
-	// sort two separate parts
-	merge_sort(arr, left, mid);
-	merge_sort(arr, mid, right);
-
-	// merge the results
-	merge(arr, left, mid, mid, right);
 }
 
-
-
-
-
-void print_array(const vector<int> &arr)
+template<typename Container>
+void print_array(const Container &arr)
 {
 	for(const auto &elem : arr){
 		cout << elem << " ";
@@ -336,29 +142,40 @@ int main(int argc, char* argv[])
 
 	vector<int> arr_copy(arr);
 
-	bubble_sort(arr_copy);
+	bubble_sort(arr_copy.begin(), arr_copy.end());
 	cout << "bubble_sort: ";
 	print_array(arr_copy);
 
 	arr_copy = arr;
-	insert_sort(arr_copy);
+	insert_sort(arr_copy.begin(), arr_copy.end());
 	cout << "insert_sort: ";
 	print_array(arr_copy);
 
 	arr_copy = arr;
-	quick_sort(arr_copy, 0, arr_copy.size());
+	AlgoStruct::QuickSort(arr_copy);
 	cout << "quick_sort: ";
 	print_array(arr_copy);
 
 	arr_copy = arr;
-	quick_sort_v2(arr_copy, 0, arr_copy.size());
-	cout << "quick_sort_v2: ";
+	AlgoStruct::MergeSort(arr_copy);
+	cout << "merge_sort: ";
 	print_array(arr_copy);
 
 	arr_copy = arr;
-	merge_sort(arr_copy, 0, arr_copy.size());
-	cout << "merge_sort: ";
+	AlgoStruct::RadixSort(arr_copy);
+	cout << "radix_sort: ";
 	print_array(arr_copy);
 
+	arr_copy = arr;
+	AlgoStruct::TimSort(arr_copy);
+	cout << "tim_sort: ";
+	print_array(arr_copy);
+
+	// Lists are sorted in place with merge sort
+	list<int> arr_list(arr.begin(), arr.end());
+	AlgoStruct::Sort(arr_list);
+	cout << "list_sort: ";
+	print_array(arr_list);
+
 	return 0;
 }
\ No newline at end of file
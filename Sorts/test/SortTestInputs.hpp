@@ -0,0 +1,79 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <random>
+#include <vector>
+
+// Inputs and checks shared by the tests of the sorts
+
+template<class T = int>
+std::vector<T> random_vector(size_t size, int maxValue, unsigned seed = 1)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, maxValue);
+
+    std::vector<T> vec(size);
+    for (auto& value : vec)
+    {
+        value = static_cast<T>(dist(gen));
+    }
+    return vec;
+}
+
+// Random, few unique, sorted, reversed, all equal and organ pipe inputs
+inline std::vector<std::vector<int>> sort_inputs(size_t size)
+{
+    std::vector<std::vector<int>> result = {random_vector(size, 1000000), random_vector(size, 3)};
+    auto sorted = random_vector(size, 1000000, 2);
+    std::sort(sorted.begin(), sorted.end());
+    result.push_back(sorted);
+    result.emplace_back(sorted.rbegin(), sorted.rend());
+    result.emplace_back(size, 7);
+
+    std::vector<int> organPipe(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        organPipe[i] = static_cast<int>(std::min(i, size - i));
+    }
+    result.push_back(organPipe);
+    return result;
+}
+
+// Sort(vec) sorts vectors in place in non-descending order
+template<class Sort>
+void expect_sorts_short_vectors(Sort sort)
+{
+    std::vector<int> empty;
+    sort(empty);
+    ASSERT_TRUE(empty.empty());
+
+    std::vector one{1};
+    sort(one);
+    ASSERT_THAT(one, ::testing::ElementsAre(1));
+
+    std::vector vec{2, 3, 1, 5, 4};
+    sort(vec);
+    ASSERT_THAT(vec, ::testing::ElementsAreArray({1, 2, 3, 4, 5}));
+}
+
+template<class T = int, class Sort>
+void expect_sorts_like_std_sort(Sort sort, std::initializer_list<size_t> sizes, std::initializer_list<int> maxValues = {1 << 20})
+{
+    for (const size_t size : sizes)
+    {
+        for (const int maxValue : maxValues)
+        {
+            auto vec = random_vector<T>(size, maxValue);
+            auto expected = vec;
+
+            sort(vec);
+            std::sort(expected.begin(), expected.end());
+
+            ASSERT_EQ(expected, vec) << "size " << size << ", max value " << maxValue;
+        }
+    }
+}
@@ -0,0 +1,240 @@
+#include "ExternalSort.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+namespace
+{
+    struct Record
+    {
+        uint64_t key;
+        uint32_t index;
+        char payload[20];
+    };
+
+    // Keys of few distinct values to have duplicates, indices to tell records apart
+    std::vector<Record> random_records(size_t size, uint64_t maxKey)
+    {
+        std::mt19937_64 gen(1);
+        std::vector<Record> records(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            records[i] = Record{gen() % maxKey, static_cast<uint32_t>(i), {}};
+            std::fill(std::begin(records[i].payload), std::end(records[i].payload), static_cast<char>(i));
+        }
+        return records;
+    }
+
+    template<class T>
+    void write_file(const std::filesystem::path& path, const std::vector<T>& records)
+    {
+        std::FILE* file = std::fopen(path.string().c_str(), "wb");
+        ASSERT_NE(nullptr, file);
+        if (!records.empty())
+        {
+            ASSERT_EQ(records.size(), std::fwrite(records.data(), sizeof(T), records.size(), file));
+        }
+        std::fclose(file);
+    }
+
+    template<class T>
+    std::vector<T> read_file(const std::filesystem::path& path)
+    {
+        std::vector<T> records(std::filesystem::file_size(path) / sizeof(T));
+        std::FILE* file = std::fopen(path.string().c_str(), "rb");
+        EXPECT_NE(nullptr, file);
+        EXPECT_EQ(records.size(), std::fread(records.data(), sizeof(T), records.size(), file));
+        std::fclose(file);
+        return records;
+    }
+
+    // Temp directory of a test: runs are spilled here, it has to be empty after the sort
+    class TestExternalSort : public Test
+    {
+    protected:
+        void SetUp() override
+        {
+            m_directory = std::filesystem::temp_directory_path() /
+                          ("algo_struct_test_" + std::string(UnitTest::GetInstance()->current_test_info()->name()));
+            std::filesystem::remove_all(m_directory);
+            std::filesystem::create_directories(m_directory / "runs");
+        }
+
+        void TearDown() override { std::filesystem::remove_all(m_directory); }
+
+        ExternalSortOptions options(size_t memoryBudget, size_t minReadSize)
+        {
+            ExternalSortOptions result;
+            result.memoryBudget = memoryBudget;
+            result.minReadSize = minReadSize;
+            result.tempDirectory = m_directory / "runs";
+            return result;
+        }
+
+        bool no_runs_left() const { return std::filesystem::is_empty(m_directory / "runs"); }
+
+        std::filesystem::path m_directory;
+    };
+
+    void expect_sorted_records(const std::vector<Record>& input, const std::vector<Record>& output)
+    {
+        ASSERT_EQ(input.size(), output.size());
+        ASSERT_TRUE(std::is_sorted(output.begin(), output.end(), [](const Record& lhs, const Record& rhs) { return lhs.key < rhs.key; }));
+
+        // Same records: each index once, with its key and payload
+        std::vector<bool> seen(input.size());
+        for (const auto& record : output)
+        {
+            ASSERT_LT(record.index, input.size());
+            ASSERT_FALSE(seen[record.index]);
+            seen[record.index] = true;
+            ASSERT_EQ(input[record.index].key, record.key);
+            ASSERT_EQ(input[record.index].payload[19], record.payload[19]);
+        }
+    }
+
+    auto byKey = [](const Record& lhs, const Record& rhs) { return lhs.key > rhs.key; };
+}
+
+TEST_F(TestExternalSort, ShouldSortInMemoryWhenFileFits)
+{
+    const auto input = random_records(1000, 100);
+    write_file(m_directory / "in", input);
+
+    const auto stats = ExternalSort<Record>(m_directory / "in", m_directory / "out", options(1 << 20, 1024), byKey);
+
+    ASSERT_EQ(1u, stats.runCount);
+    ASSERT_EQ(0u, stats.mergePassCount);
+    expect_sorted_records(input, read_file<Record>(m_directory / "out"));
+}
+
+TEST_F(TestExternalSort, ShouldMergeRunsInOnePass)
+{
+    // 20 runs of 1000 records, fan-in 30
+    const auto input = random_records(20000, 1000);
+    write_file(m_directory / "in", input);
+
+    const auto stats = ExternalSort<Record>(m_directory / "in", m_directory / "out", options(1000 * sizeof(Record), 1024), byKey);
+
+    ASSERT_EQ(20u, stats.runCount);
+    ASSERT_EQ(1u, stats.mergePassCount);
+    expect_sorted_records(input, read_file<Record>(m_directory / "out"));
+    ASSERT_TRUE(no_runs_left());
+}
+
+TEST_F(TestExternalSort, ShouldMergeInSeveralPassesWithSmallFanIn)
+{
+    // 100 runs of 100 records, fan-in 3: 34, 12, 4, 2 runs, then the output
+    const auto input = random_records(10000, 1000000);
+    write_file(m_directory / "in", input);
+
+    const auto stats = ExternalSort<Record>(m_directory / "in", m_directory / "out", options(100 * sizeof(Record), 25 * sizeof(Record)), byKey);
+
+    ASSERT_EQ(100u, stats.runCount);
+    ASSERT_EQ(5u, stats.mergePassCount);
+    expect_sorted_records(input, read_file<Record>(m_directory / "out"));
+    ASSERT_TRUE(no_runs_left());
+}
+
+TEST_F(TestExternalSort, ShouldUseMinimalFanInWhenBudgetIsBelowReadSize)
+{
+    // 16 runs of 100 records, read size above the budget: fan-in 2, 8, 4, 2 runs, then the output
+    const auto input = random_records(1600, 1000000);
+    write_file(m_directory / "in", input);
+
+    const auto stats = ExternalSort<Record>(m_directory / "in", m_directory / "out", options(100 * sizeof(Record), 200 * sizeof(Record)), byKey);
+
+    ASSERT_EQ(16u, stats.runCount);
+    ASSERT_EQ(4u, stats.mergePassCount);
+    expect_sorted_records(input, read_file<Record>(m_directory / "out"));
+    ASSERT_TRUE(no_runs_left());
+}
+
+TEST_F(TestExternalSort, ShouldSortFileInPlace)
+{
+    std::vector<int32_t> input(10007);
+    std::mt19937 gen(2);
+    for (auto& value : input)
+    {
+        value = static_cast<int32_t>(gen());
+    }
+    write_file(m_directory / "data", input);
+    auto expected = input;
+    std::sort(expected.begin(), expected.end(), std::greater<int32_t>{});
+
+    // Default comparator: ascending, greater comparator: descending
+    ExternalSort<int32_t>(m_directory / "data", m_directory / "data", options(4096, 512));
+    auto ascending = read_file<int32_t>(m_directory / "data");
+    ExternalSort<int32_t>(m_directory / "data", m_directory / "data", options(4096, 512), std::less<int32_t>{});
+
+    ASSERT_TRUE(std::is_sorted(ascending.begin(), ascending.end()));
+    ASSERT_EQ(expected, read_file<int32_t>(m_directory / "data"));
+}
+
+TEST_F(TestExternalSort, ShouldSortEmptyFile)
+{
+    write_file(m_directory / "in", std::vector<Record>{});
+
+    ExternalSort<Record>(m_directory / "in", m_directory / "out", options(1024, 1024), byKey);
+
+    ASSERT_EQ(0u, std::filesystem::file_size(m_directory / "out"));
+}
+
+TEST_F(TestExternalSort, ShouldThrowOnBadInput)
+{
+    write_file(m_directory / "in", std::vector<char>(100));
+
+    ASSERT_THROW(ExternalSort<Record>(m_directory / "in", m_directory / "out", options(1 << 20, 1024), byKey), std::invalid_argument);
+    ASSERT_THROW(ExternalSort<char>(m_directory / "in", m_directory / "out", options(2, 1)), std::invalid_argument);
+    ASSERT_THROW(ExternalSort<char>(m_directory / "missing", m_directory / "out", options(1024, 1)), std::filesystem::filesystem_error);
+    ASSERT_THROW(ExternalSort<char>(m_directory / "in", m_directory / "no_dir" / "out", options(1024, 1)), std::system_error);
+}
+
+TEST(TestLoserTree, ShouldMergeStably)
+{
+    // Sources of pairs (key, source): equal keys come out in the order of sources
+    std::vector<std::vector<std::pair<int, int>>> sources(7);
+    std::mt19937 gen(3);
+    for (int source = 0; source < 7; ++source)
+    {
+        sources[source].resize(source * 10);
+        for (auto& value : sources[source])
+        {
+            value = {static_cast<int>(gen() % 20), source};
+        }
+        std::sort(sources[source].begin(), sources[source].end());
+    }
+
+    auto less = [](const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) { return lhs.first < rhs.first; };
+    std::vector<size_t> positions(sources.size());
+    std::vector<const std::pair<int, int>*> heads;
+    for (const auto& source : sources)
+    {
+        heads.push_back(source.empty() ? nullptr : source.data());
+    }
+
+    detail::LoserTree<std::pair<int, int>, decltype(less)> tree(heads, less);
+    std::vector<std::pair<int, int>> merged;
+    while (const auto* top = tree.top())
+    {
+        merged.push_back(*top);
+        const size_t source = tree.top_source();
+        tree.replace_top(++positions[source] < sources[source].size() ? &sources[source][positions[source]] : nullptr);
+    }
+
+    ASSERT_EQ(210u, merged.size());
+    ASSERT_TRUE(std::is_sorted(merged.begin(), merged.end()));
+}
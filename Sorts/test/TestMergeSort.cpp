@@ -0,0 +1,69 @@
+#include "MergeSort.hpp"
+
+#include "SortTestInputs.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+TEST(TestMergeSort, ShouldSortLikeStdSort)
+{
+    expect_sorts_like_std_sort([](auto& vec) { MergeSort(vec); }, {0, 1, 16, 17, 100, 1000, 100000});
+}
+
+TEST(TestMergeSort, ShouldBeStable)
+{
+    // Key and position in the input
+    std::vector<std::pair<int, int>> vec;
+    const auto keys = random_vector(5000, 20);
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        vec.emplace_back(keys[i], static_cast<int>(i));
+    }
+
+    MergeSort(vec, [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+}
+
+TEST(TestMergeSort, ShouldSortMoveOnlyValues)
+{
+    std::vector<std::unique_ptr<std::string>> vec;
+    for (const int value : random_vector(300, 1000))
+    {
+        vec.push_back(std::make_unique<std::string>(std::to_string(value)));
+    }
+
+    MergeSort(vec, [](const auto& lhs, const auto& rhs) { return *lhs > *rhs; });
+
+    ASSERT_TRUE(std::all_of(vec.begin(), vec.end(), [](const auto& ptr) { return ptr != nullptr; }));
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end(), [](const auto& lhs, const auto& rhs) { return *lhs < *rhs; }));
+}
+
+TEST(TestMergeSort, ShouldSortWithScratchSpace)
+{
+    std::vector<int> scratch(1000);
+
+    auto vec = random_vector(1000, 100);
+    auto expected = vec;
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+    MergeSort(vec.begin(), vec.end(), std::span<int>(scratch), std::less<int>());
+    ASSERT_EQ(expected, vec);
+
+    // Scratch is reused
+    vec = random_vector(500, 100, 2);
+    MergeSort(vec.begin(), vec.end(), std::span<int>(scratch));
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+
+    ASSERT_THROW(MergeSort(vec.begin(), vec.end(), std::span<int>(scratch).first(499)), std::invalid_argument);
+}
@@ -0,0 +1,197 @@
+#include "ParallelSort.hpp"
+
+#include "SortTestInputs.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+namespace
+{
+    // Small grain makes even short ranges go through the parallel paths
+    constexpr size_t TestGrain = 64;
+}
+
+TEST(TestThreadPool, ShouldRunAllTasksOfGroup)
+{
+    for (const size_t workers : {0, 1, 3})
+    {
+        ThreadPool pool(workers);
+        std::atomic<int> counter = 0;
+
+        TaskGroup group(pool);
+        for (int i = 0; i < 1000; ++i)
+        {
+            group.run([&counter]{ counter.fetch_add(1, std::memory_order_relaxed); });
+        }
+        group.wait();
+
+        ASSERT_EQ(1000, counter.load()) << "workers " << workers;
+    }
+}
+
+TEST(TestThreadPool, ShouldRunNestedGroupsWithoutDeadlock)
+{
+    ThreadPool pool(1);
+    std::atomic<int> counter = 0;
+
+    TaskGroup outer(pool);
+    for (int i = 0; i < 8; ++i)
+    {
+        outer.run([&]
+        {
+            TaskGroup inner(pool);
+            for (int j = 0; j < 8; ++j)
+            {
+                inner.run([&counter]{ counter.fetch_add(1, std::memory_order_relaxed); });
+            }
+            inner.wait();
+        });
+    }
+    outer.wait();
+
+    ASSERT_EQ(64, counter.load());
+}
+
+TEST(TestThreadPool, ShouldRethrowTaskException)
+{
+    ThreadPool pool(2);
+    TaskGroup group(pool);
+
+    group.run([]{ throw std::runtime_error("task"); });
+    group.run([]{});
+
+    ASSERT_THROW(group.wait(), std::runtime_error);
+    // Exception is reported once
+    ASSERT_NO_THROW(group.wait());
+}
+
+TEST(TestParallelSort, ShouldSortLikeStdSort)
+{
+    for (const size_t workers : {0, 1, 3})
+    {
+        SCOPED_TRACE("workers " + std::to_string(workers));
+        ThreadPool pool(workers);
+        const std::initializer_list<size_t> sizes = {0, 1, 63, 64, 65, 1000, 100000};
+
+        expect_sorts_like_std_sort([&pool](auto& vec) { ParallelMergeSort(pool, vec.begin(), vec.end(), std::greater<int>{}, TestGrain); }, sizes);
+        expect_sorts_like_std_sort([&pool](auto& vec) { ParallelSort(pool, vec.begin(), vec.end(), std::greater<int>{}, TestGrain); }, sizes);
+    }
+}
+
+TEST(TestParallelSort, ShouldSortPatternsAndDuplicates)
+{
+    ThreadPool pool(3);
+    const size_t size = 50000;
+
+    for (auto& input : sort_inputs(size))
+    {
+        auto expected = input;
+        std::sort(expected.begin(), expected.end());
+
+        auto merged = input;
+        ParallelMergeSort(pool, merged, std::greater<int>{}, TestGrain);
+        ASSERT_EQ(expected, merged);
+
+        ParallelSort(pool, input, std::greater<int>{}, TestGrain);
+        ASSERT_EQ(expected, input);
+    }
+}
+
+TEST(TestParallelSort, ShouldBalanceBucketsOfFewUniqueKeys)
+{
+    auto less = detail::as_less(std::greater<int>{});
+    auto sample = random_vector(1024, 3, 2);
+    std::sort(sample.begin(), sample.end());
+
+    // Four keys: each one goes to its own equality bucket, which is not sorted
+    const detail::SampleSortBuckets<int> buckets(sample, 64, less);
+    std::vector<size_t> sizes(buckets.bucket_count());
+    for (const int value : random_vector(100000, 3))
+    {
+        ++sizes[buckets.classify(value, less)];
+    }
+
+    for (size_t bucket = 0; bucket < sizes.size(); ++bucket)
+    {
+        if (!buckets.is_equality_bucket(bucket))
+        {
+            ASSERT_EQ(0u, sizes[bucket]) << "bucket " << bucket;
+        }
+    }
+    ASSERT_EQ(9u, sizes.size());
+    ASSERT_LT(*std::max_element(sizes.begin(), sizes.end()), 30000u);
+
+    // Distinct splitters: no equality buckets
+    const auto distinct = std::vector<int>{10, 20, 30, 40};
+    const detail::SampleSortBuckets<int> ranges(distinct, 4, less);
+    ASSERT_EQ(4u, ranges.bucket_count());
+    ASSERT_EQ(0u, ranges.classify(5, less));
+    ASSERT_EQ(1u, ranges.classify(20, less));
+    ASSERT_EQ(3u, ranges.classify(45, less));
+}
+
+TEST(TestParallelSort, ShouldMergeSortStable)
+{
+    ThreadPool pool(3);
+
+    // Key and position in the input
+    std::vector<std::pair<int, int>> vec;
+    const auto keys = random_vector(20000, 20);
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        vec.emplace_back(keys[i], static_cast<int>(i));
+    }
+
+    ParallelMergeSort(pool, vec, [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; }, TestGrain);
+
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+}
+
+TEST(TestParallelSort, ShouldSortStringsDescending)
+{
+    ThreadPool pool(2);
+
+    std::vector<std::string> vec;
+    for (const int value : random_vector(5000, 1000))
+    {
+        vec.push_back("value " + std::to_string(value));
+    }
+    auto expected = vec;
+    std::sort(expected.begin(), expected.end(), std::greater<std::string>{});
+
+    auto merged = vec;
+    ParallelMergeSort(pool, merged, std::less<std::string>{}, TestGrain);
+    ASSERT_EQ(expected, merged);
+
+    ParallelSort(pool, vec, std::less<std::string>{}, TestGrain);
+    ASSERT_EQ(expected, vec);
+}
+
+TEST(TestParallelSort, ShouldPropagateComparatorException)
+{
+    ThreadPool pool(2);
+    auto vec = random_vector(10000, 1000);
+    const auto throwing = [](int lhs, int rhs)
+    {
+        if (lhs == 500 || rhs == 500)
+        {
+            throw std::runtime_error("comparator");
+        }
+        return lhs > rhs;
+    };
+    vec[5000] = 500;
+
+    auto merged = vec;
+    ASSERT_THROW(ParallelMergeSort(pool, merged, throwing, TestGrain), std::runtime_error);
+    ASSERT_THROW(ParallelSort(pool, vec, throwing, TestGrain), std::runtime_error);
+}
@@ -0,0 +1,149 @@
+#include "PdqSort.hpp"
+
+#include "SortTestInputs.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+namespace
+{
+    // Counts comparisons, keeps the comparator non-branchless
+    struct CountingGreater
+    {
+        bool operator()(int lhs, int rhs) const
+        {
+            ++*count;
+            return lhs > rhs;
+        }
+
+        size_t* count;
+    };
+}
+
+TEST(TestPdqSort, ShouldSortShortVectors)
+{
+    expect_sorts_short_vectors([](auto& vec) { PdqSort(vec); });
+}
+
+TEST(TestPdqSort, ShouldSortLikeStdSort)
+{
+    for (const size_t size : {23, 24, 100, 129, 1000, 100000})
+    {
+        for (const int maxValue : {1, 10, 1 << 30})
+        {
+            // Branchless partition for arithmetic keys
+            auto ints = random_vector(size, maxValue);
+            auto doubles = random_vector<double>(size, maxValue);
+            // Partition with branches
+            auto strings = std::vector<std::string>(size);
+            std::transform(ints.begin(), ints.end(), strings.begin(), [](int value) { return std::to_string(value); });
+
+            auto expectedInts = ints;
+            auto expectedDoubles = doubles;
+            auto expectedStrings = strings;
+            std::sort(expectedInts.begin(), expectedInts.end());
+            std::sort(expectedDoubles.begin(), expectedDoubles.end());
+            std::sort(expectedStrings.begin(), expectedStrings.end());
+
+            PdqSort(ints);
+            PdqSort(doubles);
+            PdqSort(strings);
+
+            ASSERT_EQ(expectedInts, ints) << "size " << size << ", max value " << maxValue;
+            ASSERT_EQ(expectedDoubles, doubles) << "size " << size << ", max value " << maxValue;
+            ASSERT_EQ(expectedStrings, strings) << "size " << size << ", max value " << maxValue;
+        }
+    }
+}
+
+TEST(TestPdqSort, ShouldSortDescendingWithStdLess)
+{
+    auto vec = random_vector(10000, 1 << 20);
+    PdqSort(vec, std::less<int>());
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end(), std::greater<int>()));
+
+    std::vector<std::unique_ptr<int>> pointers;
+    for (const int value : random_vector(1000, 100))
+    {
+        pointers.push_back(std::make_unique<int>(value));
+    }
+    PdqSort(pointers, [](const auto& lhs, const auto& rhs) { return *lhs > *rhs; });
+    ASSERT_TRUE(std::is_sorted(pointers.begin(), pointers.end(), [](const auto& lhs, const auto& rhs) { return *lhs < *rhs; }));
+}
+
+TEST(TestPdqSort, ShouldSortPatternsInLinearTime)
+{
+    constexpr int size = 100000;
+    std::vector<std::vector<int>> inputs(3, std::vector<int>(size));
+    for (int i = 0; i < size; ++i)
+    {
+        inputs[0][i] = i;           // Sorted
+        inputs[1][i] = size - i;    // Reversed
+        inputs[2][i] = 7;           // All equal
+    }
+
+    for (auto& vec : inputs)
+    {
+        size_t comparisons = 0;
+        PdqSort(vec, CountingGreater{&comparisons});
+
+        ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+        ASSERT_LT(comparisons, 4u * size);
+    }
+}
+
+TEST(TestPdqSort, ShouldSortManyEqualElementsFast)
+{
+    constexpr int size = 100000;
+    auto vec = random_vector(size, 3);
+
+    size_t comparisons = 0;
+    PdqSort(vec, CountingGreater{&comparisons});
+
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+    ASSERT_LT(comparisons, 8u * size);
+}
+
+TEST(TestPdqSort, ShouldKeepComparisonsLogLinearOnAdversarialInput)
+{
+    // McIlroy's adversary, see TestQuickSort
+    constexpr int size = 1 << 14;
+    const int gas = size;
+    std::vector<int> values(size, gas);
+    int solid = 0;
+    int candidate = 0;
+    size_t comparisons = 0;
+
+    const auto greater = [&](int lhs, int rhs)
+    {
+        ++comparisons;
+        if (values[lhs] == gas && values[rhs] == gas)
+        {
+            values[lhs == candidate ? lhs : rhs] = solid++;
+        }
+
+        if (values[lhs] == gas) candidate = lhs;
+        else if (values[rhs] == gas) candidate = rhs;
+
+        return values[lhs] > values[rhs];
+    };
+
+    std::vector<int> indices(size);
+    for (int i = 0; i < size; ++i)
+    {
+        indices[i] = i;
+    }
+
+    PdqSort(indices, greater);
+
+    ASSERT_TRUE(std::is_sorted(indices.begin(), indices.end(), [&values](int lhs, int rhs) { return values[lhs] < values[rhs]; }));
+    ASSERT_LT(comparisons, 4u * size * 14);
+}
@@ -0,0 +1,119 @@
+#include "QuickSort.hpp"
+
+#include "SortTestInputs.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+TEST(TestQuickSort, ShouldSortShortVectors)
+{
+    expect_sorts_short_vectors([](auto& vec) { QuickSort(vec); });
+}
+
+TEST(TestQuickSort, ShouldSortLikeStdSort)
+{
+    expect_sorts_like_std_sort([](auto& vec) { QuickSort(vec); }, {17, 100, 129, 1000, 100000}, {1, 10, 1 << 30});
+}
+
+TEST(TestQuickSort, ShouldSortPatterns)
+{
+    constexpr int size = 10000;
+    auto inputs = sort_inputs(size);
+
+    std::vector<int> interleaved(size);
+    for (int i = 0; i < size; ++i)
+    {
+        interleaved[i] = i % 2 ? i : size - i;
+    }
+    inputs.push_back(interleaved);
+
+    for (auto& vec : inputs)
+    {
+        QuickSort(vec);
+        ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+    }
+}
+
+TEST(TestQuickSort, ShouldSortWithComparator)
+{
+    std::vector<std::string> vec{"bb", "a", "dddd", "ccc"};
+
+    QuickSort(vec, std::less<std::string>());
+    ASSERT_THAT(vec, ElementsAreArray({"dddd", "ccc", "bb", "a"}));
+
+    QuickSort(vec, [](const std::string& lhs, const std::string& rhs) { return lhs.size() > rhs.size(); });
+    ASSERT_THAT(vec, ElementsAreArray({"a", "bb", "ccc", "dddd"}));
+}
+
+TEST(TestQuickSort, ShouldSortRangeOfMoveOnlyValues)
+{
+    std::vector<std::unique_ptr<int>> vec;
+    for (const int value : random_vector(500, 1000))
+    {
+        vec.push_back(std::make_unique<int>(value));
+    }
+
+    // Middle part only
+    const auto greater = [](const auto& lhs, const auto& rhs) { return *lhs > *rhs; };
+    QuickSort(vec.begin() + 100, vec.end() - 100, greater);
+
+    ASSERT_TRUE(std::is_sorted(vec.begin() + 100, vec.end() - 100, [](const auto& lhs, const auto& rhs) { return *lhs < *rhs; }));
+}
+
+TEST(TestQuickSort, ShouldKeepComparisonsLogLinearOnAdversarialInput)
+{
+    // McIlroy's adversary: values are fixed lazily during the sort, so that every pivot is bad.
+    // Drives any plain quick sort to O(n^2) comparisons
+    constexpr int size = 1 << 14;
+    const int gas = size;
+    std::vector<int> values(size, gas);
+    int solid = 0;
+    int candidate = 0;
+    size_t comparisons = 0;
+
+    const auto greater = [&](int lhs, int rhs)
+    {
+        ++comparisons;
+        if (values[lhs] == gas && values[rhs] == gas)
+        {
+            values[lhs == candidate ? lhs : rhs] = solid++;
+        }
+
+        if (values[lhs] == gas) candidate = lhs;
+        else if (values[rhs] == gas) candidate = rhs;
+
+        return values[lhs] > values[rhs];
+    };
+
+    std::vector<int> indices(size);
+    for (int i = 0; i < size; ++i)
+    {
+        indices[i] = i;
+    }
+
+    QuickSort(indices, greater);
+
+    ASSERT_TRUE(std::is_sorted(indices.begin(), indices.end(), [&values](int lhs, int rhs) { return values[lhs] < values[rhs]; }));
+    ASSERT_LT(comparisons, 4u * size * 14);
+}
+
+TEST(TestQuickSort, ShouldHeapSort)
+{
+    auto vec = random_vector(1000, 100);
+    auto expected = vec;
+    std::sort(expected.begin(), expected.end());
+
+    auto less = std::less<int>();
+    detail::heap_sort(vec.begin(), vec.end(), less);
+
+    ASSERT_EQ(expected, vec);
+}
@@ -0,0 +1,231 @@
+#include "RadixSort.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+namespace
+{
+    template<class T>
+    std::vector<T> random_vector(size_t size, unsigned seed = 1)
+    {
+        std::mt19937_64 gen(seed);
+        std::vector<T> vec(size);
+        for (auto& value : vec)
+        {
+            value = static_cast<T>(gen());
+        }
+        return vec;
+    }
+
+    std::vector<std::string> random_strings(size_t size, size_t maxLength, const std::string& alphabet, unsigned seed = 1)
+    {
+        std::mt19937 gen(seed);
+        std::vector<std::string> vec(size);
+        for (auto& str : vec)
+        {
+            str.resize(gen() % (maxLength + 1));
+            for (auto& ch : str)
+            {
+                ch = alphabet[gen() % alphabet.size()];
+            }
+        }
+        return vec;
+    }
+
+    template<class T>
+    void expect_sorted_like_std(std::vector<T> vec)
+    {
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        auto vec11 = vec;
+        auto vec16 = vec;
+        RadixSort(vec);
+        RadixSort<11>(vec11);
+        RadixSort<16>(vec16);
+
+        ASSERT_EQ(expected, vec) << "size " << vec.size();
+        ASSERT_EQ(expected, vec11) << "size " << vec.size();
+        ASSERT_EQ(expected, vec16) << "size " << vec.size();
+    }
+}
+
+TEST(TestRadixSort, ShouldSortIntegers)
+{
+    for (const size_t size : {0, 1, 64, 65, 1000, 100000})
+    {
+        expect_sorted_like_std(random_vector<uint32_t>(size));
+        expect_sorted_like_std(random_vector<int32_t>(size));
+        expect_sorted_like_std(random_vector<uint64_t>(size));
+        expect_sorted_like_std(random_vector<int64_t>(size));
+        expect_sorted_like_std(random_vector<int8_t>(size));
+        expect_sorted_like_std(random_vector<uint16_t>(size));
+    }
+}
+
+TEST(TestRadixSort, ShouldSortNarrowRangeSkippingPasses)
+{
+    // Timestamps within a second: only low digits differ
+    auto vec = random_vector<uint64_t>(10000);
+    for (auto& value : vec)
+    {
+        value = 1700000000000000000ull + value % 1000000000;
+    }
+    expect_sorted_like_std(vec);
+
+    expect_sorted_like_std(std::vector<int>(1000, -7));
+}
+
+TEST(TestRadixSort, ShouldSortFloatsByValue)
+{
+    std::vector<float> floats;
+    std::vector<double> doubles;
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    for (int i = 0; i < 10000; ++i)
+    {
+        const double value = dist(gen);
+        doubles.push_back(value);
+        floats.push_back(static_cast<float>(value));
+    }
+    for (const double special : {0.0, -1e-300, 1e-300, std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()})
+    {
+        doubles.push_back(special);
+        floats.push_back(static_cast<float>(special));
+    }
+
+    expect_sorted_like_std(floats);
+    expect_sorted_like_std(doubles);
+}
+
+TEST(TestRadixSort, ShouldOrderSignedZerosAndNans)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> vec = {1.0, nan, 0.0, -nan, -0.0, -1.0};
+    vec.resize(100, 2.0);
+
+    RadixSort(vec);
+
+    ASSERT_TRUE(std::isnan(vec.front()) && std::signbit(vec.front()));
+    ASSERT_EQ(-1.0, vec[1]);
+    ASSERT_TRUE(vec[2] == 0.0 && std::signbit(vec[2]));
+    ASSERT_TRUE(vec[3] == 0.0 && !std::signbit(vec[3]));
+    ASSERT_TRUE(std::isnan(vec.back()) && !std::signbit(vec.back()));
+}
+
+TEST(TestRadixSort, ShouldSortRecordsByKeyStable)
+{
+    struct Record
+    {
+        int64_t timestamp = 0;
+        std::string payload;
+    };
+
+    for (const size_t size : {50, 5000})
+    {
+        std::vector<Record> records;
+        for (const auto value : random_vector<int64_t>(size))
+        {
+            records.push_back({value % 100, std::to_string(records.size())});
+        }
+
+        RadixSort(records, &Record::timestamp);
+
+        for (size_t i = 1; i < records.size(); ++i)
+        {
+            ASSERT_LE(records[i - 1].timestamp, records[i].timestamp);
+            if (records[i - 1].timestamp == records[i].timestamp)
+            {
+                ASSERT_LT(std::stoi(records[i - 1].payload), std::stoi(records[i].payload));
+            }
+        }
+    }
+}
+
+TEST(TestRadixSort, ShouldSortDescendingByNegatedKey)
+{
+    auto vec = random_vector<int32_t>(1000);
+    auto expected = vec;
+    std::sort(expected.begin(), expected.end(), std::greater<int64_t>{});
+
+    RadixSort(vec, [](int32_t value) { return -static_cast<int64_t>(value); });
+
+    ASSERT_EQ(expected, vec);
+}
+
+TEST(TestRadixSort, ShouldSortStrings)
+{
+    std::vector<std::vector<std::string>> inputs = {
+        {},
+        {"b", "", "a"},
+        random_strings(1000, 12, "ab"),
+        random_strings(20000, 30, "abcdefghijklmnopqrstuvwxyz"),
+        // Bytes above 127 go after ASCII as in std::string comparison
+        random_strings(1000, 5, "a\x80\xff z"),
+    };
+
+    // Long common prefix
+    std::vector<std::string> prefixed = random_strings(1000, 5, "xyz");
+    for (auto& str : prefixed)
+    {
+        str = std::string(100, 'p') + str;
+    }
+    inputs.push_back(prefixed);
+
+    for (auto& vec : inputs)
+    {
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        MsdRadixSort(vec);
+
+        ASSERT_EQ(expected, vec);
+    }
+}
+
+TEST(TestRadixSort, ShouldSortNestedPrefixes)
+{
+    // "", "a", "aa"... : every level splits one key off
+    std::vector<std::string> vec;
+    for (size_t i = 0; i < 3000; ++i)
+    {
+        vec.push_back(std::string(i, 'a'));
+    }
+    std::shuffle(vec.begin(), vec.end(), std::mt19937(1));
+    auto expected = vec;
+    std::sort(expected.begin(), expected.end());
+
+    MsdRadixSort(vec);
+
+    ASSERT_EQ(expected, vec);
+}
+
+TEST(TestRadixSort, ShouldSortRecordsByStringKey)
+{
+    struct Record
+    {
+        std::string name;
+        int id = 0;
+    };
+
+    std::vector<Record> records;
+    for (const auto& name : random_strings(2000, 8, "abc"))
+    {
+        records.push_back({name, static_cast<int>(records.size())});
+    }
+
+    MsdRadixSort(records, &Record::name);
+
+    ASSERT_TRUE(std::is_sorted(records.begin(), records.end(), [](const Record& lhs, const Record& rhs) { return lhs.name < rhs.name; }));
+}
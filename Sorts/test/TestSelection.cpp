@@ -0,0 +1,138 @@
+#include "Selection.hpp"
+
+#include "SortTestInputs.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+namespace
+{
+    // Select(vec, nth) has to put the element of the sorted vector at nth there, less or equal
+    // elements before it and greater or equal ones after it
+    template<class Select>
+    void expect_nth_element(std::vector<int> vec, size_t nth, Select select)
+    {
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        select(vec, nth);
+
+        const auto nthIt = vec.begin() + static_cast<std::ptrdiff_t>(nth);
+        ASSERT_EQ(expected[nth], *nthIt) << "size " << vec.size() << " nth " << nth;
+        ASSERT_TRUE(std::all_of(vec.begin(), nthIt, [&](int value) { return value <= *nthIt; }));
+        ASSERT_TRUE(std::all_of(nthIt, vec.end(), [&](int value) { return value >= *nthIt; }));
+    }
+
+    void expect_partial_sort(std::vector<int> vec, size_t count)
+    {
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+        expected.resize(count);
+
+        PartialSort(vec, count);
+
+        ASSERT_EQ(expected, std::vector<int>(vec.begin(), vec.begin() + static_cast<std::ptrdiff_t>(count))) << "size " << vec.size();
+    }
+}
+
+TEST(TestSelection, ShouldSelectNthElement)
+{
+    for (const size_t size : {1, 2, 16, 17, 100, 10000})
+    {
+        for (const auto& vec : sort_inputs(size))
+        {
+            for (const size_t nth : {size_t{0}, size / 3, size / 2, size - 1})
+            {
+                expect_nth_element(vec, nth, [](std::vector<int>& data, size_t n) { NthElement(data, n); });
+            }
+        }
+    }
+}
+
+TEST(TestSelection, ShouldSelectWithMedianOfMedians)
+{
+    // Fallback for bad pivots, run alone
+    auto select = [](std::vector<int>& data, size_t nth)
+    {
+        auto less = detail::as_less(std::greater<int>{});
+        detail::median_of_medians_select(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(nth), data.end(), less);
+    };
+
+    for (const auto& vec : sort_inputs(10000))
+    {
+        for (const size_t nth : {0, 1234, 5000, 9999})
+        {
+            expect_nth_element(vec, nth, select);
+        }
+    }
+}
+
+TEST(TestSelection, ShouldSelectWithComparator)
+{
+    auto vec = random_vector(1000, 100);
+    auto expected = vec;
+    std::sort(expected.begin(), expected.end(), std::greater<int>{});
+
+    NthElement(vec.begin(), vec.begin() + 10, vec.end(), std::less<int>{});
+
+    ASSERT_EQ(expected[10], vec[10]);
+}
+
+TEST(TestSelection, ShouldPartialSort)
+{
+    for (const size_t size : {0, 1, 50, 10000})
+    {
+        for (const auto& vec : sort_inputs(size))
+        {
+            // Heap for few elements, selection for many
+            for (const size_t count : {size_t{0}, std::min<size_t>(size, 10), size / 100, size / 8, size / 2, size})
+            {
+                expect_partial_sort(vec, count);
+            }
+        }
+    }
+}
+
+TEST(TestSelection, ShouldKeepTopK)
+{
+    const auto vec = random_vector(100000, 1000000);
+    auto expected = vec;
+    std::sort(expected.begin(), expected.end(), std::greater<int>{});
+    expected.resize(100);
+
+    TopK<int> top(100);
+    for (const int value : vec)
+    {
+        top.push(value);
+    }
+
+    ASSERT_EQ(100u, top.size());
+    ASSERT_EQ(expected, top.sorted());
+    ASSERT_EQ(expected.back(), top.worst());
+}
+
+TEST(TestSelection, ShouldKeepAllWhenStreamIsShorterThanK)
+{
+    std::vector<std::string> words = {"pear", "apple", "fig"};
+    TopK<std::string, std::greater<std::string>> first(5);
+
+    first.push(words.begin(), words.end());
+    first.push(std::string("banana"));
+
+    ASSERT_THAT(first.sorted(), ElementsAre("apple", "banana", "fig", "pear"));
+    ASSERT_EQ("pear", first.worst());
+
+    first.clear();
+    ASSERT_TRUE(first.empty());
+    ASSERT_EQ(5u, first.capacity());
+    ASSERT_THROW(first.worst(), std::invalid_argument);
+    ASSERT_THROW(TopK<int>(0), std::invalid_argument);
+}
@@ -0,0 +1,214 @@
+#include "BubbleSort.hpp"
+#include "InsertSort.hpp"
+#include "Selection.hpp"
+#include "Sort.hpp"
+
+#include "CycleBuffer.hpp"
+#include "DoublyLinkedList.hpp"
+#include "ForwardList.hpp"
+#include "RingBuffer.hpp"
+
+#include "SortTestInputs.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+static_assert(std::ranges::forward_range<ForwardList<int>>);
+static_assert(std::ranges::bidirectional_range<DoublyLinkedList<int>>);
+static_assert(std::ranges::bidirectional_range<RingBuffer<int>>);
+static_assert(std::ranges::bidirectional_range<CycleBuffer<int>>);
+
+namespace
+{
+    struct Employee
+    {
+        std::string name;
+        int age;
+    };
+
+    std::vector<Employee> employees()
+    {
+        return {{"Kate", 35}, {"Bob", 24}, {"Alice", 35}, {"Dan", 41}, {"Eve", 24}, {"Carl", 35}};
+    }
+
+    std::vector<std::string> names(const std::vector<Employee>& vec)
+    {
+        std::vector<std::string> result;
+        for (const auto& employee : vec)
+        {
+            result.push_back(employee.name);
+        }
+        return result;
+    }
+
+    // Containers are filled with the input in order and sorted in place with sort(container)
+    template<class Container, class Fill, class SortFunc>
+    void expect_sorted(Container& container, const std::vector<int>& input, std::vector<int> expected, Fill fill, SortFunc sort)
+    {
+        for (const int value : input)
+        {
+            fill(container, value);
+        }
+        std::sort(expected.begin(), expected.end());
+
+        sort(container);
+
+        ASSERT_EQ(expected, std::vector<int>(container.begin(), container.end())) << "size " << input.size();
+    }
+
+    template<class SortFunc>
+    void expect_sorts_every_container(SortFunc sort)
+    {
+        auto pushBack = [](auto& container, int value) { container.push_back(value); };
+        auto push = [](auto& container, int value) { container.push(value); };
+
+        for (const size_t size : {0, 1, 2, 15, 16, 17, 100, 5000})
+        {
+            const auto input = random_vector(size, 1000);
+
+            ForwardList<int> forwardList;
+            expect_sorted(forwardList, input, input, pushBack, sort);
+            DoublyLinkedList<int> doublyLinkedList;
+            expect_sorted(doublyLinkedList, input, input, pushBack, sort);
+            std::list<int> list;
+            expect_sorted(list, input, input, pushBack, sort);
+            std::vector<int> vec;
+            expect_sorted(vec, input, input, pushBack, sort);
+
+            // Buffers of half of the input wrap around and keep the last pushed elements
+            const size_t capacity = std::max<size_t>(size / 2, 1);
+            const std::vector<int> kept(input.end() - static_cast<std::ptrdiff_t>(std::min(capacity, size)), input.end());
+            RingBuffer<int> ringBuffer(capacity);
+            expect_sorted(ringBuffer, input, kept, push, sort);
+            CycleBuffer<int> cycleBuffer(static_cast<int>(capacity));
+            expect_sorted(cycleBuffer, input, kept, pushBack, sort);
+        }
+    }
+}
+
+TEST(TestSort, ShouldSortEveryContainer)
+{
+    expect_sorts_every_container([](auto& container) { Sort(container); });
+    expect_sorts_every_container([](auto& container) { StableSort(container); });
+    expect_sorts_every_container([](auto& container) { MergeSort(container); });
+    expect_sorts_every_container([](auto& container) { Sort(container.begin(), container.end()); });
+}
+
+TEST(TestSort, ShouldStableSortByProjection)
+{
+    const std::vector<std::string> byAge = {"Bob", "Eve", "Kate", "Alice", "Carl", "Dan"};
+
+    auto vec = employees();
+    StableSort(vec, std::greater<>{}, &Employee::age);
+    ASSERT_EQ(byAge, names(vec));
+
+    const auto input = employees();
+    std::list<Employee> list(input.begin(), input.end());
+    StableSort(list, std::greater<>{}, &Employee::age);
+    ASSERT_EQ(byAge, names(std::vector<Employee>(list.begin(), list.end())));
+
+    // Descending by name length, then in the order of the input
+    ForwardList<Employee> forwardList;
+    for (const auto& employee : input)
+    {
+        forwardList.push_back(employee);
+    }
+    StableSort(forwardList, std::less<>{}, [](const Employee& employee) { return employee.name.size(); });
+    ASSERT_EQ((std::vector<std::string>{"Alice", "Kate", "Carl", "Bob", "Dan", "Eve"}),
+              names(std::vector<Employee>(forwardList.begin(), forwardList.end())));
+}
+
+TEST(TestSort, ShouldSortByProjectionWithEverySort)
+{
+    const std::vector<std::string> byName = {"Alice", "Bob", "Carl", "Dan", "Eve", "Kate"};
+    auto sortByName = [&](auto sort)
+    {
+        auto vec = employees();
+        sort(vec);
+        EXPECT_EQ(byName, names(vec));
+    };
+
+    sortByName([](auto& vec) { Sort(vec, {}, &Employee::name); });
+    sortByName([](auto& vec) { BubbleSort(vec, {}, &Employee::name); });
+    sortByName([](auto& vec) { InsertSort(vec, {}, &Employee::name); });
+    sortByName([](auto& vec) { QuickSort(vec, {}, &Employee::name); });
+    sortByName([](auto& vec) { PdqSort(vec, {}, &Employee::name); });
+    sortByName([](auto& vec) { MergeSort(vec, {}, &Employee::name); });
+    sortByName([](auto& vec) { TimSort(vec, {}, &Employee::name); });
+    sortByName([](auto& vec) { PartialSort(vec, vec.size(), {}, &Employee::name); });
+
+    auto vec = employees();
+    NthElement(vec, 2, {}, &Employee::name);
+    ASSERT_EQ("Carl", vec[2].name);
+}
+
+TEST(TestSort, ShouldSortViews)
+{
+    // Counted view of a list has a sentinel instead of the end iterator
+    std::list<int> list = {5, 4, 3, 2, 1, 0};
+    Sort(std::views::counted(list.begin(), 4));
+    ASSERT_THAT(list, ElementsAre(2, 3, 4, 5, 1, 0));
+
+    std::vector<int> vec = {3, 1, 2, 5, 4};
+    Sort(std::views::reverse(vec));
+    ASSERT_THAT(vec, ElementsAre(5, 4, 3, 2, 1));
+
+    StableSort(std::views::drop(vec, 2));
+    ASSERT_THAT(vec, ElementsAre(5, 4, 1, 2, 3));
+}
+
+TEST(TestSort, ShouldBubbleSortForwardIterators)
+{
+    // Last element in place after the first pass
+    std::vector vec{2, 1, 3};
+    BubbleSort(vec);
+    ASSERT_THAT(vec, ElementsAre(1, 2, 3));
+
+    ForwardList<int> forwardList;
+    for (const int value : random_vector(300, 50))
+    {
+        forwardList.push_back(value);
+    }
+    BubbleSort(forwardList);
+    ASSERT_TRUE(std::is_sorted(forwardList.begin(), forwardList.end()));
+
+    // One pass for presorted input
+    size_t comparisons = 0;
+    BubbleSort(forwardList, [&comparisons](int lhs, int rhs) { ++comparisons; return lhs > rhs; });
+    ASSERT_EQ(299u, comparisons);
+}
+
+TEST(TestSort, ShouldKeepListElementsIfComparatorThrows)
+{
+    const auto input = random_vector(2000, 1 << 20);
+    for (const int throwAt : {10, 5000, 15000})
+    {
+        std::list<int> list(input.begin(), input.end());
+        int comparisons = 0;
+        auto comparator = [&](int lhs, int rhs)
+        {
+            if (++comparisons == throwAt) throw std::runtime_error("comparator");
+            return lhs > rhs;
+        };
+
+        ASSERT_THROW(MergeSort(list, comparator), std::runtime_error);
+
+        auto expected = input;
+        std::vector<int> vec(list.begin(), list.end());
+        std::sort(vec.begin(), vec.end());
+        std::sort(expected.begin(), expected.end());
+        ASSERT_EQ(expected, vec);
+    }
+}
@@ -0,0 +1,122 @@
+#include "MergeSort.hpp"
+#include "QuickSort.hpp"
+#include "SortingNetwork.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+namespace
+{
+    template<class T>
+    std::vector<T> random_values(size_t size, int maxValue, std::mt19937& gen)
+    {
+        std::uniform_int_distribution<int> dist(-maxValue, maxValue);
+        std::vector<T> vec(size);
+        for (auto& value : vec)
+        {
+            value = static_cast<T>(dist(gen));
+        }
+        return vec;
+    }
+
+    // Random arrays with few and many duplicates, sorted and reversed ones
+    template<size_t N, class T, class Sort>
+    void expect_sorts_like_std(Sort sort)
+    {
+        std::mt19937 gen(1);
+        for (int round = 0; round < 1000; ++round)
+        {
+            auto vec = random_values<T>(N, round % 2 ? 1000000 : 3, gen);
+            if (round == 0)
+            {
+                std::sort(vec.begin(), vec.end());
+            }
+            else if (round == 1)
+            {
+                std::sort(vec.begin(), vec.end(), std::greater<T>{});
+            }
+            auto expected = vec;
+            std::sort(expected.begin(), expected.end());
+
+            sort(vec.data());
+
+            ASSERT_EQ(expected, vec) << "N " << N << " round " << round;
+        }
+    }
+
+    template<class T>
+    void expect_all_sizes_sorted()
+    {
+        expect_sorts_like_std<8, T>([](T* data) { NetworkSort<8>(data); });
+        expect_sorts_like_std<16, T>([](T* data) { NetworkSort<16>(data); });
+        expect_sorts_like_std<32, T>([](T* data) { NetworkSort<32>(data); });
+        expect_sorts_like_std<64, T>([](T* data) { NetworkSort<64>(data); });
+
+        expect_sorts_like_std<8, T>([](T* data) { detail::scalar_network_sort<8>(data); });
+        expect_sorts_like_std<16, T>([](T* data) { detail::scalar_network_sort<16>(data); });
+        expect_sorts_like_std<32, T>([](T* data) { detail::scalar_network_sort<32>(data); });
+        expect_sorts_like_std<64, T>([](T* data) { detail::scalar_network_sort<64>(data); });
+    }
+}
+
+TEST(TestSortingNetwork, ShouldSortInt32)
+{
+    expect_all_sizes_sorted<int32_t>();
+}
+
+TEST(TestSortingNetwork, ShouldSortFloat)
+{
+    expect_all_sizes_sorted<float>();
+}
+
+TEST(TestSortingNetwork, ShouldSortExtremeValues)
+{
+    std::vector<int32_t> ints = {0, std::numeric_limits<int32_t>::max(), -1, std::numeric_limits<int32_t>::min(), 1, 7, -7, 0};
+    std::vector<float> floats = {0.5f, std::numeric_limits<float>::infinity(), -1e30f, -std::numeric_limits<float>::infinity(),
+                                 1e-30f, 7.0f, -7.0f, 0.0f};
+    auto expectedInts = ints;
+    auto expectedFloats = floats;
+    std::sort(expectedInts.begin(), expectedInts.end());
+    std::sort(expectedFloats.begin(), expectedFloats.end());
+
+    NetworkSort<8>(ints.data());
+    NetworkSort<8>(floats.data());
+
+    ASSERT_EQ(expectedInts, ints);
+    ASSERT_EQ(expectedFloats, floats);
+}
+
+TEST(TestSortingNetwork, ShouldSortSmallRangesInQuickAndMergeSort)
+{
+    // All base case sizes, padding with the greatest value included
+    std::mt19937 gen(2);
+    for (size_t size = 0; size <= 40; ++size)
+    {
+        auto ints = random_values<int32_t>(size, 100, gen);
+        ints.push_back(std::numeric_limits<int32_t>::max());
+        std::shuffle(ints.begin(), ints.end(), gen);
+        auto floats = random_values<float>(size, 100, gen);
+        auto expectedInts = ints;
+        auto expectedFloats = floats;
+        std::sort(expectedInts.begin(), expectedInts.end());
+        std::sort(expectedFloats.begin(), expectedFloats.end());
+
+        auto merged = ints;
+        QuickSort(ints);
+        MergeSort(merged);
+        QuickSort(floats);
+
+        ASSERT_EQ(expectedInts, ints) << "size " << size;
+        ASSERT_EQ(expectedInts, merged) << "size " << size;
+        ASSERT_EQ(expectedFloats, floats) << "size " << size;
+    }
+}
@@ -4,6 +4,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <string>
+#include <utility>
 #include <vector>
 
 using namespace ::testing;
@@ -34,4 +36,25 @@ TEST(TestSorts, ShouldInsertSortVectorInNonDescendingOrder)
     InsertSort(vec);
 
     ASSERT_THAT(vec, ElementsAreArray({-10.3, -1.1, 0.0, 2.2, 2.2, 3.3, 4.4, 5.5}));
-}
\ No newline at end of file
+}
+
+TEST(TestSorts, ShouldInsertSortRangeStable)
+{
+    std::vector<std::pair<int, std::string>> vec{{3, "a"}, {1, "b"}, {3, "c"}, {2, "d"}, {1, "e"}, {0, "f"}};
+
+    // Only keys are compared
+    InsertSort(vec.begin() + 1, vec.end(), [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+    ASSERT_THAT(vec, ElementsAreArray({
+        std::pair{3, std::string("a")}, {0, "f"}, {1, "b"}, {1, "e"}, {2, "d"}, {3, "c"}}));
+}
+
+TEST(TestSorts, ShouldInsertSortContainerStable)
+{
+    std::vector<std::pair<int, std::string>> vec{{2, "a"}, {1, "b"}, {2, "c"}, {1, "d"}};
+
+    InsertSort(vec, [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+    ASSERT_THAT(vec, ElementsAreArray({
+        std::pair{1, std::string("b")}, {1, "d"}, {2, "a"}, {2, "c"}}));
+}
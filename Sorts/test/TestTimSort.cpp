@@ -0,0 +1,169 @@
+#include "TimSort.hpp"
+
+#include "SortTestInputs.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+namespace
+{
+    // Sorted timestamps with 1% of positions starting a burst of 16 shuffled elements
+    std::vector<int> event_log(size_t size, unsigned seed = 1)
+    {
+        std::mt19937 gen(seed);
+        std::vector<int> vec(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            vec[i] = static_cast<int>(i);
+        }
+        for (size_t burst = 0; burst < size / 100 && size > 16; ++burst)
+        {
+            const auto start = vec.begin() + static_cast<std::ptrdiff_t>(gen() % (size - 16));
+            std::shuffle(start, start + 16, gen);
+        }
+        return vec;
+    }
+
+    // Pairs of key and position in the input: sorted by key, pairs have to be sorted if the sort is stable
+    void expect_stable_sort(const std::vector<int>& keys)
+    {
+        std::vector<std::pair<int, int>> vec;
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            vec.emplace_back(keys[i], static_cast<int>(i));
+        }
+
+        TimSort(vec, [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+        ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end())) << "size " << keys.size();
+    }
+
+    size_t count_comparisons(std::vector<int> vec)
+    {
+        size_t comparisons = 0;
+        TimSort(vec, [&comparisons](int lhs, int rhs) { ++comparisons; return lhs > rhs; });
+        EXPECT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+        return comparisons;
+    }
+}
+
+TEST(TestTimSort, ShouldSortLikeStdSort)
+{
+    expect_sorts_like_std_sort([](auto& vec) { TimSort(vec); }, {0, 1, 2, 63, 64, 65, 100, 1000, 100000});
+}
+
+TEST(TestTimSort, ShouldBeStable)
+{
+    for (const size_t size : {50, 5000, 100000})
+    {
+        expect_stable_sort(random_vector(size, 20));
+        expect_stable_sort(random_vector(size, 1));
+
+        // Descending runs with equal keys: reversed only where strictly descending
+        auto keys = random_vector(size, 20);
+        std::sort(keys.begin(), keys.end(), std::greater<int>());
+        expect_stable_sort(keys);
+    }
+}
+
+TEST(TestTimSort, ShouldSortPatterns)
+{
+    const size_t size = 50000;
+    auto inputs = sort_inputs(size);
+    inputs.push_back(event_log(size));
+
+    // Saw tooth, sorted with a random tail
+    std::vector<int> sawTooth(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        sawTooth[i] = static_cast<int>(i % 1000);
+    }
+    inputs.push_back(sawTooth);
+    auto tail = random_vector(size, 1 << 20);
+    std::sort(tail.begin(), tail.end());
+    std::shuffle(tail.end() - 100, tail.end(), std::mt19937(3));
+    inputs.push_back(tail);
+
+    // Interleaved blocks of two sorted halves: merges gallop
+    std::vector<int> blocks(size);
+    for (size_t i = 0; i < size / 2; ++i)
+    {
+        blocks[i] = static_cast<int>(i / 1000 * 2000 + i % 1000);
+        blocks[i + size / 2] = blocks[i] + 1000;
+    }
+    inputs.push_back(blocks);
+
+    for (auto& vec : inputs)
+    {
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        TimSort(vec);
+
+        ASSERT_EQ(expected, vec);
+    }
+}
+
+TEST(TestTimSort, ShouldSortPresortedInputInLinearTime)
+{
+    const size_t size = 100000;
+    auto sorted = random_vector(size, 1 << 20);
+    std::sort(sorted.begin(), sorted.end());
+    ASSERT_EQ(size - 1, count_comparisons(sorted));
+
+    // Reversed run has to be strictly descending
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    ASSERT_EQ(sorted.size() - 1, count_comparisons(std::vector<int>(sorted.rbegin(), sorted.rend())));
+
+    // Bursts are insertion sorted into runs, runs are merged with galloping
+    ASSERT_LT(count_comparisons(event_log(size)), 3 * size);
+    // Random input for comparison: n log2 n is 1.7M
+    ASSERT_GT(count_comparisons(random_vector(size, 1 << 20)), 10 * size);
+}
+
+TEST(TestTimSort, ShouldSortMoveOnlyValues)
+{
+    std::vector<std::unique_ptr<std::string>> vec;
+    for (const int value : random_vector(3000, 1000))
+    {
+        vec.push_back(std::make_unique<std::string>(std::to_string(value)));
+    }
+
+    TimSort(vec, [](const auto& lhs, const auto& rhs) { return *lhs > *rhs; });
+
+    ASSERT_TRUE(std::all_of(vec.begin(), vec.end(), [](const auto& ptr) { return ptr != nullptr; }));
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end(), [](const auto& lhs, const auto& rhs) { return *lhs < *rhs; }));
+}
+
+TEST(TestTimSort, ShouldKeepAllElementsIfComparatorThrows)
+{
+    const auto input = random_vector(10000, 1 << 20);
+    for (const int throwAt : {100, 50000, 120000})
+    {
+        auto vec = input;
+        int comparisons = 0;
+        auto comparator = [&](int lhs, int rhs)
+        {
+            if (++comparisons == throwAt) throw std::runtime_error("comparator");
+            return lhs > rhs;
+        };
+
+        ASSERT_THROW(TimSort(vec, comparator), std::runtime_error);
+
+        auto expected = input;
+        std::sort(vec.begin(), vec.end());
+        std::sort(expected.begin(), expected.end());
+        ASSERT_EQ(expected, vec);
+    }
+}
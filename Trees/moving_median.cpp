@@ -1,78 +1,14 @@
 #include <iostream>
-#include <set>		// BST: set, multiset, map, multimap
 #include <vector>
 
+#include "median_handler.hpp"
+
 using namespace std;
 
 // Задача. Дан массив целых чисел длины N и число K. 
 // Для каждого окна длины K найдите его медиану.
 
 
-class MedianHandler
-{
-public:
-
-	void insert(int element)
-	{
-		// lower.crbegin = lower.max
-
-		if(lower.empty() || element <= *lower.crbegin()){
-			lower.insert(element);
-		}
-		else{
-			upper.insert(element);
-		}
-	}
-
-	void erase(int element)
-	{
-		auto it = lower.find(element);
-
-		if(it != lower.end()){
-			lower.erase(it);
-		}
-		else{
-			it = upper.find(element);
-			upper.erase(it);
-		}
-	}
-
-	double get_median()
-	{
-		this->rebalance();
-
-		if(lower.size() != upper.size()){
-			return *lower.rbegin(); // lower.max
-		}
-
-		return (*lower.rbegin() + *upper.begin()) / 2.0;
-	}
-
-private:
-	// Holds two BST: invariant - lower.max <= upper.min
-	std::multiset<int> lower;
-	std::multiset<int> upper;
-
-	// Supports invariant lower.size - upper.size = [0, 1]
-	void rebalance()
-	{
-		while(lower.size() < upper.size()){
-			// upper.begin = upper.min
-			auto it = upper.begin();
-			lower.insert(*it);
-			upper.erase(it);
-		}
-
-		while(lower.size() > upper.size() + 1){
-			auto last_it = lower.end();
-			--last_it;
-			upper.insert(*last_it);
-			lower.erase(last_it);
-		}
-
-	}
-};
-
 // Time complixity: O(N * log K)
 //
 //
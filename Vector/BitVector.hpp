@@ -0,0 +1,370 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+// AVX2 code is compiled with the target attribute and chosen at runtime, so builds without
+// -mavx2 still use it on CPUs which have it
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ALGO_STRUCT_BIT_VECTOR_AVX2
+#define ALGO_STRUCT_BIT_VECTOR_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+namespace AlgoStruct
+{
+namespace detail
+{
+    // Bulk word operations: 4 words per AVX2 instruction if available, scalar loop otherwise
+    enum class BitOp
+    {
+        And,
+        Or,
+        Xor,
+        AndNot
+    };
+
+    template<BitOp Op>
+    inline uint64_t apply_bit_op(uint64_t dst, uint64_t src)
+    {
+        if constexpr (Op == BitOp::And) return dst & src;
+        if constexpr (Op == BitOp::Or) return dst | src;
+        if constexpr (Op == BitOp::Xor) return dst ^ src;
+        if constexpr (Op == BitOp::AndNot) return dst & ~src;
+    }
+
+    inline bool bit_ops_have_avx2()
+    {
+#ifdef ALGO_STRUCT_BIT_VECTOR_AVX2
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+#ifdef ALGO_STRUCT_BIT_VECTOR_AVX2
+    // Whole blocks of 4 words, returns the number of words done
+    template<BitOp Op>
+    ALGO_STRUCT_BIT_VECTOR_TARGET_AVX2 inline size_t apply_bit_op_avx2(uint64_t* dst, const uint64_t* src, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const auto d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+            const auto s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+
+            __m256i r;
+            if constexpr (Op == BitOp::And) r = _mm256_and_si256(d, s);
+            if constexpr (Op == BitOp::Or) r = _mm256_or_si256(d, s);
+            if constexpr (Op == BitOp::Xor) r = _mm256_xor_si256(d, s);
+            if constexpr (Op == BitOp::AndNot) r = _mm256_andnot_si256(s, d);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), r);
+        }
+        return i;
+    }
+#endif
+
+    template<BitOp Op>
+    inline void apply_bit_op(uint64_t* dst, const uint64_t* src, size_t count)
+    {
+        size_t i = 0;
+
+#ifdef ALGO_STRUCT_BIT_VECTOR_AVX2
+        if (bit_ops_have_avx2())
+        {
+            i = apply_bit_op_avx2<Op>(dst, src, count);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            dst[i] = apply_bit_op<Op>(dst[i], src[i]);
+        }
+    }
+} // namespace detail
+
+// Dense bit array packed into 64-bit words.
+//
+//   bit:   63 ............. 1 0 | 127 ........... 65 64 | ...
+//          [       word 0       ] [        word 1        ]
+//
+// Whole-word operations (popcount, search, bitwise ops with another BitVector) process
+// 64 bits per step, which suits visited sets and BFS frontiers of graph algorithms.
+// Bits beyond size() in the last word are always kept zero.
+class BitVector
+{
+public:
+    using Word = uint64_t;
+    static constexpr size_t BitsPerWord = 64;
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    // Proxy for a single mutable bit
+    class Reference
+    {
+    public:
+        Reference(Word& word, Word mask): m_word(word), m_mask(mask) {}
+
+        operator bool () const noexcept { return (m_word & m_mask) != 0; }
+        Reference& operator= (bool value) noexcept
+        {
+            m_word = value ? (m_word | m_mask) : (m_word & ~m_mask);
+            return *this;
+        }
+        Reference& operator= (const Reference& other) noexcept { return *this = static_cast<bool>(other); }
+
+    private:
+        Word& m_word;
+        Word m_mask;
+    };
+
+    BitVector() = default;
+    explicit BitVector(size_t size, bool value = false);
+    BitVector(std::initializer_list<bool> init);
+
+    // Element access
+    bool operator[] (size_t idx) const noexcept { return (m_words[idx / BitsPerWord] & bit_mask(idx)) != 0; }
+    Reference operator[] (size_t idx) noexcept { return Reference(m_words[idx / BitsPerWord], bit_mask(idx)); }
+    bool test(size_t idx) const;
+
+    // Word access: bits [64 * i, 64 * i + 63]
+    size_t word_count() const noexcept { return m_words.size(); }
+    Word word(size_t wordIdx) const { return m_words.at(wordIdx); }
+    std::span<const Word> words() const noexcept { return m_words; }
+
+    // Capacity
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+
+    // Modifiers
+    void set(size_t idx);
+    void set(size_t idx, bool value);
+    void reset(size_t idx);
+    void flip(size_t idx);
+    void set_all() noexcept;
+    void reset_all() noexcept;
+    void resize(size_t size, bool value = false);
+    void push_back(bool value);
+    void clear() noexcept;
+
+    // Counting
+    size_t count() const noexcept;
+    bool any() const noexcept;
+    bool none() const noexcept { return !any(); }
+    bool all() const noexcept { return count() == m_size; }
+
+    // Search: index of the found bit or npos. find_next(npos) stays npos
+    size_t find_first() const noexcept { return find_from<true>(0); }
+    size_t find_next(size_t idx) const noexcept { return idx < m_size ? find_from<true>(idx + 1) : npos; }
+    size_t find_first_unset() const noexcept { return find_from<false>(0); }
+    size_t find_next_unset(size_t idx) const noexcept { return idx < m_size ? find_from<false>(idx + 1) : npos; }
+
+    // Calls func(idx) for every set bit in ascending order
+    template<typename Func>
+    void for_each_set(Func func) const;
+
+    // Bulk operations with vector of the same size
+    BitVector& operator&= (const BitVector& other) { return apply<detail::BitOp::And>(other); }
+    BitVector& operator|= (const BitVector& other) { return apply<detail::BitOp::Or>(other); }
+    BitVector& operator^= (const BitVector& other) { return apply<detail::BitOp::Xor>(other); }
+    // Clears bits set in other: this & ~other
+    BitVector& and_not(const BitVector& other) { return apply<detail::BitOp::AndNot>(other); }
+
+    friend bool operator== (const BitVector& lhs, const BitVector& rhs) noexcept
+    {
+        return lhs.m_size == rhs.m_size && lhs.m_words == rhs.m_words;
+    }
+    friend bool operator!= (const BitVector& lhs, const BitVector& rhs) noexcept { return !(lhs == rhs); }
+
+private:
+    static Word bit_mask(size_t idx) noexcept { return Word{1} << (idx % BitsPerWord); }
+    static size_t words_for(size_t bits) noexcept { return (bits + BitsPerWord - 1) / BitsPerWord; }
+
+    void check_index(size_t idx) const
+    {
+        if (idx >= m_size) throw std::out_of_range("BitVector index out of range");
+    }
+
+    // Zeroes bits beyond size() in the last word
+    void trim_last_word() noexcept
+    {
+        if (const size_t tailBits = m_size % BitsPerWord)
+        {
+            m_words.back() &= (Word{1} << tailBits) - 1;
+        }
+    }
+
+    template<detail::BitOp Op>
+    BitVector& apply(const BitVector& other);
+
+    template<bool Value>
+    size_t find_from(size_t idx) const noexcept;
+
+private:
+    std::vector<Word> m_words;
+    size_t m_size = 0;
+};
+
+inline BitVector::BitVector(size_t size, bool value)
+    : m_words(words_for(size), value ? ~Word{0} : Word{0})
+    , m_size(size)
+{
+    trim_last_word();
+}
+
+inline BitVector::BitVector(std::initializer_list<bool> init)
+    : BitVector(init.size())
+{
+    size_t idx = 0;
+    for (const bool value : init)
+    {
+        set(idx++, value);
+    }
+}
+
+inline bool BitVector::test(size_t idx) const
+{
+    check_index(idx);
+    return (*this)[idx];
+}
+
+inline void BitVector::set(size_t idx)
+{
+    check_index(idx);
+    m_words[idx / BitsPerWord] |= bit_mask(idx);
+}
+
+inline void BitVector::set(size_t idx, bool value)
+{
+    check_index(idx);
+    (*this)[idx] = value;
+}
+
+inline void BitVector::reset(size_t idx)
+{
+    check_index(idx);
+    m_words[idx / BitsPerWord] &= ~bit_mask(idx);
+}
+
+inline void BitVector::flip(size_t idx)
+{
+    check_index(idx);
+    m_words[idx / BitsPerWord] ^= bit_mask(idx);
+}
+
+inline void BitVector::set_all() noexcept
+{
+    for (auto& word : m_words)
+    {
+        word = ~Word{0};
+    }
+    trim_last_word();
+}
+
+inline void BitVector::reset_all() noexcept
+{
+    for (auto& word : m_words)
+    {
+        word = 0;
+    }
+}
+
+inline void BitVector::resize(size_t size, bool value)
+{
+    const size_t oldSize = m_size;
+    m_words.resize(words_for(size), value ? ~Word{0} : Word{0});
+    m_size = size;
+
+    if (value && size > oldSize && oldSize % BitsPerWord != 0)
+    {
+        // Fill the tail of the previously last word
+        m_words[oldSize / BitsPerWord] |= ~Word{0} << (oldSize % BitsPerWord);
+    }
+    trim_last_word();
+}
+
+inline void BitVector::push_back(bool value)
+{
+    if (m_size % BitsPerWord == 0)
+    {
+        m_words.push_back(0);
+    }
+
+    ++m_size;
+    (*this)[m_size - 1] = value;
+}
+
+inline void BitVector::clear() noexcept
+{
+    m_words.clear();
+    m_size = 0;
+}
+
+inline size_t BitVector::count() const noexcept
+{
+    size_t result = 0;
+    for (const auto word : m_words)
+    {
+        result += std::popcount(word);
+    }
+    return result;
+}
+
+inline bool BitVector::any() const noexcept
+{
+    for (const auto word : m_words)
+    {
+        if (word) return true;
+    }
+    return false;
+}
+
+template<typename Func>
+void BitVector::for_each_set(Func func) const
+{
+    for (size_t wordIdx = 0; wordIdx < m_words.size(); ++wordIdx)
+    {
+        // Pops the lowest set bit on each step
+        for (Word word = m_words[wordIdx]; word; word &= word - 1)
+        {
+            func(wordIdx * BitsPerWord + std::countr_zero(word));
+        }
+    }
+}
+
+template<detail::BitOp Op>
+BitVector& BitVector::apply(const BitVector& other)
+{
+    if (m_size != other.m_size) throw std::invalid_argument("bitwise operation on BitVectors of different sizes");
+
+    detail::apply_bit_op<Op>(m_words.data(), other.m_words.data(), m_words.size());
+    return *this;
+}
+
+template<bool Value>
+size_t BitVector::find_from(size_t idx) const noexcept
+{
+    if (idx >= m_size) return npos;
+
+    size_t wordIdx = idx / BitsPerWord;
+    // Searched bits become ones, bits before idx are masked out
+    Word word = (Value ? m_words[wordIdx] : ~m_words[wordIdx]) & (~Word{0} << (idx % BitsPerWord));
+
+    while (!word)
+    {
+        if (++wordIdx == m_words.size()) return npos;
+        word = Value ? m_words[wordIdx] : ~m_words[wordIdx];
+    }
+
+    const size_t found = wordIdx * BitsPerWord + std::countr_zero(word);
+    // Unset search may hit padding bits of the last word
+    return found < m_size ? found : npos;
+}
+
+} // namespace AlgoStruct
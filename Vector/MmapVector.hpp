@@ -0,0 +1,350 @@
+#pragma once
+
+#include "Vector.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AlgoStruct
+{
+// Vector of fixed-size records stored in a memory-mapped file (POSIX).
+//
+// Opening is O(1): records are paged in on first access and the page cache is shared
+// between all processes mapping the same file. push_back() grows the file with ftruncate()
+// geometrically, the slack is cut off on close(). Records are accessed as raw bytes,
+// so T has to be trivially copyable.
+//
+// Iterators are plain pointers into the mapping and are invalidated by growth, as in Vector.
+// MmapVector<const T> opens an existing file read-only and maps it without write access:
+// all accessors return const references and modifiers are not available.
+namespace detail
+{
+    template<typename T>
+    struct MmapIterator { using type = typename Vector<T, UncheckedAccess>::Iterator; };
+
+    template<typename T>
+    struct MmapIterator<const T> { using type = const T*; };
+} // namespace detail
+
+template<typename T, typename AccessPolicy = DefaultAccessPolicy>
+class MmapVector
+{
+    static_assert(std::is_trivially_copyable_v<T>, "MmapVector stores records as raw bytes");
+
+    using Record = std::remove_const_t<T>;
+    static constexpr bool IsReadOnly = std::is_const_v<T>;
+
+public:
+    // Access pattern hints for the kernel readahead (madvise)
+    enum class Advice
+    {
+        Normal = MADV_NORMAL,
+        Sequential = MADV_SEQUENTIAL,
+        Random = MADV_RANDOM,
+        WillNeed = MADV_WILLNEED,
+        DontNeed = MADV_DONTNEED
+    };
+
+    using value_type = Record;
+    using size_type = size_t;
+    using iterator = typename detail::MmapIterator<T>::type;
+    using const_iterator = const Record*;
+
+    // Maps an existing file or creates an empty one (not for read-only MmapVector<const T>)
+    explicit MmapVector(const std::string& path);
+    ~MmapVector();
+
+    MmapVector(const MmapVector&) = delete;
+    MmapVector& operator= (const MmapVector&) = delete;
+    MmapVector(MmapVector&& other) noexcept;
+    MmapVector& operator= (MmapVector&& other) noexcept;
+
+    // Element access
+    const Record& front() const;
+    const Record& back() const;
+    const Record& at(size_t idx) const;
+    const Record& operator[] (size_t idx) const
+    {
+        if constexpr (AccessPolicy::enabled)
+        {
+            if (idx >= m_size) throw std::out_of_range("operator[] index out of MmapVector range");
+        }
+        return m_data[idx];
+    }
+
+    T& front() { return const_cast<T&>(std::as_const(*this).front()); }
+    T& back() { return const_cast<T&>(std::as_const(*this).back()); }
+    T& at(size_t idx) { return const_cast<T&>(std::as_const(*this).at(idx)); }
+    T& operator[] (size_t idx) { return const_cast<T&>(std::as_const(*this)[idx]); }
+
+    // Iterators
+    const_iterator begin() const noexcept { return m_data; }
+    const_iterator end() const noexcept { return m_data + m_size; }
+    iterator begin() noexcept { return iterator(m_data); }
+    iterator end() noexcept { return iterator(m_data + m_size); }
+
+    // Capacity
+    size_t size() const noexcept { return m_size; }
+    size_t capacity() const noexcept { return m_capacity; }
+    bool empty() const noexcept { return m_size == 0; }
+    void reserve(size_t capacity) requires (!IsReadOnly);
+
+    // Modifiers
+    void push_back(const Record& val) requires (!IsReadOnly);
+    void pop_back() requires (!IsReadOnly);
+    void resize(size_t size, Record initialVal = Record{}) requires (!IsReadOnly);
+    void swap(MmapVector& other) noexcept;
+
+    // Flushes dirty pages to the file (msync). Asynchronous flush only schedules the write-back
+    void sync(bool async = false) const;
+    void advise(Advice advice) const;
+
+    // Unmaps the file and truncates it to the actual size. Called by destructor
+    void close();
+
+private:
+    void remap(size_t newCapacity);
+    void ensure_open() const;
+
+    [[noreturn]] static void throw_errno(const std::string& what)
+    {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+private:
+    int m_fd = -1;
+    Record* m_data = nullptr;
+    size_t m_size = 0;
+    size_t m_capacity = 0;
+    static constexpr int CapExtensionFactor = 2;
+    // Growth is at least one page worth of records, to amortize ftruncate + mmap calls
+    static constexpr size_t MinGrowthBytes = 4096;
+};
+
+template<typename T, typename AccessPolicy>
+MmapVector<T, AccessPolicy>::MmapVector(const std::string& path)
+{
+    const int flags = IsReadOnly ? O_RDONLY : (O_RDWR | O_CREAT);
+    m_fd = ::open(path.c_str(), flags, 0644);
+    if (m_fd < 0) throw_errno("open() " + path);
+
+    struct stat st{};
+    if (::fstat(m_fd, &st) != 0)
+    {
+        const auto err = errno;
+        ::close(m_fd);
+        throw std::system_error(err, std::generic_category(), "fstat() " + path);
+    }
+
+    const auto fileSize = static_cast<size_t>(st.st_size);
+    if (fileSize % sizeof(T) != 0)
+    {
+        ::close(m_fd);
+        throw std::runtime_error("file size is not a multiple of record size: " + path);
+    }
+
+    try
+    {
+        remap(fileSize / sizeof(T));
+    }
+    catch (...)
+    {
+        ::close(m_fd);
+        throw;
+    }
+    m_size = m_capacity;
+}
+
+template<typename T, typename AccessPolicy>
+MmapVector<T, AccessPolicy>::~MmapVector()
+{
+    try
+    {
+        close();
+    }
+    catch (...)
+    {
+        // Destructor must not throw, the data is still in the page cache
+    }
+}
+
+template<typename T, typename AccessPolicy>
+MmapVector<T, AccessPolicy>::MmapVector(MmapVector&& other) noexcept
+{
+    this->swap(other);
+}
+
+template<typename T, typename AccessPolicy>
+MmapVector<T, AccessPolicy>& MmapVector<T, AccessPolicy>::operator= (MmapVector&& other) noexcept
+{
+    MmapVector tmp(std::move(other));
+    this->swap(tmp);
+    return *this;
+}
+
+template<typename T, typename AccessPolicy>
+auto MmapVector<T, AccessPolicy>::front() const -> const Record&
+{
+    if constexpr (AccessPolicy::enabled)
+    {
+        if (empty()) throw std::invalid_argument("front() on empty MmapVector");
+    }
+    return *m_data;
+}
+
+template<typename T, typename AccessPolicy>
+auto MmapVector<T, AccessPolicy>::back() const -> const Record&
+{
+    if constexpr (AccessPolicy::enabled)
+    {
+        if (empty()) throw std::invalid_argument("back() on empty MmapVector");
+    }
+    return m_data[m_size - 1];
+}
+
+template<typename T, typename AccessPolicy>
+auto MmapVector<T, AccessPolicy>::at(size_t idx) const -> const Record&
+{
+    if (idx >= m_size) throw std::out_of_range("at() index out of MmapVector range");
+    return m_data[idx];
+}
+
+template<typename T, typename AccessPolicy>
+void MmapVector<T, AccessPolicy>::reserve(size_t capacity) requires (!IsReadOnly)
+{
+    if (capacity <= m_capacity) return;
+
+    ensure_open();
+    if (::ftruncate(m_fd, static_cast<off_t>(capacity * sizeof(T))) != 0) throw_errno("ftruncate()");
+    remap(capacity);
+}
+
+template<typename T, typename AccessPolicy>
+void MmapVector<T, AccessPolicy>::push_back(const Record& val) requires (!IsReadOnly)
+{
+    ensure_open();
+
+    if (m_size == m_capacity)
+    {
+        constexpr size_t minGrowth = MinGrowthBytes / sizeof(T) + 1;
+        reserve(std::max(m_capacity * CapExtensionFactor, m_capacity + minGrowth));
+    }
+
+    m_data[m_size++] = val;
+}
+
+template<typename T, typename AccessPolicy>
+void MmapVector<T, AccessPolicy>::pop_back() requires (!IsReadOnly)
+{
+    if (empty()) return;
+
+    --m_size;
+}
+
+template<typename T, typename AccessPolicy>
+void MmapVector<T, AccessPolicy>::resize(size_t size, Record initialVal) requires (!IsReadOnly)
+{
+    if (size > m_size)
+    {
+        ensure_open();
+        reserve(size);
+        while (m_size < size)
+        {
+            m_data[m_size++] = initialVal;
+        }
+    }
+    else
+    {
+        m_size = size;
+    }
+}
+
+template<typename T, typename AccessPolicy>
+void MmapVector<T, AccessPolicy>::swap(MmapVector& other) noexcept
+{
+    std::swap(m_fd, other.m_fd);
+    std::swap(m_data, other.m_data);
+    std::swap(m_size, other.m_size);
+    std::swap(m_capacity, other.m_capacity);
+}
+
+template<typename T, typename AccessPolicy>
+void MmapVector<T, AccessPolicy>::sync(bool async) const
+{
+    if (!m_data) return;
+
+    if (::msync(m_data, m_capacity * sizeof(T), async ? MS_ASYNC : MS_SYNC) != 0) throw_errno("msync()");
+}
+
+template<typename T, typename AccessPolicy>
+void MmapVector<T, AccessPolicy>::advise(Advice advice) const
+{
+    if (!m_data) return;
+
+    if (::madvise(m_data, m_capacity * sizeof(T), static_cast<int>(advice)) != 0) throw_errno("madvise()");
+}
+
+template<typename T, typename AccessPolicy>
+void MmapVector<T, AccessPolicy>::close()
+{
+    if (m_fd < 0) return;
+
+    if (m_data)
+    {
+        ::munmap(m_data, m_capacity * sizeof(T));
+        m_data = nullptr;
+    }
+
+    // Cut off the slack reserved by growth
+    const bool truncateFailed = !IsReadOnly && m_capacity != m_size
+        && ::ftruncate(m_fd, static_cast<off_t>(m_size * sizeof(T))) != 0;
+    const auto err = errno;
+
+    ::close(m_fd);
+    m_fd = -1;
+    m_size = 0;
+    m_capacity = 0;
+
+    if (truncateFailed) throw std::system_error(err, std::generic_category(), "ftruncate()");
+}
+
+template<typename T, typename AccessPolicy>
+void MmapVector<T, AccessPolicy>::remap(size_t newCapacity)
+{
+    // Zero-length mappings are not allowed
+    void* addr = nullptr;
+    if (newCapacity > 0)
+    {
+        const int prot = IsReadOnly ? PROT_READ : (PROT_READ | PROT_WRITE);
+        addr = ::mmap(nullptr, newCapacity * sizeof(T), prot, MAP_SHARED, m_fd, 0);
+        if (addr == MAP_FAILED) throw_errno("mmap()");
+    }
+
+    // Old mapping is released only when the new one succeeded, both view the same file
+    if (m_data)
+    {
+        ::munmap(m_data, m_capacity * sizeof(T));
+    }
+
+    m_data = static_cast<Record*>(addr);
+    m_capacity = newCapacity;
+}
+
+template<typename T, typename AccessPolicy>
+void MmapVector<T, AccessPolicy>::ensure_open() const
+{
+    if (m_fd < 0) throw std::logic_error("MmapVector is closed");
+}
+
+} // namespace AlgoStruct
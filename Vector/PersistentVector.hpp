@@ -0,0 +1,581 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace AlgoStruct
+{
+// Immutable vector with structural sharing (bit-partitioned 32-way trie + tail)
+//
+//   size = 70, shift = 5
+//
+//                      root
+//                 [ * | * | - ... ]
+//                   |   |
+//            +------+   +------+
+//            |                 |
+//      [e0 .. e31]       [e32 .. e63]          tail: [e64 .. e69]
+//
+// Every modification copies only the path from the root to the touched leaf (O(log32 n)),
+// all other nodes are shared with the previous version. Copying a vector (snapshot) is O(1).
+// Appends go to the tail leaf and reach the trie only once per 32 elements.
+//
+// Transient is a mutable builder for batch updates: nodes it has already copied are
+// updated in place instead of being copied again on every operation.
+template<typename T>
+class PersistentVector
+{
+    static constexpr size_t Bits = 5;
+    static constexpr size_t Width = size_t{1} << Bits;
+    static constexpr size_t Mask = Width - 1;
+
+    // Id of the transient owning a node, nodes with Persistent id are never mutated
+    using EditId = uint64_t;
+    static constexpr EditId Persistent = 0;
+
+    struct Node
+    {
+        explicit Node(EditId e): edit(e) {}
+        EditId edit = Persistent;
+    };
+
+    struct Branch : Node
+    {
+        using Node::Node;
+        std::array<std::shared_ptr<Node>, Width> children;
+    };
+
+    struct Leaf : Node
+    {
+        using Node::Node;
+        std::array<T, Width> values;
+    };
+
+    using BranchPtr = std::shared_ptr<Branch>;
+    using LeafPtr = std::shared_ptr<Leaf>;
+
+    struct Trie
+    {
+        size_t size = 0;
+        size_t shift = Bits;
+        // Empty vectors share immutable empty nodes, so default construction doesn't allocate
+        BranchPtr root = empty_node<Branch>();
+        LeafPtr tail = empty_node<Leaf>();
+
+        size_t tail_offset() const { return size < Width ? 0 : ((size - 1) >> Bits) << Bits; }
+        const Leaf& leaf_for(size_t idx) const;
+        LeafPtr trie_leaf_for(size_t idx) const;
+
+        void push_back(T val, EditId edit);
+        void set(size_t idx, T val, EditId edit);
+        void pop_back(EditId edit);
+
+    private:
+        template<typename NodeType>
+        static const std::shared_ptr<NodeType>& empty_node()
+        {
+            static const auto node = std::make_shared<NodeType>(Persistent);
+            return node;
+        }
+
+        template<typename NodeType>
+        static std::shared_ptr<NodeType> editable(const std::shared_ptr<NodeType>& node, EditId edit);
+
+        // Same as editable(), but avoids refcount traffic when the node is already owned
+        template<typename NodeType>
+        static void make_editable(std::shared_ptr<NodeType>& node, EditId edit)
+        {
+            if (edit == Persistent || node->edit != edit)
+            {
+                node = editable(node, edit);
+            }
+        }
+
+        BranchPtr push_tail(size_t level, const BranchPtr& parent, LeafPtr tailNode, EditId edit);
+        std::shared_ptr<Node> new_path(size_t level, std::shared_ptr<Node> node, EditId edit);
+        std::shared_ptr<Node> do_set(size_t level, const std::shared_ptr<Node>& node, size_t idx, T&& val, EditId edit);
+        BranchPtr pop_tail(size_t level, const BranchPtr& node, EditId edit);
+    };
+
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using pointer = const T*;
+        using reference = const T&;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        Iterator(const Trie* trie, size_t idx): m_trie(trie), m_idx(idx) {}
+
+        reference operator* () const { return leaf().values[m_idx & Mask]; }
+        pointer operator-> () const { return &**this; }
+        reference operator[] (difference_type n) const { return *(*this + n); }
+
+        Iterator& operator++ () { ++m_idx; return *this; }
+        Iterator operator++ (int)
+        {
+            auto ret = *this;
+            ++(*this);
+            return ret;
+        }
+        Iterator& operator-- () { --m_idx; return *this; }
+        Iterator operator-- (int)
+        {
+            auto ret = *this;
+            --(*this);
+            return ret;
+        }
+
+        Iterator& operator+= (difference_type n)
+        {
+            m_idx += n;
+            return *this;
+        }
+        Iterator& operator-= (difference_type n)
+        {
+            m_idx -= n;
+            return *this;
+        }
+        friend Iterator operator+ (Iterator it, difference_type n) { return it += n; }
+        friend Iterator operator+ (difference_type n, Iterator it) { return it += n; }
+        friend Iterator operator- (Iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator- (const Iterator& lhs, const Iterator& rhs)
+        {
+            return static_cast<difference_type>(lhs.m_idx) - static_cast<difference_type>(rhs.m_idx);
+        }
+
+        friend bool operator== (const Iterator& lhs, const Iterator& rhs) { return lhs.m_idx == rhs.m_idx; }
+        friend bool operator!= (const Iterator& lhs, const Iterator& rhs) { return !(lhs == rhs); }
+        friend bool operator< (const Iterator& lhs, const Iterator& rhs) { return lhs.m_idx < rhs.m_idx; }
+        friend bool operator> (const Iterator& lhs, const Iterator& rhs) { return rhs < lhs; }
+        friend bool operator<= (const Iterator& lhs, const Iterator& rhs) { return !(lhs > rhs); }
+        friend bool operator>= (const Iterator& lhs, const Iterator& rhs) { return !(lhs < rhs); }
+
+    private:
+        // Caches the current leaf, so sequential traversal descends the trie once per 32 elements
+        const Leaf& leaf() const
+        {
+            const size_t base = m_idx & ~Mask;
+            if (!m_leaf || base != m_leafBase)
+            {
+                m_leaf = &m_trie->leaf_for(m_idx);
+                m_leafBase = base;
+            }
+            return *m_leaf;
+        }
+
+    private:
+        const Trie* m_trie = nullptr;
+        size_t m_idx = 0;
+        mutable const Leaf* m_leaf = nullptr;
+        mutable size_t m_leafBase = 0;
+    };
+
+    class Transient;
+
+    using value_type = T;
+    using size_type = size_t;
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+
+    PersistentVector() = default;
+    PersistentVector(std::initializer_list<T> init);
+
+    // Element access
+    const T& operator[] (size_t idx) const { return m_trie.leaf_for(idx).values[idx & Mask]; }
+    const T& at(size_t idx) const;
+    const T& front() const;
+    const T& back() const;
+
+    // Iterators
+    iterator begin() const noexcept { return iterator(&m_trie, 0); }
+    iterator end() const noexcept { return iterator(&m_trie, m_trie.size); }
+
+    // Capacity
+    size_t size() const noexcept { return m_trie.size; }
+    bool empty() const noexcept { return m_trie.size == 0; }
+
+    // Modifiers: return a new version, the current one stays unchanged
+    [[nodiscard]] PersistentVector push_back(T val) const;
+    [[nodiscard]] PersistentVector set(size_t idx, T val) const;
+    [[nodiscard]] PersistentVector pop_back() const;
+
+    // Starts batch modification sharing all nodes with this version
+    [[nodiscard]] Transient transient() const { return Transient(m_trie); }
+
+private:
+    explicit PersistentVector(Trie trie): m_trie(std::move(trie)) {}
+
+    static EditId next_edit_id()
+    {
+        static std::atomic<EditId> lastId{Persistent};
+        return lastId.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+private:
+    Trie m_trie;
+};
+
+template<typename T>
+class PersistentVector<T>::Transient
+{
+public:
+    // Move-only: copies would share the nodes owned by the edit and mutate them in place.
+    // A moved-from transient is empty and can't be modified, as after persistent()
+    Transient(const Transient&) = delete;
+    Transient& operator= (const Transient&) = delete;
+
+    Transient(Transient&& other) noexcept
+        : m_trie(std::exchange(other.m_trie, Trie{}))
+        , m_edit(std::exchange(other.m_edit, Persistent))
+    {}
+
+    Transient& operator= (Transient&& other) noexcept
+    {
+        m_trie = std::exchange(other.m_trie, Trie{});
+        m_edit = std::exchange(other.m_edit, Persistent);
+        return *this;
+    }
+
+    // Element access
+    const T& operator[] (size_t idx) const { return m_trie.leaf_for(idx).values[idx & Mask]; }
+    size_t size() const noexcept { return m_trie.size; }
+    bool empty() const noexcept { return m_trie.size == 0; }
+
+    // In-place modifiers
+    void push_back(T val);
+    void set(size_t idx, T val);
+    void pop_back();
+
+    // Finishes the batch. Transient is empty and can't be modified afterwards
+    PersistentVector persistent();
+
+private:
+    friend PersistentVector;
+
+    explicit Transient(const Trie& trie): m_trie(trie), m_edit(next_edit_id()) {}
+
+    void ensure_editable() const
+    {
+        if (m_edit == Persistent) throw std::logic_error("Transient modified after persistent()");
+    }
+
+private:
+    Trie m_trie;
+    EditId m_edit = Persistent;
+};
+
+template<typename T>
+PersistentVector<T>::PersistentVector(std::initializer_list<T> init)
+{
+    auto builder = transient();
+    for (const auto& elem : init)
+    {
+        builder.push_back(elem);
+    }
+    *this = builder.persistent();
+}
+
+template<typename T>
+const T& PersistentVector<T>::at(size_t idx) const
+{
+    if (idx >= size()) throw std::out_of_range("at() index out of PersistentVector range");
+    return (*this)[idx];
+}
+
+template<typename T>
+const T& PersistentVector<T>::front() const
+{
+    if (empty()) throw std::invalid_argument("front() on empty PersistentVector");
+    return (*this)[0];
+}
+
+template<typename T>
+const T& PersistentVector<T>::back() const
+{
+    if (empty()) throw std::invalid_argument("back() on empty PersistentVector");
+    return (*this)[size() - 1];
+}
+
+template<typename T>
+auto PersistentVector<T>::push_back(T val) const -> PersistentVector
+{
+    Trie trie = m_trie;
+    trie.push_back(std::move(val), Persistent);
+    return PersistentVector(std::move(trie));
+}
+
+template<typename T>
+auto PersistentVector<T>::set(size_t idx, T val) const -> PersistentVector
+{
+    if (idx >= size()) throw std::out_of_range("set() index out of PersistentVector range");
+
+    Trie trie = m_trie;
+    trie.set(idx, std::move(val), Persistent);
+    return PersistentVector(std::move(trie));
+}
+
+template<typename T>
+auto PersistentVector<T>::pop_back() const -> PersistentVector
+{
+    if (empty()) throw std::invalid_argument("pop_back() on empty PersistentVector");
+
+    Trie trie = m_trie;
+    trie.pop_back(Persistent);
+    return PersistentVector(std::move(trie));
+}
+
+template<typename T>
+void PersistentVector<T>::Transient::push_back(T val)
+{
+    ensure_editable();
+    m_trie.push_back(std::move(val), m_edit);
+}
+
+template<typename T>
+void PersistentVector<T>::Transient::set(size_t idx, T val)
+{
+    ensure_editable();
+    if (idx >= size()) throw std::out_of_range("set() index out of PersistentVector range");
+
+    m_trie.set(idx, std::move(val), m_edit);
+}
+
+template<typename T>
+void PersistentVector<T>::Transient::pop_back()
+{
+    ensure_editable();
+    if (empty()) throw std::invalid_argument("pop_back() on empty PersistentVector");
+
+    m_trie.pop_back(m_edit);
+}
+
+template<typename T>
+auto PersistentVector<T>::Transient::persistent() -> PersistentVector
+{
+    ensure_editable();
+    // Nodes stamped with the retired id are never mutated again, i.e. become persistent
+    m_edit = Persistent;
+    return PersistentVector(std::exchange(m_trie, Trie{}));
+}
+
+template<typename T>
+auto PersistentVector<T>::Trie::leaf_for(size_t idx) const -> const Leaf&
+{
+    if (idx >= tail_offset())
+    {
+        return *tail;
+    }
+
+    const Node* node = root.get();
+    for (size_t level = shift; level > 0; level -= Bits)
+    {
+        node = static_cast<const Branch*>(node)->children[(idx >> level) & Mask].get();
+    }
+
+    return *static_cast<const Leaf*>(node);
+}
+
+template<typename T>
+auto PersistentVector<T>::Trie::trie_leaf_for(size_t idx) const -> LeafPtr
+{
+    const Branch* branch = root.get();
+    for (size_t level = shift; level > Bits; level -= Bits)
+    {
+        branch = static_cast<const Branch*>(branch->children[(idx >> level) & Mask].get());
+    }
+
+    return std::static_pointer_cast<Leaf>(branch->children[(idx >> Bits) & Mask]);
+}
+
+template<typename T>
+template<typename NodeType>
+auto PersistentVector<T>::Trie::editable(const std::shared_ptr<NodeType>& node, EditId edit) -> std::shared_ptr<NodeType>
+{
+    if (edit != Persistent && node->edit == edit)
+    {
+        return node;
+    }
+
+    auto copy = std::make_shared<NodeType>(*node);
+    copy->edit = edit;
+    return copy;
+}
+
+template<typename T>
+void PersistentVector<T>::Trie::push_back(T val, EditId edit)
+{
+    // Room in tail?
+    if (size - tail_offset() < Width)
+    {
+        make_editable(tail, edit);
+        tail->values[size & Mask] = std::move(val);
+        ++size;
+        return;
+    }
+
+    // Full tail is pushed into the trie
+    BranchPtr newRoot;
+    if ((size >> Bits) > (size_t{1} << shift))
+    {
+        // Root overflow: grow the trie by one level
+        newRoot = std::make_shared<Branch>(edit);
+        newRoot->children[0] = root;
+        newRoot->children[1] = new_path(shift, tail, edit);
+        shift += Bits;
+    }
+    else
+    {
+        newRoot = push_tail(shift, root, tail, edit);
+    }
+
+    root = std::move(newRoot);
+    tail = std::make_shared<Leaf>(edit);
+    tail->values[0] = std::move(val);
+    ++size;
+}
+
+template<typename T>
+auto PersistentVector<T>::Trie::push_tail(size_t level, const BranchPtr& parent, LeafPtr tailNode, EditId edit) -> BranchPtr
+{
+    auto ret = editable(parent, edit);
+    const size_t subIdx = ((size - 1) >> level) & Mask;
+
+    std::shared_ptr<Node> nodeToInsert;
+    if (level == Bits)
+    {
+        nodeToInsert = std::move(tailNode);
+    }
+    else if (const auto& child = parent->children[subIdx])
+    {
+        nodeToInsert = push_tail(level - Bits, std::static_pointer_cast<Branch>(child), std::move(tailNode), edit);
+    }
+    else
+    {
+        nodeToInsert = new_path(level - Bits, std::move(tailNode), edit);
+    }
+
+    ret->children[subIdx] = std::move(nodeToInsert);
+    return ret;
+}
+
+template<typename T>
+auto PersistentVector<T>::Trie::new_path(size_t level, std::shared_ptr<Node> node, EditId edit) -> std::shared_ptr<Node>
+{
+    if (level == 0)
+    {
+        return node;
+    }
+
+    auto ret = std::make_shared<Branch>(edit);
+    ret->children[0] = new_path(level - Bits, std::move(node), edit);
+    return ret;
+}
+
+template<typename T>
+void PersistentVector<T>::Trie::set(size_t idx, T val, EditId edit)
+{
+    if (idx >= tail_offset())
+    {
+        make_editable(tail, edit);
+        tail->values[idx & Mask] = std::move(val);
+        return;
+    }
+
+    root = std::static_pointer_cast<Branch>(do_set(shift, root, idx, std::move(val), edit));
+}
+
+template<typename T>
+auto PersistentVector<T>::Trie::do_set(size_t level, const std::shared_ptr<Node>& node, size_t idx, T&& val, EditId edit) -> std::shared_ptr<Node>
+{
+    if (level == 0)
+    {
+        auto leaf = editable(std::static_pointer_cast<Leaf>(node), edit);
+        leaf->values[idx & Mask] = std::move(val);
+        return leaf;
+    }
+
+    auto branch = editable(std::static_pointer_cast<Branch>(node), edit);
+    const size_t subIdx = (idx >> level) & Mask;
+    branch->children[subIdx] = do_set(level - Bits, branch->children[subIdx], idx, std::move(val), edit);
+    return branch;
+}
+
+template<typename T>
+void PersistentVector<T>::Trie::pop_back(EditId edit)
+{
+    if (size == 1)
+    {
+        *this = Trie{};
+        return;
+    }
+
+    if (size - tail_offset() > 1)
+    {
+        make_editable(tail, edit);
+        // Release resources held by the removed element
+        tail->values[(size - 1) & Mask] = T{};
+        --size;
+        return;
+    }
+
+    // Tail becomes empty: the last leaf of the trie is promoted to tail
+    auto newTail = trie_leaf_for(size - 2);
+    auto newRoot = pop_tail(shift, root, edit);
+
+    if (!newRoot)
+    {
+        newRoot = std::make_shared<Branch>(edit);
+    }
+
+    if (shift > Bits && !newRoot->children[1])
+    {
+        // Root has a single child: shrink the trie by one level
+        newRoot = std::static_pointer_cast<Branch>(newRoot->children[0]);
+        shift -= Bits;
+    }
+
+    root = std::move(newRoot);
+    tail = std::move(newTail);
+    --size;
+}
+
+template<typename T>
+auto PersistentVector<T>::Trie::pop_tail(size_t level, const BranchPtr& node, EditId edit) -> BranchPtr
+{
+    const size_t subIdx = ((size - 2) >> level) & Mask;
+
+    if (level > Bits)
+    {
+        auto newChild = pop_tail(level - Bits, std::static_pointer_cast<Branch>(node->children[subIdx]), edit);
+        if (!newChild && subIdx == 0)
+        {
+            return nullptr;
+        }
+
+        auto ret = editable(node, edit);
+        ret->children[subIdx] = std::move(newChild);
+        return ret;
+    }
+
+    if (subIdx == 0)
+    {
+        return nullptr;
+    }
+
+    auto ret = editable(node, edit);
+    ret->children[subIdx] = nullptr;
+    return ret;
+}
+
+} // namespace AlgoStruct
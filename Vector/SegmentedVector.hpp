@@ -0,0 +1,394 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace AlgoStruct
+{
+// Vector storing elements in geometrically growing blocks that are never relocated:
+// pointers and references to elements stay valid until the element is removed.
+//
+//   FirstBlockSize = 4
+//
+//   block 0: [e0  e1  e2  e3]
+//   block 1: [e4  e5  ...  e11]                 8 elements
+//   block 2: [e12 e13 ...  e27]                16 elements
+//
+// Block of element i is found with bit arithmetics: with j = i + FirstBlockSize,
+// block = msb(j) - log2(FirstBlockSize), offset = j - 2^msb(j). push_back() is O(1)
+// (no copying on growth), random access is O(1).
+template<typename T, size_t FirstBlockSize = 16>
+class SegmentedVector
+{
+    static_assert(std::has_single_bit(FirstBlockSize), "FirstBlockSize must be a power of two");
+
+    static constexpr size_t FirstBlockBits = std::countr_zero(FirstBlockSize);
+    static constexpr size_t MaxBlocks = sizeof(size_t) * 8 - FirstBlockBits;
+
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using pointer = T*;
+        using reference = T&;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        Iterator(const SegmentedVector* container, size_t idx): m_container(container), m_idx(idx) {}
+
+        reference operator* () const { return (*m_container)[m_idx]; }
+        pointer operator-> () const { return &(*m_container)[m_idx]; }
+        reference operator[] (difference_type n) const { return (*m_container)[m_idx + n]; }
+
+        Iterator& operator++ ()
+        {
+            ++m_idx;
+            return *this;
+        }
+        Iterator operator++ (int)
+        {
+            auto ret = *this;
+            ++(*this);
+            return ret;
+        }
+        Iterator& operator-- ()
+        {
+            --m_idx;
+            return *this;
+        }
+        Iterator operator-- (int)
+        {
+            auto ret = *this;
+            --(*this);
+            return ret;
+        }
+
+        Iterator& operator+= (difference_type n)
+        {
+            m_idx += n;
+            return *this;
+        }
+        Iterator& operator-= (difference_type n)
+        {
+            m_idx -= n;
+            return *this;
+        }
+        friend Iterator operator+ (Iterator it, difference_type n) { return it += n; }
+        friend Iterator operator+ (difference_type n, Iterator it) { return it += n; }
+        friend Iterator operator- (Iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator- (const Iterator& lhs, const Iterator& rhs)
+        {
+            return static_cast<difference_type>(lhs.m_idx) - static_cast<difference_type>(rhs.m_idx);
+        }
+
+        friend bool operator== (const Iterator& lhs, const Iterator& rhs) { return lhs.m_idx == rhs.m_idx; }
+        friend bool operator!= (const Iterator& lhs, const Iterator& rhs) { return !(lhs == rhs); }
+        friend bool operator< (const Iterator& lhs, const Iterator& rhs) { return lhs.m_idx < rhs.m_idx; }
+        friend bool operator> (const Iterator& lhs, const Iterator& rhs) { return rhs < lhs; }
+        friend bool operator<= (const Iterator& lhs, const Iterator& rhs) { return !(lhs > rhs); }
+        friend bool operator>= (const Iterator& lhs, const Iterator& rhs) { return !(lhs < rhs); }
+
+    private:
+        const SegmentedVector* m_container = nullptr;
+        size_t m_idx = 0;
+    };
+
+    using value_type = T;
+    using size_type = size_t;
+    using iterator = Iterator;
+
+    SegmentedVector() = default;
+    SegmentedVector(std::initializer_list<T> init);
+    ~SegmentedVector();
+
+    SegmentedVector(const SegmentedVector& other);
+    SegmentedVector& operator= (const SegmentedVector& other);
+    SegmentedVector(SegmentedVector&& other) noexcept;
+    SegmentedVector& operator= (SegmentedVector&& other) noexcept;
+
+    // Element access
+    T& operator[] (size_t idx) const
+    {
+        const auto [block, offset] = locate(idx);
+        return m_blocks[block][offset];
+    }
+    T& at(size_t idx) const;
+    T& front() const;
+    T& back() const;
+
+    // Iterators
+    iterator begin() const noexcept { return iterator(this, 0); }
+    iterator end() const noexcept { return iterator(this, m_size); }
+
+    // Capacity
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+    size_t capacity() const noexcept { return block_offset(m_blockCount); }
+    void reserve(size_t capacity);
+
+    // Modifiers
+    void push_back(const T& val) { emplace_back(val); }
+    void push_back(T&& val) { emplace_back(std::move(val)); }
+    template<typename... Args>
+    T& emplace_back(Args&&... args);
+    void pop_back();
+    void clear() noexcept;
+    void swap(SegmentedVector& other) noexcept;
+
+    // Block access: each block is a contiguous span of constructed elements
+    size_t block_count() const noexcept { return m_size == 0 ? 0 : locate(m_size - 1).first + 1; }
+    std::span<T> block(size_t blockIdx) const;
+
+    template<typename Func>
+    void for_each_block(Func func) const;
+
+    // Splits elements into equal ranges processed by separate threads, block by block.
+    // Func is called as func(T&) and must be safe to run concurrently for different elements
+    template<typename Func>
+    void parallel_for_each(Func func, size_t threadCount = std::thread::hardware_concurrency()) const;
+
+private:
+    static constexpr size_t block_size(size_t blockIdx) { return FirstBlockSize << blockIdx; }
+    // Index of the first element of the block
+    static constexpr size_t block_offset(size_t blockIdx) { return FirstBlockSize * ((size_t{1} << blockIdx) - 1); }
+
+    static std::pair<size_t, size_t> locate(size_t idx) noexcept
+    {
+        const size_t j = idx + FirstBlockSize;
+        const size_t msb = std::bit_width(j) - 1;
+        return {msb - FirstBlockBits, j - (size_t{1} << msb)};
+    }
+
+    static T* allocate_block(size_t blockIdx)
+    {
+        return static_cast<T*>(::operator new(block_size(blockIdx) * sizeof(T), std::align_val_t{alignof(T)}));
+    }
+
+    static void deallocate_block(T* block) noexcept
+    {
+        ::operator delete(block, std::align_val_t{alignof(T)});
+    }
+
+    template<typename Func>
+    void for_each_in_range(size_t first, size_t last, Func& func) const;
+
+private:
+    std::array<T*, MaxBlocks> m_blocks{};
+    size_t m_blockCount = 0;    // Allocated blocks
+    size_t m_size = 0;
+};
+
+template<typename T, size_t FirstBlockSize>
+SegmentedVector<T, FirstBlockSize>::SegmentedVector(std::initializer_list<T> init)
+    : SegmentedVector()
+{
+    // Delegated construction is complete: destructor frees blocks if a copy throws
+    reserve(init.size());
+    for (const auto& elem : init)
+    {
+        emplace_back(elem);
+    }
+}
+
+template<typename T, size_t FirstBlockSize>
+SegmentedVector<T, FirstBlockSize>::~SegmentedVector()
+{
+    clear();
+    for (size_t i = 0; i < m_blockCount; ++i)
+    {
+        deallocate_block(m_blocks[i]);
+    }
+}
+
+template<typename T, size_t FirstBlockSize>
+SegmentedVector<T, FirstBlockSize>::SegmentedVector(const SegmentedVector& other)
+    : SegmentedVector()
+{
+    reserve(other.m_size);
+    other.for_each_block([this](std::span<T> block)
+    {
+        for (const auto& elem : block)
+        {
+            emplace_back(elem);
+        }
+    });
+}
+
+template<typename T, size_t FirstBlockSize>
+SegmentedVector<T, FirstBlockSize>& SegmentedVector<T, FirstBlockSize>::operator= (const SegmentedVector& other)
+{
+    if (this != &other)
+    {
+        SegmentedVector tmp(other);
+        this->swap(tmp);
+    }
+    return *this;
+}
+
+template<typename T, size_t FirstBlockSize>
+SegmentedVector<T, FirstBlockSize>::SegmentedVector(SegmentedVector&& other) noexcept
+{
+    this->swap(other);
+}
+
+template<typename T, size_t FirstBlockSize>
+SegmentedVector<T, FirstBlockSize>& SegmentedVector<T, FirstBlockSize>::operator= (SegmentedVector&& other) noexcept
+{
+    SegmentedVector tmp(std::move(other));
+    this->swap(tmp);
+    return *this;
+}
+
+template<typename T, size_t FirstBlockSize>
+T& SegmentedVector<T, FirstBlockSize>::at(size_t idx) const
+{
+    if (idx >= m_size) throw std::out_of_range("at() index out of SegmentedVector range");
+    return (*this)[idx];
+}
+
+template<typename T, size_t FirstBlockSize>
+T& SegmentedVector<T, FirstBlockSize>::front() const
+{
+    if (empty()) throw std::invalid_argument("front() on empty SegmentedVector");
+    return *m_blocks[0];
+}
+
+template<typename T, size_t FirstBlockSize>
+T& SegmentedVector<T, FirstBlockSize>::back() const
+{
+    if (empty()) throw std::invalid_argument("back() on empty SegmentedVector");
+    return (*this)[m_size - 1];
+}
+
+template<typename T, size_t FirstBlockSize>
+void SegmentedVector<T, FirstBlockSize>::reserve(size_t capacity)
+{
+    while (this->capacity() < capacity)
+    {
+        m_blocks[m_blockCount] = allocate_block(m_blockCount);
+        ++m_blockCount;
+    }
+}
+
+template<typename T, size_t FirstBlockSize>
+template<typename... Args>
+T& SegmentedVector<T, FirstBlockSize>::emplace_back(Args&&... args)
+{
+    const auto [block, offset] = locate(m_size);
+    if (block == m_blockCount)
+    {
+        // Only a new block is allocated, existing elements stay in place
+        m_blocks[m_blockCount] = allocate_block(m_blockCount);
+        ++m_blockCount;
+    }
+
+    T* elem = new (m_blocks[block] + offset) T(std::forward<Args>(args)...);
+    ++m_size;
+    return *elem;
+}
+
+template<typename T, size_t FirstBlockSize>
+void SegmentedVector<T, FirstBlockSize>::pop_back()
+{
+    if (empty()) return;
+
+    (*this)[m_size - 1].~T();
+    --m_size;
+}
+
+template<typename T, size_t FirstBlockSize>
+void SegmentedVector<T, FirstBlockSize>::clear() noexcept
+{
+    // Blocks are kept for reuse
+    for_each_block([](std::span<T> block)
+    {
+        std::destroy(block.begin(), block.end());
+    });
+    m_size = 0;
+}
+
+template<typename T, size_t FirstBlockSize>
+void SegmentedVector<T, FirstBlockSize>::swap(SegmentedVector& other) noexcept
+{
+    std::swap(m_blocks, other.m_blocks);
+    std::swap(m_blockCount, other.m_blockCount);
+    std::swap(m_size, other.m_size);
+}
+
+template<typename T, size_t FirstBlockSize>
+std::span<T> SegmentedVector<T, FirstBlockSize>::block(size_t blockIdx) const
+{
+    if (blockIdx >= block_count()) throw std::out_of_range("block() index out of SegmentedVector range");
+
+    const size_t used = std::min(block_size(blockIdx), m_size - block_offset(blockIdx));
+    return {m_blocks[blockIdx], used};
+}
+
+template<typename T, size_t FirstBlockSize>
+template<typename Func>
+void SegmentedVector<T, FirstBlockSize>::for_each_block(Func func) const
+{
+    const size_t count = block_count();
+    for (size_t i = 0; i < count; ++i)
+    {
+        func(block(i));
+    }
+}
+
+template<typename T, size_t FirstBlockSize>
+template<typename Func>
+void SegmentedVector<T, FirstBlockSize>::for_each_in_range(size_t first, size_t last, Func& func) const
+{
+    while (first < last)
+    {
+        const auto [blockIdx, offset] = locate(first);
+        const size_t count = std::min(block_size(blockIdx) - offset, last - first);
+
+        T* blockPtr = m_blocks[blockIdx] + offset;
+        for (size_t i = 0; i < count; ++i)
+        {
+            func(blockPtr[i]);
+        }
+        first += count;
+    }
+}
+
+template<typename T, size_t FirstBlockSize>
+template<typename Func>
+void SegmentedVector<T, FirstBlockSize>::parallel_for_each(Func func, size_t threadCount) const
+{
+    threadCount = std::clamp<size_t>(threadCount, 1, std::max<size_t>(m_size, 1));
+    const size_t chunkSize = (m_size + threadCount - 1) / threadCount;
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount - 1);
+    for (size_t t = 1; t < threadCount; ++t)
+    {
+        const size_t first = std::min(t * chunkSize, m_size);
+        const size_t last = std::min(first + chunkSize, m_size);
+        workers.emplace_back([this, first, last, &func] { for_each_in_range(first, last, func); });
+    }
+
+    // The calling thread processes the first chunk
+    for_each_in_range(0, std::min(chunkSize, m_size), func);
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+} // namespace AlgoStruct
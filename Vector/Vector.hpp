@@ -4,15 +4,38 @@
 #include <iterator>
 #include <stdexcept>
 #include <cstring>
+#include <type_traits>
 
 namespace AlgoStruct 
 {
-template<typename T>
+// Element access checking policies:
+//   CheckedAccess   - operator[], front(), back() and iterators validate bounds,
+//                     iterators detect buffer reallocation (invalidation)
+//   UncheckedAccess - no checks at all, iterator is a plain pointer wrapper
+// at() is always checked. Debug builds use CheckedAccess by default, release (NDEBUG) - UncheckedAccess.
+struct CheckedAccess { static constexpr bool enabled = true; };
+struct UncheckedAccess { static constexpr bool enabled = false; };
+
+#ifdef NDEBUG
+using DefaultAccessPolicy = UncheckedAccess;
+#else
+using DefaultAccessPolicy = CheckedAccess;
+#endif
+
+template<typename T, typename AccessPolicy = DefaultAccessPolicy>
 class Vector
 {
+    static constexpr bool IsChecked = AccessPolicy::enabled;
+
+    struct Generation { size_t value = 0; };
+    struct NoGeneration {};
+
 public:
     class Iterator
     {
+        struct Owner { const Vector* vector = nullptr; size_t generation = 0; };
+        struct NoOwner {};
+
     public:
         using iterator_category = std::random_access_iterator_tag;
         using value_type = T;
@@ -23,7 +46,11 @@ public:
         // Base iterator operations
         Iterator() = default;
         Iterator(T* bufPtr): m_bufPtr(bufPtr) {}
-        reference operator* () const { return *m_bufPtr; }
+        reference operator* () const
+        {
+            check_dereferenceable(m_bufPtr);
+            return *m_bufPtr;
+        }
         Iterator& operator++ ()
         {
             ++m_bufPtr;
@@ -37,7 +64,11 @@ public:
         }
 
         // Input iterator operations
-        T* operator-> () const { return *m_bufPtr; }
+        T* operator-> () const
+        {
+            check_dereferenceable(m_bufPtr);
+            return m_bufPtr;
+        }
         friend bool operator== (const Iterator& lhs, const Iterator& rhs) { return lhs.m_bufPtr == rhs.m_bufPtr; }
         friend bool operator!= (const Iterator& lhs, const Iterator& rhs) { return !(lhs == rhs); }
 
@@ -71,14 +102,49 @@ public:
         friend Iterator operator- (Iterator it, difference_type n) { return it -= n; }
         friend difference_type operator- (const Iterator& lhs, const Iterator& rhs) { return lhs.m_bufPtr - rhs.m_bufPtr; }
 
-        reference operator[] (difference_type n) const { return *(m_bufPtr + n); }
+        reference operator[] (difference_type n) const
+        {
+            check_dereferenceable(m_bufPtr + n);
+            return *(m_bufPtr + n);
+        }
         friend bool operator< (const Iterator& lhs, const Iterator& rhs) { return lhs.m_bufPtr < rhs.m_bufPtr; }
         friend bool operator> (const Iterator& lhs, const Iterator& rhs) { return rhs < lhs; }
         friend bool operator<= (const Iterator& lhs, const Iterator& rhs) { return !(lhs > rhs); }
         friend bool operator>= (const Iterator& lhs, const Iterator& rhs) { return !(lhs < rhs); }
 
+    private:
+        friend Vector;
+
+        Iterator(T* bufPtr, const Vector* owner): m_bufPtr(bufPtr)
+        {
+            if constexpr (IsChecked)
+            {
+                m_owner = {owner, owner->m_generation.value};
+            }
+        }
+
+        void check_dereferenceable(const T* ptr) const
+        {
+            if constexpr (IsChecked)
+            {
+                // Iterators constructed from raw pointers have no owner to validate against
+                if (!m_owner.vector) return;
+
+                if (m_owner.generation != m_owner.vector->m_generation.value)
+                {
+                    throw std::logic_error("dereferencing invalidated Vector iterator");
+                }
+
+                if (ptr < m_owner.vector->m_buf || ptr >= m_owner.vector->m_buf + m_owner.vector->m_size)
+                {
+                    throw std::out_of_range("dereferencing Vector iterator out of range");
+                }
+            }
+        }
+
     private:
         T* m_bufPtr = nullptr;
+        [[no_unique_address]] std::conditional_t<IsChecked, Owner, NoOwner> m_owner;
     };
 
     using iterator = Iterator;
@@ -89,8 +155,8 @@ public:
     Vector(size_t size, T initialVal = T{});
     ~Vector();
 
-    // TODO: deep-copy semantics
-    Vector(const Vector& other);  
+    // Deep-copy semantics
+    Vector(const Vector& other);
     Vector& operator= (const Vector& other);
     // Movement semantics
     Vector(Vector&& other) noexcept;
@@ -99,11 +165,22 @@ public:
     // Element access
     T& front() const;
     T& back() const;
-    T& operator[] (size_t idx) { return *(m_buf + idx); }
+    T& at(size_t idx);
+    const T& at(size_t idx) const;
+    T& operator[] (size_t idx)
+    {
+        check_index(idx);
+        return *(m_buf + idx);
+    }
+    const T& operator[] (size_t idx) const
+    {
+        check_index(idx);
+        return *(m_buf + idx);
+    }
 
     // Iterators
-    iterator begin() const noexcept { return iterator(m_buf); }
-    iterator end() const noexcept { return iterator(m_buf + m_size); }
+    iterator begin() const noexcept { return iterator(m_buf, this); }
+    iterator end() const noexcept { return iterator(m_buf + m_size, this); }
     // reverse_terator rbegin() const noexcept { return reverse_terator(end()); }
     // reverse_terator rend() const noexcept { return reverse_terator(begin()); }
 
@@ -122,17 +199,21 @@ public:
 
 private:
     void reallocate_buffer(size_t newCapacity);
+    void invalidate_iterators() noexcept;
+    void check_index(size_t idx) const;
 
 private:
     friend iterator;
     T* m_buf = nullptr;
     size_t m_size = 0;
     size_t m_capacity = 0;
+    // Incremented on every buffer reallocation to detect stale iterators (CheckedAccess only)
+    [[no_unique_address]] std::conditional_t<IsChecked, Generation, NoGeneration> m_generation;
     static constexpr int CapExtensionFactor = 2;
 };
 
-template<typename T>
-Vector<T>::Vector(std::initializer_list<T> init)
+template<typename T, typename AccessPolicy>
+Vector<T, AccessPolicy>::Vector(std::initializer_list<T> init)
 {
     this->reserve(init.size());
     for (const auto& elem : init)
@@ -141,40 +222,50 @@ Vector<T>::Vector(std::initializer_list<T> init)
     }
 }
 
-template<typename T>
-Vector<T>::Vector(size_t size, T initialVal)
+template<typename T, typename AccessPolicy>
+Vector<T, AccessPolicy>::Vector(size_t size, T initialVal)
 {
     this->resize(size, initialVal);
 }
 
-template<typename T>
-Vector<T>::Vector(const Vector& other)
+template<typename T, typename AccessPolicy>
+Vector<T, AccessPolicy>::Vector(const Vector& other)
 {
-
+    this->reserve(other.m_size);
+    for (size_t i = 0; i < other.m_size; ++i)
+    {
+        m_buf[i] = other.m_buf[i];
+    }
+    m_size = other.m_size;
 }
 
-template<typename T>
-Vector<T>::Vector(Vector&& other) noexcept
+template<typename T, typename AccessPolicy>
+Vector<T, AccessPolicy>::Vector(Vector&& other) noexcept
 {
     Vector tmp;
     this->swap(other);
     other.swap(tmp);
 }
 
-template<typename T>
-Vector<T>::~Vector()
+template<typename T, typename AccessPolicy>
+Vector<T, AccessPolicy>::~Vector()
 {
     this->clear();
 }
 
-template<typename T>
-Vector<T>& Vector<T>::operator= (const Vector<T>& other)
+template<typename T, typename AccessPolicy>
+Vector<T, AccessPolicy>& Vector<T, AccessPolicy>::operator= (const Vector& other)
 {
+    if (this != &other)
+    {
+        Vector tmp(other);
+        this->swap(tmp);
+    }
     return *this;
 }
 
-template<typename T>
-Vector<T>& Vector<T>::operator= (Vector<T>&& other) noexcept
+template<typename T, typename AccessPolicy>
+Vector<T, AccessPolicy>& Vector<T, AccessPolicy>::operator= (Vector&& other) noexcept
 {
     Vector tmp;
     this->swap(other);
@@ -182,38 +273,78 @@ Vector<T>& Vector<T>::operator= (Vector<T>&& other) noexcept
     return *this;
 }
 
-template<typename T>
-T& Vector<T>::front() const
+template<typename T, typename AccessPolicy>
+T& Vector<T, AccessPolicy>::front() const
 {
-    if (empty()) throw std::invalid_argument("front() on empty Vector");
+    if constexpr (IsChecked)
+    {
+        if (empty()) throw std::invalid_argument("front() on empty Vector");
+    }
     return *m_buf;
 }
 
-template<typename T>
-T& Vector<T>::back() const
+template<typename T, typename AccessPolicy>
+T& Vector<T, AccessPolicy>::back() const
 {
-    if (empty()) throw std::invalid_argument("back() on empty Vector");
+    if constexpr (IsChecked)
+    {
+        if (empty()) throw std::invalid_argument("back() on empty Vector");
+    }
     return *(m_buf + m_size - 1);
 }
 
-template<typename T>
-void Vector<T>::reserve(size_t capacity)
+template<typename T, typename AccessPolicy>
+T& Vector<T, AccessPolicy>::at(size_t idx)
+{
+    if (idx >= m_size) throw std::out_of_range("at() index out of Vector range");
+    return *(m_buf + idx);
+}
+
+template<typename T, typename AccessPolicy>
+const T& Vector<T, AccessPolicy>::at(size_t idx) const
+{
+    if (idx >= m_size) throw std::out_of_range("at() index out of Vector range");
+    return *(m_buf + idx);
+}
+
+template<typename T, typename AccessPolicy>
+void Vector<T, AccessPolicy>::check_index(size_t idx) const
+{
+    if constexpr (IsChecked)
+    {
+        if (idx >= m_size) throw std::out_of_range("operator[] index out of Vector range");
+    }
+}
+
+template<typename T, typename AccessPolicy>
+void Vector<T, AccessPolicy>::invalidate_iterators() noexcept
+{
+    if constexpr (IsChecked)
+    {
+        ++m_generation.value;
+    }
+}
+
+template<typename T, typename AccessPolicy>
+void Vector<T, AccessPolicy>::reserve(size_t capacity)
 {
     if (capacity <= m_capacity) return;
 
     reallocate_buffer(capacity);
 }
 
-template<typename T>
-void Vector<T>::clear()
+template<typename T, typename AccessPolicy>
+void Vector<T, AccessPolicy>::clear()
 {
     delete[] m_buf;
+    m_buf = nullptr;
     m_size = 0;
     m_capacity = 0;
+    invalidate_iterators();
 }
 
-template<typename T>
-void Vector<T>::reallocate_buffer(size_t newCapacity)
+template<typename T, typename AccessPolicy>
+void Vector<T, AccessPolicy>::reallocate_buffer(size_t newCapacity)
 {
     // Reallocate internal buffer
     m_capacity = newCapacity;
@@ -225,10 +356,11 @@ void Vector<T>::reallocate_buffer(size_t newCapacity)
 
     // Deallocate old storage
     delete[] newBuf;
+    invalidate_iterators();
 }
 
-template<typename T>
-void Vector<T>::push_back(const T& val)
+template<typename T, typename AccessPolicy>
+void Vector<T, AccessPolicy>::push_back(const T& val)
 {
     if (m_size == m_capacity)
     {
@@ -240,20 +372,21 @@ void Vector<T>::push_back(const T& val)
     m_buf[m_size++] = val;
 }
 
-template<typename T>
-void Vector<T>::pop_back()
+template<typename T, typename AccessPolicy>
+void Vector<T, AccessPolicy>::pop_back()
 {
     if (empty()) return;
 
     --m_size;
 }
 
-template<typename T>
-void Vector<T>::resize(size_t size, T initialVal)
+template<typename T, typename AccessPolicy>
+void Vector<T, AccessPolicy>::resize(size_t size, T initialVal)
 {
     if (size > m_size)
     {
-        for (auto i = 0; i < size - m_size; ++i)
+        this->reserve(size);
+        while (m_size < size)
         {
             this->push_back(initialVal);
         }
@@ -265,12 +398,15 @@ void Vector<T>::resize(size_t size, T initialVal)
     }
 }
 
-template<typename T>
-void Vector<T>::swap(Vector& other) noexcept
+template<typename T, typename AccessPolicy>
+void Vector<T, AccessPolicy>::swap(Vector& other) noexcept
 {
     std::swap(m_buf, other.m_buf);
     std::swap(m_size, other.m_size);
     std::swap(m_capacity, other.m_capacity);
+    // Checked iterators are bound to their owner, so they don't follow the swapped buffer
+    invalidate_iterators();
+    other.invalidate_iterators();
 }
 
 } // namespace AlgoStruct
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "Vector.hpp"
+#include "PersistentVector.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace AlgoStruct;
+
+// Readers need a stable view while the writer keeps updating:
+// each iteration takes a snapshot and modifies one element of the current version.
+
+static void BM_VectorCopyAndSet(benchmark::State& state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    Vector<int, UncheckedAccess> current(size, 0);
+    size_t idx = 0;
+
+    for (auto _ : state)
+    {
+        Vector<int, UncheckedAccess> snapshot(current);
+        benchmark::DoNotOptimize(snapshot.begin());
+
+        current[idx] = static_cast<int>(idx);
+        idx = (idx + 7919) % size;
+    }
+}
+BENCHMARK(BM_VectorCopyAndSet)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+
+static void BM_PersistentVectorSnapshotAndSet(benchmark::State& state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    auto builder = PersistentVector<int>().transient();
+    for (size_t i = 0; i < size; ++i)
+    {
+        builder.push_back(0);
+    }
+    auto current = builder.persistent();
+    size_t idx = 0;
+
+    for (auto _ : state)
+    {
+        const auto snapshot = current;
+        benchmark::DoNotOptimize(snapshot.size());
+
+        current = current.set(idx, static_cast<int>(idx));
+        idx = (idx + 7919) % size;
+    }
+}
+BENCHMARK(BM_PersistentVectorSnapshotAndSet)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+
+static void BM_VectorPushBack(benchmark::State& state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        Vector<int, UncheckedAccess> vec;
+        for (size_t i = 0; i < size; ++i)
+        {
+            vec.push_back(static_cast<int>(i));
+        }
+        benchmark::DoNotOptimize(vec.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_VectorPushBack)->Range(1 << 10, 1 << 20);
+
+static void BM_PersistentVectorPushBack(benchmark::State& state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        PersistentVector<int> vec;
+        for (size_t i = 0; i < size; ++i)
+        {
+            vec = vec.push_back(static_cast<int>(i));
+        }
+        benchmark::DoNotOptimize(vec.size());
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_PersistentVectorPushBack)->Range(1 << 10, 1 << 20);
+
+static void BM_PersistentVectorTransientPushBack(benchmark::State& state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        auto builder = PersistentVector<int>().transient();
+        for (size_t i = 0; i < size; ++i)
+        {
+            builder.push_back(static_cast<int>(i));
+        }
+        benchmark::DoNotOptimize(builder.persistent().size());
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_PersistentVectorTransientPushBack)->Range(1 << 10, 1 << 20);
+
+static void BM_PersistentVectorIterate(benchmark::State& state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    auto builder = PersistentVector<int>().transient();
+    for (size_t i = 0; i < size; ++i)
+    {
+        builder.push_back(static_cast<int>(i));
+    }
+    const auto vec = builder.persistent();
+
+    for (auto _ : state)
+    {
+        long long sum = 0;
+        for (const auto elem : vec)
+        {
+            sum += elem;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_PersistentVectorIterate)->Range(1 << 10, 1 << 20);
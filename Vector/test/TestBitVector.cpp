@@ -0,0 +1,158 @@
+#include "BitVector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+TEST(TestBitVector, ShouldConstructWithValue)
+{
+    BitVector zeros(130);
+    BitVector ones(130, true);
+
+    ASSERT_EQ(130, zeros.size());
+    ASSERT_EQ(3, zeros.word_count());
+    ASSERT_TRUE(zeros.none());
+    ASSERT_TRUE(ones.all());
+    ASSERT_EQ(130, ones.count());
+    // Padding bits of the last word stay zero
+    ASSERT_EQ(0b11, ones.word(2));
+}
+
+TEST(TestBitVector, ShouldSetTestAndResetBits)
+{
+    BitVector sut(200);
+
+    sut.set(0);
+    sut.set(63);
+    sut.set(64);
+    sut.set(199, true);
+    sut[100] = true;
+
+    ASSERT_TRUE(sut.test(0));
+    ASSERT_TRUE(sut.test(63));
+    ASSERT_TRUE(sut[64]);
+    ASSERT_TRUE(sut[100]);
+    ASSERT_FALSE(sut[101]);
+    ASSERT_EQ(5, sut.count());
+
+    sut.reset(63);
+    sut.flip(64);
+    sut.flip(65);
+    ASSERT_FALSE(sut[63]);
+    ASSERT_FALSE(sut[64]);
+    ASSERT_TRUE(sut[65]);
+    ASSERT_EQ(BitVector::Word{1}, sut.word(0));
+
+    ASSERT_THROW(sut.set(200), std::out_of_range);
+    ASSERT_THROW(sut.test(200), std::out_of_range);
+}
+
+TEST(TestBitVector, ShouldFindSetBits)
+{
+    BitVector sut(300);
+    ASSERT_EQ(BitVector::npos, sut.find_first());
+
+    sut.set(5);
+    sut.set(64);
+    sut.set(299);
+
+    ASSERT_EQ(5, sut.find_first());
+    ASSERT_EQ(64, sut.find_next(5));
+    ASSERT_EQ(299, sut.find_next(64));
+    ASSERT_EQ(BitVector::npos, sut.find_next(299));
+    // Search past the end doesn't wrap around to the first bit
+    ASSERT_EQ(BitVector::npos, sut.find_next(BitVector::npos));
+    ASSERT_EQ(BitVector::npos, sut.find_next(sut.size()));
+
+    std::vector<size_t> visited;
+    sut.for_each_set([&visited](size_t idx) { visited.push_back(idx); });
+    ASSERT_EQ((std::vector<size_t>{5, 64, 299}), visited);
+}
+
+TEST(TestBitVector, ShouldFindUnsetBits)
+{
+    BitVector sut(130, true);
+    ASSERT_EQ(BitVector::npos, sut.find_first_unset());
+
+    sut.reset(0);
+    sut.reset(127);
+    ASSERT_EQ(0, sut.find_first_unset());
+    ASSERT_EQ(127, sut.find_next_unset(0));
+    // Padding bits are not reported
+    ASSERT_EQ(BitVector::npos, sut.find_next_unset(127));
+    ASSERT_EQ(BitVector::npos, sut.find_next_unset(BitVector::npos));
+}
+
+TEST(TestBitVector, ShouldApplyBulkOperations)
+{
+    BitVector frontier(1000);
+    BitVector visited(1000);
+    for (size_t i = 0; i < 1000; i += 2)
+    {
+        frontier.set(i);
+    }
+    for (size_t i = 0; i < 1000; i += 3)
+    {
+        visited.set(i);
+    }
+
+    auto andResult = frontier;
+    andResult &= visited;
+    ASSERT_EQ(167, andResult.count());     // multiples of 6
+
+    auto orResult = frontier;
+    orResult |= visited;
+    ASSERT_EQ(667, orResult.count());
+
+    auto xorResult = frontier;
+    xorResult ^= visited;
+    ASSERT_EQ(500, xorResult.count());
+
+    frontier.and_not(visited);
+    ASSERT_EQ(333, frontier.count());
+    ASSERT_TRUE(frontier[2]);
+    ASSERT_FALSE(frontier[6]);
+
+    ASSERT_THROW(frontier &= BitVector(10), std::invalid_argument);
+}
+
+TEST(TestBitVector, ShouldResizeAndPushBack)
+{
+    BitVector sut(10, true);
+
+    sut.resize(70, true);
+    ASSERT_EQ(70, sut.count());
+
+    sut.resize(5);
+    ASSERT_EQ(5, sut.count());
+    sut.resize(64);
+    ASSERT_EQ(5, sut.count());
+
+    sut.push_back(true);
+    sut.push_back(false);
+    ASSERT_EQ(66, sut.size());
+    ASSERT_TRUE(sut[64]);
+    ASSERT_FALSE(sut[65]);
+
+    sut.set_all();
+    ASSERT_TRUE(sut.all());
+    sut.reset_all();
+    ASSERT_TRUE(sut.none());
+
+    sut.clear();
+    ASSERT_TRUE(sut.empty());
+}
+
+TEST(TestBitVector, ShouldCompareVectors)
+{
+    const BitVector sut1{true, false, true};
+    BitVector sut2(3);
+    sut2.set(0);
+
+    ASSERT_NE(sut1, sut2);
+    sut2.set(2);
+    ASSERT_EQ(sut1, sut2);
+}
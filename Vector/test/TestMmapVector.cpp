@@ -0,0 +1,183 @@
+#include "MmapVector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+struct Record
+{
+    int64_t timestamp;
+    double price;
+    int32_t quantity;
+};
+
+class TestMmapVector : public Test
+{
+protected:
+    void SetUp() override
+    {
+        const auto* testInfo = UnitTest::GetInstance()->current_test_info();
+        m_path = std::filesystem::temp_directory_path() / (std::string("mmap_vector_") + testInfo->name() + ".bin");
+        std::filesystem::remove(m_path);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(m_path);
+    }
+
+    std::string path() const { return m_path.string(); }
+    size_t file_size() const { return std::filesystem::file_size(m_path); }
+
+private:
+    std::filesystem::path m_path;
+};
+
+TEST_F(TestMmapVector, ShouldCreateEmptyFile)
+{
+    MmapVector<int> sut(path());
+
+    ASSERT_TRUE(sut.empty());
+    ASSERT_EQ(0, sut.size());
+    ASSERT_EQ(sut.begin(), sut.end());
+    ASSERT_TRUE(std::filesystem::exists(path()));
+}
+
+TEST_F(TestMmapVector, ShouldPushBackAndPersistRecords)
+{
+    {
+        MmapVector<Record> sut(path());
+        for (int i = 0; i < 10'000; ++i)
+        {
+            sut.push_back({i, i * 0.5, -i});
+        }
+
+        ASSERT_EQ(10'000, sut.size());
+        ASSERT_GE(sut.capacity(), sut.size());
+        ASSERT_EQ(9999, sut.back().timestamp);
+    }
+
+    // Growth slack is truncated on close
+    ASSERT_EQ(10'000 * sizeof(Record), file_size());
+
+    const MmapVector<const Record> sut(path());
+    ASSERT_EQ(10'000, sut.size());
+    for (int i = 0; i < 10'000; ++i)
+    {
+        ASSERT_EQ(i, sut[i].timestamp);
+        ASSERT_DOUBLE_EQ(i * 0.5, sut[i].price);
+        ASSERT_EQ(-i, sut[i].quantity);
+    }
+}
+
+TEST_F(TestMmapVector, ShouldMapExistingFile)
+{
+    const std::vector<int32_t> data{5, 4, 3, 2, 1};
+    {
+        std::ofstream file(path(), std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(int32_t));
+    }
+
+    MmapVector<int32_t> sut(path());
+    ASSERT_EQ(5, sut.size());
+    ASSERT_EQ(5, sut.front());
+    ASSERT_EQ(1, sut.back());
+
+    std::sort(sut.begin(), sut.end());
+    sut.sync();
+    sut.close();
+
+    std::ifstream file(path(), std::ios::binary);
+    std::vector<int32_t> result(data.size());
+    file.read(reinterpret_cast<char*>(result.data()), result.size() * sizeof(int32_t));
+    ASSERT_EQ((std::vector<int32_t>{1, 2, 3, 4, 5}), result);
+}
+
+// Read-only vector offers no modifiers
+template<typename Vec>
+concept CanPushBack = requires(Vec vec) { vec.push_back(1); };
+
+TEST_F(TestMmapVector, ShouldReadOnlyFileThroughAnyAccess)
+{
+    {
+        MmapVector<int> sut(path());
+        sut.push_back(1);
+        sut.push_back(2);
+    }
+
+    MmapVector<const int> sut(path());
+    ASSERT_EQ(2, sut.size());
+
+    // Pages are mapped read-only: every accessor returns a const reference and reads never throw
+    static_assert(std::is_same_v<const int&, decltype(sut[0])>);
+    static_assert(std::is_same_v<const int&, decltype(*sut.begin())>);
+    static_assert(!CanPushBack<MmapVector<const int>>);
+    static_assert(CanPushBack<MmapVector<int>>);
+
+    ASSERT_EQ(1, sut[0]);
+    ASSERT_EQ(1, sut.front());
+    ASSERT_EQ(2, sut.back());
+    ASSERT_EQ(2, sut.at(1));
+    ASSERT_THROW(sut.at(2), std::out_of_range);
+
+    std::vector<int> values;
+    for (const int value : sut)
+    {
+        values.push_back(value);
+    }
+    ASSERT_EQ((std::vector<int>{1, 2}), values);
+}
+
+TEST_F(TestMmapVector, ShouldThrowOnMissingFileInReadOnlyMode)
+{
+    ASSERT_THROW(MmapVector<const int>{path()}, std::system_error);
+}
+
+TEST_F(TestMmapVector, ShouldThrowOnFileSizeNotMultipleOfRecord)
+{
+    {
+        std::ofstream file(path(), std::ios::binary);
+        file.write("abc", 3);
+    }
+
+    ASSERT_THROW(MmapVector<int32_t>{path()}, std::runtime_error);
+}
+
+TEST_F(TestMmapVector, ShouldResizeAndPopBack)
+{
+    {
+        MmapVector<int> sut(path());
+        sut.resize(100, 7);
+        ASSERT_EQ(100, sut.size());
+        ASSERT_EQ(7, sut.at(99));
+        ASSERT_THROW(sut.at(100), std::out_of_range);
+
+        sut.pop_back();
+        sut.resize(10);
+        sut.advise(MmapVector<int>::Advice::Sequential);
+    }
+
+    ASSERT_EQ(10 * sizeof(int), file_size());
+}
+
+TEST_F(TestMmapVector, ShouldMoveConstruct)
+{
+    MmapVector<int> sut1(path());
+    sut1.push_back(1);
+    sut1.push_back(2);
+
+    MmapVector<int> sut2(std::move(sut1));
+    ASSERT_TRUE(sut1.empty());
+    ASSERT_EQ(2, sut2.size());
+    ASSERT_EQ(2, sut2.back());
+}
@@ -0,0 +1,218 @@
+#include "PersistentVector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+// Sizes crossing tail, one-level and two-level trie boundaries
+static constexpr size_t LargeSize = 32 * 32 * 32 + 100;
+
+TEST(TestPersistentVector, ShouldBeEmptyAfterConstruction)
+{
+    PersistentVector<int> sut;
+
+    ASSERT_TRUE(sut.empty());
+    ASSERT_EQ(0, sut.size());
+    ASSERT_EQ(sut.begin(), sut.end());
+    ASSERT_ANY_THROW(sut.front());
+    ASSERT_ANY_THROW(sut.pop_back());
+}
+
+TEST(TestPersistentVector, ShouldConstructFromInitializerList)
+{
+    PersistentVector sut{1, 2, 3};
+
+    ASSERT_EQ(3, sut.size());
+    ASSERT_EQ(1, sut.front());
+    ASSERT_EQ(2, sut[1]);
+    ASSERT_EQ(3, sut.back());
+    ASSERT_THROW(sut.at(3), std::out_of_range);
+}
+
+TEST(TestPersistentVector, ShouldPushBackManyElements)
+{
+    PersistentVector<size_t> sut;
+
+    for (size_t i = 0; i < LargeSize; ++i)
+    {
+        sut = sut.push_back(i);
+    }
+
+    ASSERT_EQ(LargeSize, sut.size());
+    for (size_t i = 0; i < LargeSize; ++i)
+    {
+        ASSERT_EQ(i, sut[i]);
+    }
+}
+
+TEST(TestPersistentVector, ShouldKeepSnapshotUnchangedAfterPushBack)
+{
+    const PersistentVector snapshot{1, 2, 3};
+
+    const auto sut = snapshot.push_back(4);
+
+    ASSERT_EQ(3, snapshot.size());
+    ASSERT_EQ(3, snapshot.back());
+    ASSERT_EQ(4, sut.size());
+    ASSERT_EQ(4, sut.back());
+}
+
+TEST(TestPersistentVector, ShouldKeepSnapshotUnchangedAfterSet)
+{
+    PersistentVector<std::string> snapshot;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        snapshot = snapshot.push_back(std::to_string(i));
+    }
+
+    const auto sut = snapshot.set(10, "ten").set(999, "last");
+
+    ASSERT_EQ("10", snapshot[10]);
+    ASSERT_EQ("999", snapshot[999]);
+    ASSERT_EQ("ten", sut[10]);
+    ASSERT_EQ("last", sut[999]);
+    ASSERT_EQ("500", sut[500]);
+    ASSERT_THROW(sut.set(1000, ""), std::out_of_range);
+}
+
+TEST(TestPersistentVector, ShouldPopBackAllElements)
+{
+    PersistentVector<size_t> sut;
+    for (size_t i = 0; i < LargeSize; ++i)
+    {
+        sut = sut.push_back(i);
+    }
+
+    const auto snapshot = sut;
+    for (size_t i = LargeSize; i > 0; --i)
+    {
+        ASSERT_EQ(i, sut.size());
+        ASSERT_EQ(i - 1, sut.back());
+        sut = sut.pop_back();
+    }
+
+    ASSERT_TRUE(sut.empty());
+    ASSERT_EQ(LargeSize, snapshot.size());
+    ASSERT_EQ(LargeSize - 1, snapshot.back());
+}
+
+TEST(TestPersistentVector, ShouldPushBackAfterPopBack)
+{
+    PersistentVector<int> sut;
+    for (int i = 0; i < 65; ++i)
+    {
+        sut = sut.push_back(i);
+    }
+
+    sut = sut.pop_back().pop_back().push_back(-1);
+
+    ASSERT_EQ(64, sut.size());
+    ASSERT_EQ(62, sut[62]);
+    ASSERT_EQ(-1, sut.back());
+}
+
+TEST(TestPersistentVector, ShouldIterateOverElements)
+{
+    PersistentVector<int> sut;
+    std::vector<int> expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        sut = sut.push_back(i * 2);
+        expected.push_back(i * 2);
+    }
+
+    ASSERT_EQ(expected, std::vector<int>(sut.begin(), sut.end()));
+    ASSERT_EQ(1000, sut.end() - sut.begin());
+    ASSERT_EQ(20, sut.begin()[10]);
+}
+
+TEST(TestPersistentVector, ShouldBatchUpdateWithTransient)
+{
+    const PersistentVector snapshot{1, 2, 3};
+
+    auto transient = snapshot.transient();
+    for (size_t i = 0; i < LargeSize; ++i)
+    {
+        transient.push_back(static_cast<int>(i));
+    }
+    transient.set(0, 100);
+    transient.pop_back();
+    const auto sut = transient.persistent();
+
+    ASSERT_EQ(3, snapshot.size());
+    ASSERT_EQ(1, snapshot.front());
+    ASSERT_EQ(LargeSize + 2, sut.size());
+    ASSERT_EQ(100, sut.front());
+    ASSERT_EQ(0, sut[3]);
+    ASSERT_EQ(LargeSize - 2, sut.back());
+}
+
+TEST(TestPersistentVector, ShouldNotModifyPersistentVersionsFromTransient)
+{
+    PersistentVector<int> sut;
+    auto transient = sut.transient();
+    for (int i = 0; i < 100; ++i)
+    {
+        transient.push_back(i);
+    }
+    sut = transient.persistent();
+
+    // New transient must copy nodes owned by the retired one
+    auto transient2 = sut.transient();
+    transient2.set(5, -5);
+    transient2.set(99, -99);
+    const auto sut2 = transient2.persistent();
+
+    ASSERT_EQ(5, sut[5]);
+    ASSERT_EQ(99, sut[99]);
+    ASSERT_EQ(-5, sut2[5]);
+    ASSERT_EQ(-99, sut2[99]);
+}
+
+TEST(TestPersistentVector, ShouldThrowOnTransientUseAfterPersistent)
+{
+    PersistentVector<int> sut;
+    auto transient = sut.transient();
+    transient.push_back(1);
+    sut = transient.persistent();
+
+    ASSERT_THROW(transient.push_back(2), std::logic_error);
+    ASSERT_THROW(transient.persistent(), std::logic_error);
+    ASSERT_EQ(1, sut.size());
+
+    // Finished transient is empty
+    ASSERT_EQ(0, transient.size());
+    ASSERT_TRUE(transient.empty());
+}
+
+TEST(TestPersistentVector, ShouldMoveTransientOnly)
+{
+    static_assert(!std::is_copy_constructible_v<PersistentVector<int>::Transient>);
+    static_assert(!std::is_copy_assignable_v<PersistentVector<int>::Transient>);
+
+    PersistentVector<int> sut;
+    auto transient = sut.transient();
+    transient.push_back(1);
+
+    auto moved = std::move(transient);
+    moved.push_back(2);
+
+    ASSERT_EQ(0, transient.size());
+    ASSERT_TRUE(transient.empty());
+    ASSERT_THROW(transient.push_back(3), std::logic_error);
+
+    auto assigned = sut.transient();
+    assigned = std::move(moved);
+    ASSERT_EQ(0, moved.size());
+    ASSERT_TRUE(moved.empty());
+    moved = std::move(assigned);
+    sut = moved.persistent();
+    ASSERT_EQ(2, sut.size());
+    ASSERT_EQ(2, sut[1]);
+}
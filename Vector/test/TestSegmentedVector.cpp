@@ -0,0 +1,202 @@
+#include "SegmentedVector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using namespace AlgoStruct;
+
+TEST(TestSegmentedVector, ShouldBeEmptyAfterConstruction)
+{
+    SegmentedVector<int> sut;
+
+    ASSERT_TRUE(sut.empty());
+    ASSERT_EQ(0, sut.size());
+    ASSERT_EQ(0, sut.block_count());
+    ASSERT_EQ(sut.begin(), sut.end());
+    ASSERT_ANY_THROW(sut.front());
+    ASSERT_ANY_THROW(sut.back());
+}
+
+TEST(TestSegmentedVector, ShouldPushBackManyElements)
+{
+    SegmentedVector<int> sut;
+
+    for (int i = 0; i < 100'000; ++i)
+    {
+        sut.push_back(i);
+    }
+
+    ASSERT_EQ(100'000, sut.size());
+    ASSERT_EQ(0, sut.front());
+    ASSERT_EQ(99'999, sut.back());
+    for (int i = 0; i < 100'000; ++i)
+    {
+        ASSERT_EQ(i, sut[i]);
+    }
+    ASSERT_THROW(sut.at(100'000), std::out_of_range);
+}
+
+TEST(TestSegmentedVector, ShouldKeepElementAddressesOnGrowth)
+{
+    SegmentedVector<std::string, 4> sut;
+    std::vector<const std::string*> addresses;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        addresses.push_back(&sut.emplace_back(std::to_string(i)));
+    }
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(addresses[i], &sut[i]);
+        ASSERT_EQ(std::to_string(i), *addresses[i]);
+    }
+}
+
+TEST(TestSegmentedVector, ShouldStoreElementsInGeometricBlocks)
+{
+    SegmentedVector<int, 4> sut;
+    for (int i = 0; i < 20; ++i)
+    {
+        sut.push_back(i);
+    }
+
+    ASSERT_EQ(3, sut.block_count());
+    ASSERT_EQ(4, sut.block(0).size());
+    ASSERT_EQ(8, sut.block(1).size());
+    ASSERT_EQ(8, sut.block(2).size());     // 16 allocated, 8 used
+    ASSERT_EQ(28, sut.capacity());
+    ASSERT_EQ(4, sut.block(1)[0]);
+    ASSERT_EQ(12, sut.block(2)[0]);
+    ASSERT_THROW(sut.block(3), std::out_of_range);
+}
+
+TEST(TestSegmentedVector, ShouldPopBackAndReuseBlocks)
+{
+    SegmentedVector<std::string, 4> sut{"a", "b", "c", "d", "e"};
+    const auto capacity = sut.capacity();
+
+    sut.pop_back();
+    sut.pop_back();
+    ASSERT_EQ(3, sut.size());
+    ASSERT_EQ("c", sut.back());
+
+    sut.clear();
+    ASSERT_TRUE(sut.empty());
+    sut.push_back("x");
+    ASSERT_EQ("x", sut.front());
+    ASSERT_EQ(capacity, sut.capacity());
+}
+
+TEST(TestSegmentedVector, ShouldIterateAndSortWithIterators)
+{
+    SegmentedVector<int, 2> sut{5, 3, 9, -1, 0, 7, 2};
+
+    std::sort(sut.begin(), sut.end());
+
+    ASSERT_EQ((std::vector<int>{-1, 0, 2, 3, 5, 7, 9}), std::vector<int>(sut.begin(), sut.end()));
+    ASSERT_EQ(7, sut.end() - sut.begin());
+}
+
+TEST(TestSegmentedVector, ShouldCopyAndMove)
+{
+    SegmentedVector<std::string, 2> sut1{"one", "two", "three"};
+
+    SegmentedVector<std::string, 2> sut2(sut1);
+    sut1[0] = "changed";
+    ASSERT_EQ("one", sut2[0]);
+    ASSERT_EQ(3, sut2.size());
+
+    SegmentedVector<std::string, 2> sut3(std::move(sut2));
+    ASSERT_TRUE(sut2.empty());
+    ASSERT_EQ("three", sut3.back());
+
+    sut2 = sut3;
+    ASSERT_EQ(3, sut2.size());
+    ASSERT_EQ("two", sut2[1]);
+}
+
+// Counts live instances, throws on copy when copiesLeft runs out
+struct Counted
+{
+    static inline int alive = 0;
+    static inline int copiesLeft = 0;
+
+    Counted() { ++alive; }
+    Counted(const Counted&)
+    {
+        if (copiesLeft-- == 0) throw std::runtime_error("copy failed");
+        ++alive;
+    }
+    ~Counted() { --alive; }
+};
+
+TEST(TestSegmentedVector, ShouldDestroyCopiedElementsIfCopyThrows)
+{
+    {
+        SegmentedVector<Counted, 2> sut1;
+        for (int i = 0; i < 10; ++i)
+        {
+            sut1.emplace_back();
+        }
+
+        Counted::copiesLeft = 5;
+        ASSERT_THROW((SegmentedVector<Counted, 2>(sut1)), std::runtime_error);
+        ASSERT_EQ(10, Counted::alive);
+
+        SegmentedVector<Counted, 2> sut3;
+        sut3.emplace_back();
+        Counted::copiesLeft = 5;
+        ASSERT_THROW(sut3 = sut1, std::runtime_error);
+        ASSERT_EQ(1, sut3.size());
+        ASSERT_EQ(11, Counted::alive);
+    }
+    ASSERT_EQ(0, Counted::alive);
+}
+
+TEST(TestSegmentedVector, ShouldVisitEveryElementInParallel)
+{
+    SegmentedVector<int> sut;
+    for (int i = 1; i <= 10'000; ++i)
+    {
+        sut.push_back(i);
+    }
+
+    for (size_t threads : {1, 3, 8})
+    {
+        std::atomic<long long> sum{0};
+        sut.parallel_for_each([&sum](int& elem) { sum += elem; }, threads);
+        ASSERT_EQ(50'005'000, sum.load()) << "threads: " << threads;
+    }
+
+    sut.parallel_for_each([](int& elem) { elem *= 2; }, 4);
+    ASSERT_EQ(2, sut.front());
+    ASSERT_EQ(20'000, sut.back());
+}
+
+TEST(TestSegmentedVector, ShouldVisitEveryBlock)
+{
+    SegmentedVector<int, 4> sut;
+    for (int i = 0; i < 100; ++i)
+    {
+        sut.push_back(i);
+    }
+
+    size_t visited = 0;
+    long long sum = 0;
+    sut.for_each_block([&](std::span<int> block)
+    {
+        visited += block.size();
+        sum = std::accumulate(block.begin(), block.end(), sum);
+    });
+
+    ASSERT_EQ(100, visited);
+    ASSERT_EQ(4950, sum);
+}
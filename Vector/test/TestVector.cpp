@@ -81,12 +81,31 @@ TEST(TestVector, ShouldPerfromIteratorArithmetics)
 
 TEST(TestlSice, ShouldCopyConstruct)
 {
-    // TODO
+    Vector sut1{1, 2, 3};
+    Vector sut2(sut1);
+
+    sut1[0] = 100;
+    ASSERT_EQ(3, sut1.size());
+    ASSERT_EQ(3, sut2.size());
+    ASSERT_EQ(1, sut2.front());
+    ASSERT_EQ(2, sut2[1]);
+    ASSERT_EQ(3, sut2.back());
 }
 
 TEST(TestlSice, ShouldCopyAssign)
 {
-    // TODO
+    Vector sut1{-10, -20, -30};
+    Vector sut2{1, 2};
+
+    sut2 = sut1;
+    sut2.push_back(100);
+    ASSERT_EQ(3, sut1.size());
+    ASSERT_EQ(-30, sut1.back());
+
+    ASSERT_EQ(4, sut2.size());
+    ASSERT_EQ(-10, sut2[0]);
+    ASSERT_EQ(-30, sut2[2]);
+    ASSERT_EQ(100, sut2[3]);
 }
 
 TEST(TestlSice, ShouldMoveConstruct)
@@ -119,3 +138,57 @@ TEST(TestlSice, ShouldMoveAssign)
     ASSERT_EQ(100, sut2[5]);
 }
 
+
+TEST(TestVector, ShouldConstructWithSize)
+{
+    Vector sut(5, 7);
+
+    ASSERT_EQ(5, sut.size());
+    for (size_t i = 0; i < sut.size(); ++i)
+    {
+        EXPECT_EQ(7, sut[i]);
+    }
+}
+
+TEST(TestVector, ShouldThrowOnAtOutOfRange)
+{
+    Vector sut{1, 2, 3};
+    ASSERT_EQ(3, sut.at(2));
+    ASSERT_THROW(sut.at(3), std::out_of_range);
+
+    Vector<int, UncheckedAccess> uncheckedSut{1, 2, 3};
+    ASSERT_EQ(1, uncheckedSut.at(0));
+    ASSERT_THROW(uncheckedSut.at(3), std::out_of_range);
+}
+
+TEST(TestVector, ShouldThrowOnSubscriptOutOfRangeWhenChecked)
+{
+    Vector<int, CheckedAccess> sut{1, 2, 3};
+    ASSERT_EQ(2, sut[1]);
+    ASSERT_THROW(sut[3], std::out_of_range);
+    ASSERT_THROW(*sut.end(), std::out_of_range);
+}
+
+TEST(TestVector, ShouldDetectInvalidatedIteratorWhenChecked)
+{
+    Vector<int, CheckedAccess> sut{1, 2};
+    auto it = sut.begin();
+    ASSERT_EQ(1, *it);
+
+    // Exceeds capacity and reallocates the buffer
+    sut.push_back(3);
+    ASSERT_THROW(*it, std::logic_error);
+    ASSERT_EQ(1, *sut.begin());
+}
+
+TEST(TestVector, ShouldStripChecksWhenUnchecked)
+{
+    using UncheckedVector = Vector<int, UncheckedAccess>;
+    static_assert(sizeof(UncheckedVector::iterator) == sizeof(int*));
+    static_assert(sizeof(UncheckedVector) < sizeof(Vector<int, CheckedAccess>));
+
+    UncheckedVector sut{4, 5, 6};
+    ASSERT_EQ(4, sut.front());
+    ASSERT_EQ(6, sut.back());
+    ASSERT_EQ(5, sut.begin()[1]);
+}